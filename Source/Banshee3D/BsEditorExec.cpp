@@ -4,6 +4,38 @@
 #include <stdio.h>
 #include "BsEditorApplication.h"
 #include "Error/BsCrashHandler.h"
+#include "Utility/BsEditorProfiler.h"
+
+namespace bs
+{
+	/**
+	 * Applies command line arguments to an already started editor. Supported arguments:
+	 *  - -profileCapture <path> [numFrames] - Captures the provided number of frames (300 by default) using the editor
+	 *    profiler and writes them into a Chrome trace file at the provided path.
+	 */
+	void applyCommandLine(const Vector<String>& args)
+	{
+		for (UINT32 i = 0; i < (UINT32)args.size(); i++)
+		{
+			if (args[i] == "-profileCapture" && (i + 1) < (UINT32)args.size())
+			{
+				Path tracePath = args[++i];
+
+				UINT32 numFrames = EditorProfiler::MAX_FRAMES;
+				if ((i + 1) < (UINT32)args.size() && isNumber(args[i + 1]))
+					numFrames = parseUINT32(args[++i]);
+
+				EditorProfiler::instance().captureFrames(tracePath, numFrames);
+			}
+		}
+	}
+
+	/** @copydoc applyCommandLine(const Vector<String>&) */
+	void applyCommandLine(const char* commandLine)
+	{
+		applyCommandLine(StringUtil::split(commandLine, " "));
+	}
+}
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include <windows.h>
@@ -22,6 +54,7 @@ int CALLBACK WinMain(
 	__try
 	{
 		EditorApplication::startUp();
+		applyCommandLine(lpCmdLine);
 		EditorApplication::instance().runMainLoop();
 		EditorApplication::shutDown();
 	}
@@ -37,9 +70,10 @@ int CALLBACK WinMain(
 #else
 using namespace bs;
 
-int main()
+int main(int argc, char* argv[])
 {
 	EditorApplication::startUp();
+	applyCommandLine(Vector<String>(argv + 1, argv + argc));
 	EditorApplication::instance().runMainLoop();
 	EditorApplication::shutDown();
 }
@@ -27,6 +27,7 @@
 #include "Resources/BsResources.h"
 #include "Scene/BsSceneManager.h"
 #include "Utility/BsSplashScreen.h"
+#include "Utility/BsEditorProfiler.h"
 #include "Utility/BsDynLib.h"
 #include "Scene/BsSceneManager.h"
 #include "BsEngineConfig.h"
@@ -80,6 +81,7 @@ namespace bs
 	{
 		ProjectLibrary::shutDown();
 		BuiltinEditorResources::shutDown();
+		EditorProfiler::shutDown();
 	}
 
 	void EditorApplication::onStartUp()
@@ -111,6 +113,8 @@ namespace bs
 		ScriptCodeImporter* scriptCodeImporter = bs_new<ScriptCodeImporter>();
 		Importer::instance()._registerAssetImporter(scriptCodeImporter);
 
+		EditorProfiler::startUp();
+
 		// Hidden dependency: Needs to be done before BuiltinEditorResources import as shader include lookup requires it
 		ProjectLibrary::startUp();
 
@@ -196,7 +200,11 @@ namespace bs
 	{
 		Application::preUpdate();
 
-		EditorWidgetManager::instance().update();
+		{
+			EditorProfilerSample sample("EditorWidgetManager::update");
+			EditorWidgetManager::instance().update();
+		}
+
 		DropDownWindowManager::instance().update();
 	}
 
@@ -204,7 +212,10 @@ namespace bs
 	{
 		// Call update on editor widgets before parent's postUpdate because the parent will render the GUI and we need
 		// to ensure editor widget's GUI is updated.
-		EditorWindowManager::instance().update();
+		{
+			EditorProfilerSample sample("EditorWindowManager::update");
+			EditorWindowManager::instance().update();
+		}
 
 		Application::postUpdate();
 
@@ -220,6 +231,8 @@ namespace bs
 		}
 
 		setFPSLimit(mEditorSettings->getFPSLimit());
+
+		EditorProfiler::instance().endFrame();
 	}
 
 	void EditorApplication::quitRequested()
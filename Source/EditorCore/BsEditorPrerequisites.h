@@ -174,6 +174,7 @@ namespace bs
 	class EditorCommand;
 	class ProjectFileMeta;
 	class ProjectResourceMeta;
+	class ProjectLibraryIndex;
 	class SceneGrid;
 	class HandleSlider;
 	class HandleSliderLine;
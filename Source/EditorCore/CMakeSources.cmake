@@ -7,6 +7,7 @@ set(BS_BANSHEEEDITOR_INC_SETTINGS
 set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Library/BsProjectLibrary.cpp"
 	"Library/BsProjectLibraryEntries.cpp"
+	"Library/BsProjectLibraryIndex.cpp"
 	"Library/BsProjectResourceMeta.cpp"
 	"Library/BsEditorShaderIncludeHandler.cpp"
 )
@@ -67,6 +68,7 @@ set(BS_BANSHEEEDITOR_SRC_GUI
 set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Library/BsProjectLibrary.h"
 	"Library/BsProjectLibraryEntries.h"
+	"Library/BsProjectLibraryIndex.h"
 	"Library/BsProjectResourceMeta.h"
 	"Library/BsEditorShaderIncludeHandler.h"
 )
@@ -158,6 +160,7 @@ set(BS_BANSHEEEDITOR_INC_HANDLES
 set(BS_BANSHEEEDITOR_SRC_UTILITY
 	"Utility/BsEditorUtility.cpp"
 	"Utility/BsSplashScreen.cpp"
+	"Utility/BsEditorProfiler.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
@@ -180,6 +183,7 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 	"Utility/BsEditorUtility.h"
 	"Utility/BsBuiltinEditorResources.h"
 	"Utility/BsSplashScreen.h"
+	"Utility/BsEditorProfiler.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
@@ -132,9 +132,9 @@ namespace bs
 				continue;
 
 			ProjectLibrary::FileEntry* resEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
-			if (resEntry->meta->hasTypeId(TID_ScriptCode))
+			if (resEntry->getMeta()->hasTypeId(TID_ScriptCode))
 			{
-				SPtr<ScriptCodeImportOptions> scriptIO = std::static_pointer_cast<ScriptCodeImportOptions>(resEntry->meta->getImportOptions());
+				SPtr<ScriptCodeImportOptions> scriptIO = std::static_pointer_cast<ScriptCodeImportOptions>(resEntry->getMeta()->getImportOptions());
 
 				bool isEditorScript = false;
 				if (scriptIO != nullptr)
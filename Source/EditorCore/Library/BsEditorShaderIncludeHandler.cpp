@@ -28,9 +28,9 @@ namespace bs
 		{
 			ProjectLibrary::FileEntry* fileEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
 
-			if (fileEntry->meta != nullptr)
+			if (fileEntry->getMeta() != nullptr)
 			{
-				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				auto& resourceMetas = fileEntry->getMeta()->getResourceMetaData();
 				for(auto& resMeta : resourceMetas)
 				{
 					if(resMeta->getTypeID() == TID_ShaderInclude)
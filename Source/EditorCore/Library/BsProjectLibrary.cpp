@@ -13,6 +13,7 @@
 #include "Serialization/BsFileSerializer.h"
 #include "Debug/BsDebug.h"
 #include "Library/BsProjectLibraryEntries.h"
+#include "Library/BsProjectLibraryIndex.h"
 #include "Resources/BsResource.h"
 #include "BsEditorApplication.h"
 #include "Material/BsShader.h"
@@ -21,6 +22,8 @@
 #include "CoreThread/BsCoreThread.h"
 #include <regex>
 #include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTime.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -89,6 +92,7 @@ namespace bs
 	const Path ProjectLibrary::RESOURCES_DIR = "Resources/";
 	const Path ProjectLibrary::INTERNAL_RESOURCES_DIR = PROJECT_INTERNAL_DIR + GAME_RESOURCES_FOLDER_NAME;
 	const char* ProjectLibrary::LIBRARY_ENTRIES_FILENAME = "ProjectLibrary.asset";
+	const char* ProjectLibrary::LIBRARY_INDEX_FILENAME = "ProjectLibrary.index";
 	const char* ProjectLibrary::RESOURCE_MANIFEST_FILENAME = "ResourceManifest.asset";
 
 	ProjectLibrary::LibraryEntry::LibraryEntry()
@@ -107,6 +111,34 @@ namespace bs
 		: LibraryEntry(path, name, parent, LibraryEntryType::File), lastUpdateTime(0)
 	{ }
 
+	const SPtr<ProjectFileMeta>& ProjectLibrary::FileEntry::getMeta() const
+	{
+		if (mIndexRecord == (UINT32)-1)
+			return mMeta;
+
+		mIndexRecord = (UINT32)-1;
+
+		Path metaPath = path;
+		metaPath.setFilename(metaPath.getFilename() + ".meta");
+
+		if (FileSystem::isFile(metaPath))
+		{
+			FileDecoder fs(metaPath);
+			SPtr<IReflectable> loadedMeta = fs.decode();
+
+			if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+				mMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
+		}
+
+		return mMeta;
+	}
+
+	void ProjectLibrary::FileEntry::setMeta(const SPtr<ProjectFileMeta>& meta)
+	{
+		mMeta = meta;
+		mIndexRecord = (UINT32)-1;
+	}
+
 	ProjectLibrary::DirectoryEntry::DirectoryEntry()
 	{ }
 
@@ -126,7 +158,7 @@ namespace bs
 		clearEntries();
 	}
 
-	UINT32 ProjectLibrary::checkForModifications(const Path& fullPath)
+	UINT32 ProjectLibrary::checkForModifications(const Path& fullPath, bool recursive)
 	{
 		UINT32 resourcesToImport = 0;
 
@@ -205,6 +237,7 @@ namespace bs
 				Vector<Path> childDirectories;
 				Vector<bool> existingEntries;
 				Vector<LibraryEntry*> toDelete;
+				Vector<DirectoryEntry*> newDirectories;
 
 				while(!todo.empty())
 				{
@@ -281,7 +314,10 @@ namespace bs
 						}
 
 						if(existingEntry == nullptr)
-							addDirectoryInternal(currentDir, dirPath);
+						{
+							DirectoryEntry* newEntry = addDirectoryInternal(currentDir, dirPath);
+							newDirectories.push_back(newEntry);
+						}
 					}
 
 					{
@@ -304,11 +340,22 @@ namespace bs
 						toDelete.clear();
 					}
 
-					for(auto& child : currentDir->mChildren)
+					if(recursive)
+					{
+						for(auto& child : currentDir->mChildren)
+						{
+							if(child->type == LibraryEntryType::Directory)
+								todo.push(static_cast<DirectoryEntry*>(child));
+						}
+					}
+					else
 					{
-						if(child->type == LibraryEntryType::Directory)
-							todo.push(static_cast<DirectoryEntry*>(child));
+						// New folders have no entries yet, so their contents must always be added in full
+						for(auto& newDirectory : newDirectories)
+							todo.push(newDirectory);
 					}
+
+					newDirectories.clear();
 				}
 			}
 		}
@@ -316,6 +363,64 @@ namespace bs
 		return resourcesToImport;
 	}
 
+	void ProjectLibrary::queueModification(const Path& path)
+	{
+		if (!mIsLoaded || !mResourcesFolder.includes(path))
+			return;
+
+		const float currentTime = gTime().getTime();
+		mLastModificationTime = currentTime;
+
+		if (mModificationQueueOverflow)
+			return;
+
+		if (mQueuedModifications.size() >= MAX_QUEUED_MODIFICATIONS)
+		{
+			// Too many changes (e.g. a large folder was copied or version control updated the project), checking
+			// everything at once is going to be faster than checking paths one by one
+			mQueuedModifications.clear();
+			mModificationQueueOverflow = true;
+			return;
+		}
+
+		mQueuedModifications[path] = currentTime;
+	}
+
+	UINT32 ProjectLibrary::_processQueuedModifications(bool force)
+	{
+		UINT32 resourcesToImport = 0;
+
+		if (mQueuedModifications.empty() && !mModificationQueueOverflow)
+			return resourcesToImport;
+
+		const float currentTime = gTime().getTime();
+		if (mModificationQueueOverflow)
+		{
+			if (!force && (currentTime - mLastModificationTime) < MODIFICATION_DEBOUNCE_INTERVAL)
+				return resourcesToImport;
+
+			mModificationQueueOverflow = false;
+			return checkForModifications(mResourcesFolder);
+		}
+
+		Vector<Path> toCheck;
+		for (auto iter = mQueuedModifications.begin(); iter != mQueuedModifications.end();)
+		{
+			if (force || (currentTime - iter->second) >= MODIFICATION_DEBOUNCE_INTERVAL)
+			{
+				toCheck.push_back(iter->first);
+				iter = mQueuedModifications.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		for (auto& path : toCheck)
+			resourcesToImport += checkForModifications(path, false);
+
+		return resourcesToImport;
+	}
+
 	ProjectLibrary::FileEntry* ProjectLibrary::addResourceInternal(DirectoryEntry* parent, const Path& filePath, 
 		const SPtr<ImportOptions>& importOptions, bool forceReimport)
 	{
@@ -339,24 +444,33 @@ namespace bs
 
 	void ProjectLibrary::deleteResourceInternal(FileEntry* resource)
 	{
-		if(resource->meta != nullptr)
+		Vector<UUID> uuids;
+		if(resource->isMetaPending())
+		{
+			// No need to load the meta file (which might not exist anymore) just to find out the resource UUIDs
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(resource->mIndexRecord);
+			for(UINT32 i = 0; i < record.numResources; i++)
+				uuids.push_back(mIndex->getResource(record.firstResource + i).uuid);
+		}
+		else if(resource->getMeta() != nullptr)
 		{
-			auto& resourceMetas = resource->meta->getResourceMetaData();
+			auto& resourceMetas = resource->getMeta()->getResourceMetaData();
 			for(auto& entry : resourceMetas)
-			{
-				const UUID& uuid = entry->getUUID();
-
-				Path path;
-				if (mResourceManifest->uuidToFilePath(uuid, path))
-				{
-					if (FileSystem::isFile(path))
-						FileSystem::remove(path);
+				uuids.push_back(entry->getUUID());
+		}
 
-					mResourceManifest->unregisterResource(uuid);
-				}
+		for(auto& uuid : uuids)
+		{
+			Path path;
+			if (mResourceManifest->uuidToFilePath(uuid, path))
+			{
+				if (FileSystem::isFile(path))
+					FileSystem::remove(path);
 
-				mUUIDToPath.erase(uuid);
+				mResourceManifest->unregisterResource(uuid);
 			}
+
+			mUUIDToPath.erase(uuid);
 		}
 
 		Path metaPath = getMetaPath(resource->path);
@@ -416,8 +530,9 @@ namespace bs
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
 		// If the file doesn't have meta-data, attempt to read it from a meta-file, if one exists. This can only happen
-		// if library data is obsolete (e.g. when adding files from another copy of the project)
-		if(fileEntry->meta == nullptr)
+		// if library data is obsolete (e.g. when adding files from another copy of the project). Entries with a pending
+		// meta file were validated against the meta file on load, so they don't need to be checked (and loaded) here.
+		if(!fileEntry->isMetaPending() && fileEntry->getMeta() == nullptr)
 		{
 			if(FileSystem::isFile(metaPath))
 			{
@@ -427,20 +542,9 @@ namespace bs
 				if(loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
 				{
 					const SPtr<ProjectFileMeta>& fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
-					fileEntry->meta = fileMeta;
-
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+					fileEntry->setMeta(fileMeta);
 
-					if (!resourceMetas.empty())
-					{
-						mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
-
-						for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
-						{
-							const SPtr<ProjectResourceMeta>& entry = resourceMetas[i];
-							mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
-						}
-					}
+					registerResourcePaths(fileEntry);
 				}
 			}
 		}
@@ -454,8 +558,8 @@ namespace bs
 			SPtr<ImportOptions> curImportOptions = nullptr;
 			if (importOptions == nullptr && !isNativeResource)
 			{
-				if (fileEntry->meta != nullptr)
-					curImportOptions = fileEntry->meta->getImportOptions();
+				if (fileEntry->getMeta() != nullptr)
+					curImportOptions = fileEntry->getMeta()->getImportOptions();
 				else
 					curImportOptions = Importer::instance().createImportOptions(fileEntry->path);
 			}
@@ -490,9 +594,9 @@ namespace bs
 			if(!isNativeResource)
 			{
 				// Find UUIDs for any existing sub-resources
-				if (fileEntry->meta != nullptr)
+				if (fileEntry->getMeta() != nullptr)
 				{
-					const Vector<SPtr<ProjectResourceMeta>>& resourceMetas = fileEntry->meta->getAllResourceMetaData();
+					const Vector<SPtr<ProjectResourceMeta>>& resourceMetas = fileEntry->getMeta()->getAllResourceMetaData();
 					for (auto& entry : resourceMetas)
 						queuedImport->resources.emplace_back(entry->getUniqueName(), nullptr, entry->getUUID());
 				}
@@ -561,9 +665,9 @@ namespace bs
 			{
 				// If meta exists make sure it is registered in the manifest before load, otherwise it will get assigned a new UUID.
 				// This can happen if library isn't properly saved before exiting the application.
-				if (fileEntry->meta != nullptr)
+				if (fileEntry->getMeta() != nullptr)
 				{
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+					auto& resourceMetas = fileEntry->getMeta()->getResourceMetaData();
 					mResourceManifest->registerResource(resourceMetas[0]->getUUID(), fileEntry->path);
 				}
 
@@ -614,6 +718,8 @@ namespace bs
 
 	void ProjectLibrary::_finishQueuedImports(bool wait)
 	{
+		EditorProfilerSample sample("ProjectLibrary::_finishQueuedImports");
+
 		for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
 		{
 			SPtr<QueuedImport> queuedImport = iter->second;
@@ -644,17 +750,17 @@ namespace bs
 			metaPath.setFilename(metaPath.getFilename() + ".meta");
 
 			Vector<SPtr<ProjectResourceMeta>> existingMetas;
-			if(fileEntry->meta == nullptr) // Build a brand new meta-file
-				fileEntry->meta = ProjectFileMeta::create(queuedImport->importOptions);
+			if(fileEntry->getMeta() == nullptr) // Build a brand new meta-file
+				fileEntry->setMeta(ProjectFileMeta::create(queuedImport->importOptions));
 			else // Existing meta-file, which needs to be updated
 			{
 				// Remove existing dependencies (they will be re-added later)
 				removeDependencies(fileEntry);
 
-				existingMetas = fileEntry->meta->getAllResourceMetaData();
+				existingMetas = fileEntry->getMeta()->getAllResourceMetaData();
 
-				fileEntry->meta->clearResourceMetaData();
-				fileEntry->meta->mImportOptions = queuedImport->importOptions;
+				fileEntry->getMeta()->clearResourceMetaData();
+				fileEntry->getMeta()->mImportOptions = queuedImport->importOptions;
 			}
 
 			Path internalResourcesPath = mProjectFolder;
@@ -689,7 +795,7 @@ namespace bs
 						gResources().update(importedResource, entry.resource);
 
 						metaEntry->setPreviewIcons(icons);
-						fileEntry->meta->add(metaEntry);
+						fileEntry->getMeta()->add(metaEntry);
 
 						iterMeta = existingMetas.erase(iterMeta);
 						foundMeta = true;
@@ -717,7 +823,7 @@ namespace bs
 
 					SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId,
 						icons, subMeta);
-					fileEntry->meta->add(resMeta);
+					fileEntry->getMeta()->add(resMeta);
 				}
 
 				// Keep resource metas that we are not currently using, in case they get restored so their references
@@ -725,7 +831,7 @@ namespace bs
 				if (!queuedImport->pruneMetas)
 				{
 					for (auto& metaEntry : existingMetas)
-						fileEntry->meta->addInactive(metaEntry);
+						fileEntry->getMeta()->addInactive(metaEntry);
 				}
 
 				// Update UUID to path mapping
@@ -745,7 +851,7 @@ namespace bs
 
 			// Save the meta file
 			FileEncoder fs(metaPath);
-			fs.encode(fileEntry->meta.get());
+			fs.encode(fileEntry->getMeta().get());
 
 			// Register any dependencies this resource depends on
 			addDependencies(fileEntry);
@@ -760,23 +866,35 @@ namespace bs
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
 	{
-		if(resource->meta == nullptr)
+		// Answer from the library index if possible, so checking an unmodified project doesn't load any meta files
+		bool hasMeta;
+		if (resource->isMetaPending())
+			hasMeta = (mIndex->getEntry(resource->mIndexRecord).flags & ProjectLibraryIndex::EF_HasMeta) != 0;
+		else
+			hasMeta = resource->getMeta() != nullptr;
+
+		if(!hasMeta)
 		{
 			// Allow no meta if import in progress
 			const auto iterFind = mQueuedImports.find(resource);
 			if(iterFind == mQueuedImports.end())
 				return false;
 		}
+		else if (resource->isMetaPending())
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(resource->mIndexRecord);
+			for (UINT32 i = 0; i < record.numResources; i++)
+			{
+				if (!isImported(mIndex->getResource(record.firstResource + i).uuid))
+					return false;
+			}
+		}
 		else
 		{
-			auto& resourceMetas = resource->meta->getResourceMetaData();
+			auto& resourceMetas = resource->getMeta()->getResourceMetaData();
 			for (auto& resMeta : resourceMetas)
 			{
-				Path internalPath;
-				if (!mResourceManifest->uuidToFilePath(resMeta->getUUID(), internalPath))
-					return false;
-
-				if (!FileSystem::isFile(internalPath))
+				if (!isImported(resMeta->getUUID()))
 					return false;
 			}
 		}
@@ -785,6 +903,15 @@ namespace bs
 		return lastModifiedTime <= resource->lastUpdateTime;
 	}
 
+	bool ProjectLibrary::isImported(const UUID& uuid) const
+	{
+		Path internalPath;
+		if (!mResourceManifest->uuidToFilePath(uuid, internalPath))
+			return false;
+
+		return FileSystem::isFile(internalPath);
+	}
+
 	Vector<ProjectLibrary::LibraryEntry*> ProjectLibrary::search(const String& pattern)
 	{
 		return search(pattern, {});
@@ -827,26 +954,8 @@ namespace bs
 						if (child->type == LibraryEntryType::File)
 						{
 							FileEntry* childFileEntry = static_cast<FileEntry*>(child);
-							if (childFileEntry->meta != nullptr)
-							{
-								auto& resourceMetas = childFileEntry->meta->getResourceMetaData();
-								for (auto& typeId : typeIds)
-								{
-									bool found = false;
-									for (auto& resMeta : resourceMetas)
-									{
-										if (resMeta->getTypeID() == typeId)
-										{
-											foundEntries.push_back(child);
-											found = true;
-											break;
-										}
-									}
-
-									if (found)
-										break;
-								}
-							}
+							if (hasResourceOfType(childFileEntry, typeIds))
+								foundEntries.push_back(child);
 						}
 					}
 				}
@@ -957,10 +1066,10 @@ namespace bs
 			if (entry->type == LibraryEntryType::File)
 			{
 				FileEntry* fileEntry = static_cast<FileEntry*>(entry);
-				if (fileEntry->meta == nullptr)
+				if (fileEntry->getMeta() == nullptr)
 					return nullptr;
 
-				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				auto& resourceMetas = fileEntry->getMeta()->getResourceMetaData();
 				for(auto& resMeta : resourceMetas)
 				{
 					if (resMeta->getUniqueName() == path.getTail())
@@ -980,10 +1089,10 @@ namespace bs
 						if (child->type == LibraryEntryType::File)
 						{
 							FileEntry* fileEntry = static_cast<FileEntry*>(child);
-							if (fileEntry->meta == nullptr)
+							if (fileEntry->getMeta() == nullptr)
 								return nullptr;
 
-							return fileEntry->meta->getResourceMetaData()[0];
+							return fileEntry->getMeta()->getResourceMetaData()[0];
 						}
 					}
 				}
@@ -999,10 +1108,10 @@ namespace bs
 				return nullptr;
 
 			FileEntry* fileEntry = static_cast<FileEntry*>(entry);
-			if (fileEntry->meta == nullptr)
+			if (fileEntry->getMeta() == nullptr)
 				return nullptr;
 
-			return fileEntry->meta->getResourceMetaData()[0];
+			return fileEntry->getMeta()->getResourceMetaData()[0];
 		}
 	}
 
@@ -1134,9 +1243,9 @@ namespace bs
 					removeDependencies(fileEntry);
 
 					// Update uuid <-> path mapping
-					if(fileEntry->meta != nullptr)
+					if(fileEntry->getMeta() != nullptr)
 					{
-						auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+						auto& resourceMetas = fileEntry->getMeta()->getResourceMetaData();
 
 						if (resourceMetas.size() > 0)
 						{
@@ -1261,8 +1370,8 @@ namespace bs
 			FileEntry* oldResEntry = static_cast<FileEntry*>(oldEntry);
 
 			SPtr<ImportOptions> importOptions;
-			if (oldResEntry->meta != nullptr)
-				importOptions = oldResEntry->meta->getImportOptions();
+			if (oldResEntry->getMeta() != nullptr)
+				importOptions = oldResEntry->getMeta()->getImportOptions();
 
 			addResourceInternal(newEntryParent, newFullPath, importOptions, true);
 		}
@@ -1294,8 +1403,8 @@ namespace bs
 						FileEntry* childResEntry = static_cast<FileEntry*>(child);
 
 						SPtr<ImportOptions> importOptions;
-						if (childResEntry->meta != nullptr)
-							importOptions = childResEntry->meta->getImportOptions();
+						if (childResEntry->getMeta() != nullptr)
+							importOptions = childResEntry->getMeta()->getImportOptions();
 
 						addResourceInternal(destDir, childDestPath, importOptions, true);
 					}
@@ -1351,16 +1460,16 @@ namespace bs
 			return;
 
 		FileEntry* resEntry = static_cast<FileEntry*>(entry);
-		if (resEntry->meta == nullptr)
+		if (resEntry->getMeta() == nullptr)
 			return;
 
-		resEntry->meta->setIncludeInBuild(include);
+		resEntry->getMeta()->setIncludeInBuild(include);
 
 		Path metaPath = resEntry->path;
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
 		FileEncoder fs(metaPath);
-		fs.encode(resEntry->meta.get());
+		fs.encode(resEntry->getMeta().get());
 	}
 
 	void ProjectLibrary::setUserData(const Path& path, const SPtr<IReflectable>& userData)
@@ -1382,7 +1491,7 @@ namespace bs
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
 		FileEncoder fs(metaPath);
-		fs.encode(fileEntry->meta.get());
+		fs.encode(fileEntry->getMeta().get());
 	}
 
 	Vector<ProjectLibrary::FileEntry*> ProjectLibrary::getResourcesForBuild() const
@@ -1402,7 +1511,7 @@ namespace bs
 				if (child->type == LibraryEntryType::File)
 				{
 					FileEntry* resEntry = static_cast<FileEntry*>(child);
-					if (resEntry->meta != nullptr && resEntry->meta->getIncludeInBuild())
+					if (isIncludedInBuild(resEntry))
 						output.push_back(resEntry);
 				}
 				else if (child->type == LibraryEntryType::Directory)
@@ -1504,7 +1613,10 @@ namespace bs
 		clearEntries();
 		mRootEntry = bs_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
 
+		mIndex = nullptr;
 		mDependencies.clear();
+		mQueuedModifications.clear();
+		mModificationQueueOverflow = false;
 		gResources().unregisterResourceManifest(mResourceManifest);
 		mResourceManifest = nullptr;
 		mIsLoaded = false;
@@ -1565,6 +1677,12 @@ namespace bs
 		FileEncoder fs(libraryEntriesPath);
 		fs.encode(libEntries.get());
 
+		Path libraryIndexPath = mProjectFolder;
+		libraryIndexPath.append(PROJECT_INTERNAL_DIR);
+		libraryIndexPath.append(LIBRARY_INDEX_FILENAME);
+
+		saveIndex(libraryIndexPath);
+
 		// Restore absolute entry paths
 		makeEntriesAbsolute();
 
@@ -1585,11 +1703,17 @@ namespace bs
 
 		mRootEntry = bs_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
 
+		Path libraryIndexPath = mProjectFolder;
+		libraryIndexPath.append(PROJECT_INTERNAL_DIR);
+		libraryIndexPath.append(LIBRARY_INDEX_FILENAME);
+
 		Path libraryEntriesPath = mProjectFolder;
 		libraryEntriesPath.append(PROJECT_INTERNAL_DIR);
 		libraryEntriesPath.append(LIBRARY_ENTRIES_FILENAME);
 
-		if(FileSystem::exists(libraryEntriesPath))
+		// Prefer the index as it allows us to skip loading meta files until they're needed. Fall back to the full entries
+		// file if the index is missing or obsolete.
+		if(!loadIndex(libraryIndexPath) && FileSystem::exists(libraryEntriesPath))
 		{
 			FileDecoder fs(libraryEntriesPath);
 			SPtr<ProjectLibraryEntries> libEntries = std::static_pointer_cast<ProjectLibraryEntries>(fs.decode());
@@ -1616,72 +1740,83 @@ namespace bs
 
 		gResources().registerResourceManifest(mResourceManifest);
 
-		// Load all meta files
-		Stack<DirectoryEntry*> todo;
-		todo.push(mRootEntry);
-
-		Vector<LibraryEntry*> deletedEntries;
+		// Validate entries and find meta files that aren't covered by the index. This requires a lot of file system
+		// access, so the checks are split into batches and executed in parallel. Batches are formed from a flattened
+		// hierarchy, so the work is split evenly regardless of how the entries are organized into folders.
+		Vector<LibraryEntry*> entries;
+		Vector<UINT32> subtreeEnds;
 
-		while(!todo.empty())
+		std::function<void(LibraryEntry*)> flatten = [&](LibraryEntry* entry)
 		{
-			DirectoryEntry* curDir = todo.top();
-			todo.pop();
+			const UINT32 idx = (UINT32)entries.size();
+			entries.push_back(entry);
+			subtreeEnds.push_back(idx + 1);
 
-			for(auto& child : curDir->mChildren)
+			if(entry->type == LibraryEntryType::Directory)
 			{
-				if(child->type == LibraryEntryType::File)
-				{
-					FileEntry* resEntry = static_cast<FileEntry*>(child);
-					
-					if (FileSystem::isFile(resEntry->path))
-					{
-						if (resEntry->meta == nullptr)
-						{
-							Path metaPath = resEntry->path;
-							metaPath.setFilename(metaPath.getFilename() + ".meta");
+				for(auto& child : static_cast<DirectoryEntry*>(entry)->mChildren)
+					flatten(child);
+			}
 
-							if (FileSystem::isFile(metaPath))
-							{
-								FileDecoder fs(metaPath);
-								SPtr<IReflectable> loadedMeta = fs.decode();
+			subtreeEnds[idx] = (UINT32)entries.size();
+		};
 
-								if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
-								{
-									SPtr<ProjectFileMeta> fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
-									resEntry->meta = fileMeta;
-								}
-							}
-						}
+		for(auto& child : mRootEntry->mChildren)
+			flatten(child);
 
-						if (resEntry->meta != nullptr)
-						{
-							auto& resourceMetas = resEntry->meta->getResourceMetaData();
+		const UINT32 numEntries = (UINT32)entries.size();
+		Vector<LoadEntryState> states(numEntries, LoadEntryState::Valid);
 
-							if (resourceMetas.size() > 0)
-							{
-								mUUIDToPath[resourceMetas[0]->getUUID()] = resEntry->path;
+		Vector<SPtr<Task>> tasks;
+		for(UINT32 start = 0; start < numEntries; start += LOAD_BATCH_SIZE)
+		{
+			const UINT32 end = std::min(start + LOAD_BATCH_SIZE, numEntries);
 
-								for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
-								{
-									SPtr<ProjectResourceMeta> entry = resourceMetas[i];
-									mUUIDToPath[entry->getUUID()] = resEntry->path + entry->getUniqueName();
-								}
-							}
-						}
+			SPtr<Task> task = Task::create("ProjectLibraryLoad", 
+				[this, &entries, &states, start, end]() { checkEntries(entries, start, end, states); });
 
-						addDependencies(resEntry);
-					}
-					else
-						deletedEntries.push_back(resEntry);
-				}
-				else if(child->type == LibraryEntryType::Directory)
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for(auto& task : tasks)
+			task->wait();
+
+		// Load the required meta files and register the entries on this thread, in hierarchy order
+		Vector<LibraryEntry*> deletedEntries;
+		for(UINT32 i = 0; i < numEntries;)
+		{
+			LibraryEntry* entry = entries[i];
+			if(states[i] == LoadEntryState::Deleted)
+			{
+				// Deleting an entry deletes its children as well, so they are skipped
+				deletedEntries.push_back(entry);
+				i = subtreeEnds[i];
+				continue;
+			}
+
+			if(entry->type == LibraryEntryType::File)
+			{
+				FileEntry* fileEntry = static_cast<FileEntry*>(entry);
+				if(states[i] == LoadEntryState::LoadMeta)
 				{
-					if (FileSystem::isDirectory(child->path))
-						todo.push(static_cast<DirectoryEntry*>(child));
+					if(fileEntry->isMetaPending())
+						fileEntry->getMeta();
 					else
-						deletedEntries.push_back(child);
+					{
+						FileDecoder fs(getMetaPath(fileEntry->path));
+						SPtr<IReflectable> loadedMeta = fs.decode();
+
+						if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+							fileEntry->setMeta(std::static_pointer_cast<ProjectFileMeta>(loadedMeta));
+					}
 				}
+
+				registerResourcePaths(fileEntry);
+				addDependencies(fileEntry);
 			}
+
+			i++;
 		}
 
 		// Remove entries that no longer have corresponding files
@@ -1727,6 +1862,81 @@ namespace bs
 		mIsLoaded = true;
 	}
 
+	void ProjectLibrary::checkEntries(const Vector<LibraryEntry*>& entries, UINT32 start, UINT32 end, 
+		Vector<LoadEntryState>& states) const
+	{
+		for(UINT32 i = start; i < end; i++)
+		{
+			const LibraryEntry* entry = entries[i];
+			if(entry->type == LibraryEntryType::Directory)
+			{
+				if (!FileSystem::isDirectory(entry->path))
+					states[i] = LoadEntryState::Deleted;
+
+				continue;
+			}
+
+			const FileEntry* fileEntry = static_cast<const FileEntry*>(entry);
+			if (!FileSystem::isFile(fileEntry->path))
+			{
+				states[i] = LoadEntryState::Deleted;
+				continue;
+			}
+
+			// Index is stale if the meta file was modified after it was written (e.g. by version control)
+			if (fileEntry->isMetaPending())
+			{
+				const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(fileEntry->mIndexRecord);
+
+				Path metaPath = getMetaPath(fileEntry->path);
+				bool hasMeta = FileSystem::isFile(metaPath);
+				UINT64 metaStamp = hasMeta ? (UINT64)FileSystem::getLastModifiedTime(metaPath) : 0;
+
+				if (hasMeta != ((record.flags & ProjectLibraryIndex::EF_HasMeta) != 0) || 
+					metaStamp != record.metaStamp)
+				{
+					states[i] = LoadEntryState::LoadMeta;
+				}
+			}
+			else if (fileEntry->mMeta == nullptr && FileSystem::isFile(getMetaPath(fileEntry->path)))
+				states[i] = LoadEntryState::LoadMeta;
+		}
+	}
+
+	void ProjectLibrary::registerResourcePaths(const FileEntry* entry)
+	{
+		if (entry->isMetaPending())
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(entry->mIndexRecord);
+			for (UINT32 i = 0; i < record.numResources; i++)
+			{
+				const ProjectLibraryIndex::ResourceRecord& resource = mIndex->getResource(record.firstResource + i);
+
+				if (i == 0)
+					mUUIDToPath[resource.uuid] = entry->path;
+				else
+					mUUIDToPath[resource.uuid] = entry->path + String(mIndex->getString(resource.name));
+			}
+
+			return;
+		}
+
+		if (entry->getMeta() == nullptr)
+			return;
+
+		auto& resourceMetas = entry->getMeta()->getResourceMetaData();
+		if (resourceMetas.empty())
+			return;
+
+		mUUIDToPath[resourceMetas[0]->getUUID()] = entry->path;
+
+		for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
+		{
+			const SPtr<ProjectResourceMeta>& resMeta = resourceMetas[i];
+			mUUIDToPath[resMeta->getUUID()] = entry->path + resMeta->getUniqueName();
+		}
+	}
+
 	void ProjectLibrary::clearEntries()
 	{
 		if (mRootEntry == nullptr)
@@ -1752,14 +1962,189 @@ namespace bs
 		mRootEntry = nullptr;
 	}
 
+	void ProjectLibrary::saveIndex(const Path& indexPath)
+	{
+		ProjectLibraryIndexWriter writer;
+
+		std::function<void(LibraryEntry*, UINT32)> addEntry =
+			[&](LibraryEntry* entry, UINT32 parentIdx)
+		{
+			if (entry->type == LibraryEntryType::Directory)
+			{
+				DirectoryEntry* dirEntry = static_cast<DirectoryEntry*>(entry);
+				UINT32 idx = writer.addEntry(parentIdx, ProjectLibraryIndex::EF_Directory, dirEntry->path.toString(),
+					dirEntry->elementName, 0, 0);
+
+				for (auto& child : dirEntry->mChildren)
+					addEntry(child, idx);
+
+				return;
+			}
+
+			FileEntry* fileEntry = static_cast<FileEntry*>(entry);
+
+			// Meta file was never loaded, so it cannot have changed since the previous index was written
+			if (fileEntry->isMetaPending())
+			{
+				const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(fileEntry->mIndexRecord);
+				writer.addEntry(parentIdx, record.flags, fileEntry->path.toString(), fileEntry->elementName,
+					(UINT64)fileEntry->lastUpdateTime, record.metaStamp);
+
+				for (UINT32 i = 0; i < record.numResources; i++)
+				{
+					const ProjectLibraryIndex::ResourceRecord& resource = mIndex->getResource(record.firstResource + i);
+					writer.addResource(resource.uuid, resource.typeId, mIndex->getString(resource.name));
+				}
+
+				for (UINT32 i = 0; i < record.numDependencies; i++)
+					writer.addDependency(mIndex->getDependency(record.firstDependency + i));
+
+				return;
+			}
+
+			UINT32 flags = 0;
+			UINT64 metaStamp = 0;
+
+			const SPtr<ProjectFileMeta>& meta = fileEntry->getMeta();
+			if (meta != nullptr)
+			{
+				flags |= ProjectLibraryIndex::EF_HasMeta;
+
+				if (meta->getIncludeInBuild())
+					flags |= ProjectLibraryIndex::EF_IncludeInBuild;
+
+				// Entry paths are relative at this point
+				Path metaPath = fileEntry->path;
+				metaPath.makeAbsolute(mResourcesFolder);
+				metaPath = getMetaPath(metaPath);
+
+				if (FileSystem::isFile(metaPath))
+					metaStamp = (UINT64)FileSystem::getLastModifiedTime(metaPath);
+			}
+
+			writer.addEntry(parentIdx, flags, fileEntry->path.toString(), fileEntry->elementName,
+				(UINT64)fileEntry->lastUpdateTime, metaStamp);
+
+			if (meta != nullptr)
+			{
+				auto& resourceMetas = meta->getResourceMetaData();
+				for (auto& resMeta : resourceMetas)
+					writer.addResource(resMeta->getUUID(), resMeta->getTypeID(), resMeta->getUniqueName());
+			}
+
+			Vector<Path> dependencies = getImportDependencies(fileEntry);
+			for (auto& dependency : dependencies)
+				writer.addDependency(dependency.toString());
+		};
+
+		addEntry(mRootEntry, 0);
+		writer.save(indexPath);
+	}
+
+	bool ProjectLibrary::loadIndex(const Path& indexPath)
+	{
+		mIndex = ProjectLibraryIndex::load(indexPath);
+		if (mIndex == nullptr)
+			return false;
+
+		// Records are stored parents first, so the hierarchy can be built in a single pass
+		const UINT32 numEntries = mIndex->getNumEntries();
+		Vector<LibraryEntry*> entries(numEntries, nullptr);
+
+		const ProjectLibraryIndex::EntryRecord& rootRecord = mIndex->getEntry(0);
+		mRootEntry->path = Path(mIndex->getString(rootRecord.path));
+		mRootEntry->elementName = mIndex->getString(rootRecord.name);
+		entries[0] = mRootEntry;
+
+		for (UINT32 i = 1; i < numEntries; i++)
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(i);
+			DirectoryEntry* parent = static_cast<DirectoryEntry*>(entries[record.parent]);
+
+			Path path(mIndex->getString(record.path));
+			String name = mIndex->getString(record.name);
+
+			LibraryEntry* entry;
+			if ((record.flags & ProjectLibraryIndex::EF_Directory) != 0)
+				entry = bs_new<DirectoryEntry>(path, name, parent);
+			else
+			{
+				FileEntry* fileEntry = bs_new<FileEntry>(path, name, parent);
+				fileEntry->lastUpdateTime = (std::time_t)record.lastUpdateTime;
+				fileEntry->mIndexRecord = i;
+
+				entry = fileEntry;
+			}
+
+			parent->mChildren.push_back(entry);
+			entries[i] = entry;
+		}
+
+		return true;
+	}
+
+	bool ProjectLibrary::hasResourceOfType(const FileEntry* entry, const Vector<UINT32>& typeIds) const
+	{
+		if (entry->isMetaPending())
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(entry->mIndexRecord);
+			for (UINT32 i = 0; i < record.numResources; i++)
+			{
+				const UINT32 resTypeId = mIndex->getResource(record.firstResource + i).typeId;
+				for (auto& typeId : typeIds)
+				{
+					if (resTypeId == typeId)
+						return true;
+				}
+			}
+
+			return false;
+		}
+
+		if (entry->getMeta() == nullptr)
+			return false;
+
+		auto& resourceMetas = entry->getMeta()->getResourceMetaData();
+		for (auto& resMeta : resourceMetas)
+		{
+			for (auto& typeId : typeIds)
+			{
+				if (resMeta->getTypeID() == typeId)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool ProjectLibrary::isIncludedInBuild(const FileEntry* entry) const
+	{
+		if (entry->isMetaPending())
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(entry->mIndexRecord);
+			return (record.flags & ProjectLibraryIndex::EF_IncludeInBuild) != 0;
+		}
+
+		return entry->getMeta() != nullptr && entry->getMeta()->getIncludeInBuild();
+	}
+
 	Vector<Path> ProjectLibrary::getImportDependencies(const FileEntry* entry)
 	{
 		Vector<Path> output;
 
-		if (entry->meta == nullptr)
+		if (entry->isMetaPending())
+		{
+			const ProjectLibraryIndex::EntryRecord& record = mIndex->getEntry(entry->mIndexRecord);
+			for (UINT32 i = 0; i < record.numDependencies; i++)
+				output.push_back(Path(mIndex->getDependency(record.firstDependency + i)));
+
+			return output;
+		}
+
+		if (entry->getMeta() == nullptr)
 			return output;
 
-		auto& resourceMetas = entry->meta->getResourceMetaData();
+		auto& resourceMetas = entry->getMeta()->getResourceMetaData();
 		for(auto& resMeta : resourceMetas)
 		{
 			if (resMeta->getTypeID() == TID_Shader)
@@ -1813,8 +2198,8 @@ namespace bs
 				FileEntry* resEntry = static_cast<FileEntry*>(entry);
 
 				SPtr<ImportOptions> importOptions;
-				if (resEntry->meta != nullptr)
-					importOptions = resEntry->meta->getImportOptions();
+				if (resEntry->getMeta() != nullptr)
+					importOptions = resEntry->getMeta()->getImportOptions();
 
 				reimportResourceInternal(resEntry, importOptions, true);
 			}
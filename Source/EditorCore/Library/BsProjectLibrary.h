@@ -50,8 +50,25 @@ namespace bs
 			FileEntry();
 			FileEntry(const Path& path, const String& name, DirectoryEntry* parent);
 
-			SPtr<ProjectFileMeta> meta; /**< Meta file containing various information about the resource(s). */
+			/**
+			 * Returns the meta file containing various information about the resource(s), or null if the file has no
+			 * meta file. If the entry was restored from the library index, the meta file is loaded on first access.
+			 */
+			const SPtr<ProjectFileMeta>& getMeta() const;
+
+			/** Assigns a new meta file to the entry, replacing any meta file that was yet to be loaded. */
+			void setMeta(const SPtr<ProjectFileMeta>& meta);
+
+			/** Checks is the meta file of this entry yet to be loaded from disk. */
+			bool isMetaPending() const { return mIndexRecord != (UINT32)-1; }
+
 			std::time_t lastUpdateTime; /**< Timestamp of when we last imported the resource. */
+
+		private:
+			friend class ProjectLibrary;
+
+			mutable SPtr<ProjectFileMeta> mMeta;
+			mutable UINT32 mIndexRecord = (UINT32)-1; /**< Record in the library index, while the meta file is pending. */
 		};
 
 		/**	A library entry representing a folder that contains other entries. */
@@ -71,11 +88,24 @@ namespace bs
 		 * Checks if any resources at the specified path have been modified, added or deleted, and updates the internal
 		 * hierarchy accordingly. Automatically imports dirty resources.
 		 *
-		 * @param[in]	path	Absolute path of the file or folder to check. If a folder is provided all its children will
-		 *						be checked recursively.
-		 * @return				Returns the number of resources that were queued for import during this call.
+		 * @param[in]	path		Absolute path of the file or folder to check. If a folder is provided all its children
+		 *							will be checked.
+		 * @param[in]	recursive	If true, all children of a folder will be checked recursively. Otherwise only the
+		 *							immediate children are checked, apart from newly added folders which are always
+		 *							checked in full.
+		 * @return					Returns the number of resources that were queued for import during this call.
+		 */
+		UINT32 checkForModifications(const Path& path, bool recursive = true);
+
+		/**
+		 * Queues a modification check for a file or folder, as reported by a file system monitor. The check is delayed
+		 * until no further changes are reported for the path for a short period, so a burst of changes results in a 
+		 * single check. Folders are not checked recursively, as the monitor is expected to report changes to their
+		 * children separately. If too many paths are queued at once, the entire library is checked instead.
+		 *
+		 * @param[in]	path	Absolute path of the file or folder that was added, removed or modified.
 		 */
-		UINT32 checkForModifications(const Path& path);
+		void queueModification(const Path& path);
 
 		/**	Returns the root library entry that references the entire library hierarchy. */
 		const LibraryEntry* getRootEntry() const { return mRootEntry; }
@@ -266,6 +296,15 @@ namespace bs
 		 */
 		void _finishQueuedImports(bool wait = false);
 
+		/**
+		 * Performs modification checks for paths queued with queueModification(), once no changes have been reported 
+		 * for them for a short period. This should be called on a regular basis (e.g. every frame).
+		 *
+		 * @param[in]	force	If true all queued paths are checked immediately, regardless of when they were queued.
+		 * @return				Returns the number of resources that were queued for import during this call.
+		 */
+		UINT32 _processQueuedModifications(bool force = false);
+
 		/** @} */
 
 		static const Path RESOURCES_DIR;
@@ -283,6 +322,14 @@ namespace bs
 			UUID uuid;
 		};
 
+		/** Result of checking a single library entry against the file system, when loading the library. */
+		enum class LoadEntryState : UINT8
+		{
+			Valid, /**< Entry exists and is up to date. */
+			Deleted, /**< File or folder of the entry no longer exists. */
+			LoadMeta /**< Meta file of the entry isn't covered by the library index and must be loaded. */
+		};
+
 		/** Information about an asynchronously queued import. */
 		struct QueuedImport
 		{
@@ -363,9 +410,12 @@ namespace bs
 		 */
 		void createInternalParentHierarchy(const Path& fullPath, DirectoryEntry** newHierarchyRoot, DirectoryEntry** newHierarchyLeaf);
 
-		/**	Checks has a file been modified since the last import. */
+		/**	Checks has a file been modified since the last import. Doesn't load a pending meta file. */
 		bool isUpToDate(FileEntry* file) const;
 
+		/** Checks does the imported version of a resource exist in the internal resources folder. */
+		bool isImported(const UUID& uuid) const;
+
 		/**	Checks is the resource a native engine resource that doesn't require importing. */
 		bool isNative(const Path& path) const;
 
@@ -407,10 +457,44 @@ namespace bs
 		/** Deletes all library entries. */
 		void clearEntries();
 
+		/** Writes the library index describing the current entry hierarchy. Entries must be relative when called. */
+		void saveIndex(const Path& indexPath);
+
+		/**
+		 * Restores the entry hierarchy from the library index. Meta files of restored entries are left pending, unless the
+		 * index is detected as stale for a particular entry. Returns false if no valid index exists.
+		 */
+		bool loadIndex(const Path& indexPath);
+
+		/**
+		 * Checks which entries in the specified range still exist on disk, and which file entries require their meta
+		 * file to be loaded. Only accesses the file system and doesn't modify the entries, so it is safe to call from
+		 * worker threads as long as the entries aren't modified concurrently.
+		 *
+		 * @param[in]	entries		Flattened list of entries, not including their children.
+		 * @param[in]	start		Index of the first entry to check.
+		 * @param[in]	end			Index one past the last entry to check.
+		 * @param[out]	states		Receives the result for every checked entry, at the same index as the entry. Must be
+		 *							the same size as @p entries, and initialized to LoadEntryState::Valid.
+		 */
+		void checkEntries(const Vector<LibraryEntry*>& entries, UINT32 start, UINT32 end, 
+			Vector<LoadEntryState>& states) const;
+
+		/** Registers paths for all the resources in the provided file, so they can be looked up by UUID. */
+		void registerResourcePaths(const FileEntry* entry);
+
+		/** Checks does the file contain a resource of one of the provided types, without loading a pending meta file. */
+		bool hasResourceOfType(const FileEntry* entry, const Vector<UINT32>& typeIds) const;
+
+		/** Checks is the file always included in the build, without loading a pending meta file. */
+		bool isIncludedInBuild(const FileEntry* entry) const;
+
 		static const char* LIBRARY_ENTRIES_FILENAME;
+		static const char* LIBRARY_INDEX_FILENAME;
 		static const char* RESOURCE_MANIFEST_FILENAME;
 
 		SPtr<ResourceManifest> mResourceManifest;
+		SPtr<ProjectLibraryIndex> mIndex;
 		DirectoryEntry* mRootEntry;
 		Path mProjectFolder;
 		Path mResourcesFolder;
@@ -421,6 +505,14 @@ namespace bs
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
 		UnorderedMap<UUID, Path> mUUIDToPath;
+
+		UnorderedMap<Path, float> mQueuedModifications;
+		float mLastModificationTime = 0.0f;
+		bool mModificationQueueOverflow = false;
+
+		static constexpr float MODIFICATION_DEBOUNCE_INTERVAL = 0.25f;
+		static constexpr UINT32 LOAD_BATCH_SIZE = 512;
+		static constexpr UINT32 MAX_QUEUED_MODIFICATIONS = 4096;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
@@ -0,0 +1,192 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsProjectLibraryIndex.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	static_assert(std::is_trivially_copyable<UUID>::value, "UUID must be trivially copyable in order to be stored in the index.");
+
+	ProjectLibraryIndex::~ProjectLibraryIndex()
+	{
+		if (mData != nullptr)
+			bs_free(mData);
+	}
+
+	SPtr<ProjectLibraryIndex> ProjectLibraryIndex::load(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+			return nullptr;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return nullptr;
+
+		const size_t size = stream->size();
+		if (size < sizeof(Header))
+			return nullptr;
+
+		SPtr<ProjectLibraryIndex> index = bs_shared_ptr_new<ProjectLibraryIndex>();
+		index->mData = (UINT8*)bs_alloc((UINT32)size);
+		index->mSize = size;
+
+		// Read everything in one go, records are used in-place from here on
+		if (stream->read(index->mData, size) != size)
+			return nullptr;
+
+		stream->close();
+
+		index->mHeader = (const Header*)index->mData;
+		if (index->mHeader->magic != MAGIC || index->mHeader->version != VERSION)
+			return nullptr;
+
+		if (!index->mapRecords())
+			return nullptr;
+
+		return index;
+	}
+
+	bool ProjectLibraryIndex::mapRecords()
+	{
+		const UINT64 entriesOffset = sizeof(Header);
+		const UINT64 resourcesOffset = entriesOffset + mHeader->numEntries * (UINT64)sizeof(EntryRecord);
+		const UINT64 dependenciesOffset = resourcesOffset + mHeader->numResources * (UINT64)sizeof(ResourceRecord);
+		const UINT64 stringsOffset = dependenciesOffset + mHeader->numDependencies * (UINT64)sizeof(UINT32);
+
+		if (mHeader->numEntries == 0 || mHeader->stringTableSize == 0)
+			return false;
+
+		if (stringsOffset + mHeader->stringTableSize != mSize)
+			return false;
+
+		mEntries = (const EntryRecord*)(mData + entriesOffset);
+		mResources = (const ResourceRecord*)(mData + resourcesOffset);
+		mDependencies = (const UINT32*)(mData + dependenciesOffset);
+		mStrings = (const char*)(mData + stringsOffset);
+
+		// Last string must be terminated, so any valid offset is guaranteed to yield a terminated string
+		const UINT32 numStringBytes = mHeader->stringTableSize;
+		if (mStrings[numStringBytes - 1] != '\0')
+			return false;
+
+		for (UINT32 i = 0; i < mHeader->numEntries; i++)
+		{
+			const EntryRecord& entry = mEntries[i];
+
+			if (i == 0)
+			{
+				if ((entry.flags & EF_Directory) == 0)
+					return false;
+			}
+			else if (entry.parent >= i || (mEntries[entry.parent].flags & EF_Directory) == 0)
+				return false;
+
+			if (entry.path >= numStringBytes || entry.name >= numStringBytes)
+				return false;
+
+			if ((UINT64)entry.firstResource + entry.numResources > mHeader->numResources)
+				return false;
+
+			if ((UINT64)entry.firstDependency + entry.numDependencies > mHeader->numDependencies)
+				return false;
+		}
+
+		for (UINT32 i = 0; i < mHeader->numResources; i++)
+		{
+			if (mResources[i].name >= numStringBytes)
+				return false;
+		}
+
+		for (UINT32 i = 0; i < mHeader->numDependencies; i++)
+		{
+			if (mDependencies[i] >= numStringBytes)
+				return false;
+		}
+
+		return true;
+	}
+
+	UINT32 ProjectLibraryIndexWriter::addEntry(UINT32 parent, UINT32 flags, const String& path, const String& name,
+		UINT64 lastUpdateTime, UINT64 metaStamp)
+	{
+		const UINT32 idx = (UINT32)mEntries.size();
+		assert(idx == 0 || parent < idx);
+
+		ProjectLibraryIndex::EntryRecord entry;
+		entry.parent = idx == 0 ? 0 : parent;
+		entry.flags = flags;
+		entry.path = addString(path);
+		entry.name = addString(name);
+		entry.lastUpdateTime = lastUpdateTime;
+		entry.metaStamp = metaStamp;
+		entry.firstResource = (UINT32)mResources.size();
+		entry.numResources = 0;
+		entry.firstDependency = (UINT32)mDependencies.size();
+		entry.numDependencies = 0;
+
+		mEntries.push_back(entry);
+		return idx;
+	}
+
+	void ProjectLibraryIndexWriter::addResource(const UUID& uuid, UINT32 typeId, const String& name)
+	{
+		assert(!mEntries.empty());
+
+		ProjectLibraryIndex::ResourceRecord resource;
+		resource.uuid = uuid;
+		resource.typeId = typeId;
+		resource.name = addString(name);
+
+		mResources.push_back(resource);
+		mEntries.back().numResources++;
+	}
+
+	void ProjectLibraryIndexWriter::addDependency(const String& path)
+	{
+		assert(!mEntries.empty());
+
+		mDependencies.push_back(addString(path));
+		mEntries.back().numDependencies++;
+	}
+
+	void ProjectLibraryIndexWriter::save(const Path& path) const
+	{
+		ProjectLibraryIndex::Header header;
+		header.magic = ProjectLibraryIndex::MAGIC;
+		header.version = ProjectLibraryIndex::VERSION;
+		header.numEntries = (UINT32)mEntries.size();
+		header.numResources = (UINT32)mResources.size();
+		header.numDependencies = (UINT32)mDependencies.size();
+		header.stringTableSize = (UINT32)mStrings.size();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+			return;
+
+		stream->write(&header, sizeof(header));
+
+		if (!mEntries.empty())
+			stream->write(mEntries.data(), mEntries.size() * sizeof(ProjectLibraryIndex::EntryRecord));
+
+		if (!mResources.empty())
+			stream->write(mResources.data(), mResources.size() * sizeof(ProjectLibraryIndex::ResourceRecord));
+
+		if (!mDependencies.empty())
+			stream->write(mDependencies.data(), mDependencies.size() * sizeof(UINT32));
+
+		if (!mStrings.empty())
+			stream->write(mStrings.data(), mStrings.size());
+
+		stream->close();
+	}
+
+	UINT32 ProjectLibraryIndexWriter::addString(const String& value)
+	{
+		const UINT32 offset = (UINT32)mStrings.size();
+		mStrings.insert(mStrings.end(), value.begin(), value.end());
+		mStrings.push_back('\0');
+
+		return offset;
+	}
+}
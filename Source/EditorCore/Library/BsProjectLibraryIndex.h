@@ -0,0 +1,153 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Compact binary index of the ProjectLibrary hierarchy. Contains the path, import time and flags of every library
+	 * entry, the UUID, type and name of every resource, and the import dependencies of every file. This allows the
+	 * library to be restored without decoding the individual .meta files (and the preview icons embedded in them), which
+	 * can then be loaded lazily once they are actually needed.
+	 *
+	 * The file consists of a header, followed by arrays of fixed size records, followed by a string table. Records
+	 * reference each other by index and strings by offset, meaning the file contents can be used directly after a
+	 * single read (or memory map), without any per-record decoding.
+	 */
+	class BS_ED_EXPORT ProjectLibraryIndex
+	{
+	public:
+		/** Flags that describe a single entry record. */
+		enum EntryFlags
+		{
+			EF_Directory = 1 << 0, /**< Entry is a directory. */
+			EF_HasMeta = 1 << 1, /**< File entry had a .meta file at the time the index was written. */
+			EF_IncludeInBuild = 1 << 2 /**< Resources in the file are always included in the build. */
+		};
+
+		/** Information about a single file or directory in the library. */
+		struct EntryRecord
+		{
+			UINT32 parent; /**< Index of the parent directory record. Root entry has no parent and references itself. */
+			UINT32 flags; /**< Combination of EntryFlags. */
+			UINT32 path; /**< Path relative to the resources folder, as an offset in the string table. */
+			UINT32 name; /**< Element name, as an offset in the string table. */
+			UINT64 lastUpdateTime; /**< Time at which the file was last imported. */
+			UINT64 metaStamp; /**< Modification time of the .meta file, used for detecting stale records. */
+			UINT32 firstResource; /**< Index of the first resource record belonging to the file. */
+			UINT32 numResources; /**< Number of resource records belonging to the file. */
+			UINT32 firstDependency; /**< Index of the first import dependency of the file. */
+			UINT32 numDependencies; /**< Number of import dependencies of the file. */
+		};
+
+		/** Information about a single resource contained in a file. First resource in a file is the primary resource. */
+		struct ResourceRecord
+		{
+			UUID uuid; /**< Unique identifier of the resource. */
+			UINT32 typeId; /**< RTTI type ID of the resource. */
+			UINT32 name; /**< Unique name of the resource within its file, as an offset in the string table. */
+		};
+
+		ProjectLibraryIndex() = default;
+		~ProjectLibraryIndex();
+
+		/** Returns the number of file and directory entries in the index. Entry with index 0 is the root directory. */
+		UINT32 getNumEntries() const { return mHeader->numEntries; }
+
+		/** Returns an entry record. Parent records are guaranteed to be stored before their children. */
+		const EntryRecord& getEntry(UINT32 idx) const { return mEntries[idx]; }
+
+		/** Returns a resource record, as referenced by EntryRecord::firstResource. */
+		const ResourceRecord& getResource(UINT32 idx) const { return mResources[idx]; }
+
+		/** Returns a path of an import dependency, as referenced by EntryRecord::firstDependency. */
+		const char* getDependency(UINT32 idx) const { return getString(mDependencies[idx]); }
+
+		/** Returns a null-terminated string at the specified offset in the string table. */
+		const char* getString(UINT32 offset) const { return mStrings + offset; }
+
+		/**
+		 * Loads the index from the provided location. Returns null if the file doesn't exist, was written by a different
+		 * version, or is malformed.
+		 */
+		static SPtr<ProjectLibraryIndex> load(const Path& path);
+
+	private:
+		friend class ProjectLibraryIndexWriter;
+
+		/** Header at the start of the index file. */
+		struct Header
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numEntries;
+			UINT32 numResources;
+			UINT32 numDependencies;
+			UINT32 stringTableSize;
+		};
+
+		/**
+		 * Sets up the record arrays over the loaded data, and checks that all record indices and string offsets fall
+		 * within it. Returns false if the data is malformed.
+		 */
+		bool mapRecords();
+
+		static constexpr UINT32 MAGIC = 0x494C5342; // "BSLI"
+		static constexpr UINT32 VERSION = 1;
+
+		UINT8* mData = nullptr;
+		UINT64 mSize = 0;
+
+		const Header* mHeader = nullptr;
+		const EntryRecord* mEntries = nullptr;
+		const ResourceRecord* mResources = nullptr;
+		const UINT32* mDependencies = nullptr;
+		const char* mStrings = nullptr;
+	};
+
+	/** Builds a ProjectLibraryIndex and writes it to disk. */
+	class BS_ED_EXPORT ProjectLibraryIndexWriter
+	{
+	public:
+		/**
+		 * Adds a new entry record. Entries must be added parents first, starting with the root directory.
+		 *
+		 * @param[in]	parent			Index of the parent entry, as returned by a previous call to this method. Ignored
+		 *								for the root entry.
+		 * @param[in]	flags			Combination of ProjectLibraryIndex::EntryFlags.
+		 * @param[in]	path			Path to the entry, relative to the resources folder.
+		 * @param[in]	name			Name of the entry.
+		 * @param[in]	lastUpdateTime	Time at which the file was last imported.
+		 * @param[in]	metaStamp		Modification time of the .meta file.
+		 * @return						Index of the new entry.
+		 */
+		UINT32 addEntry(UINT32 parent, UINT32 flags, const String& path, const String& name, UINT64 lastUpdateTime,
+			UINT64 metaStamp);
+
+		/** Adds a resource record to the most recently added entry. */
+		void addResource(const UUID& uuid, UINT32 typeId, const String& name);
+
+		/** Adds an import dependency to the most recently added entry. */
+		void addDependency(const String& path);
+
+		/** Writes the index to the provided location, overwriting any existing file. */
+		void save(const Path& path) const;
+
+	private:
+		/** Appends a string to the string table and returns its offset. */
+		UINT32 addString(const String& value);
+
+		Vector<ProjectLibraryIndex::EntryRecord> mEntries;
+		Vector<ProjectLibraryIndex::ResourceRecord> mResources;
+		Vector<UINT32> mDependencies;
+		Vector<char> mStrings;
+	};
+
+	/** @} */
+}
@@ -26,10 +26,35 @@ namespace bs
 		/** Called once per frame. Updates the overlay depending on current selection. */
 		void update(const SPtr<Camera>& camera);
 
+		/**
+		 * Notifies the renderer that scene objects or components might have been added to or moved within the scene
+		 * hierarchy, outside of the undo/redo system. The list of selected renderables will be rebuilt on next update().
+		 */
+		void notifyHierarchyModified() { mCacheDirty = true; }
+
 	private:
 		friend class ct::SelectionRendererCore;
 
+		/** 
+		 * Rebuilds the list of renderables attached to the currently selected scene objects and their children. Each 
+		 * scene object is visited only once, even if both it and one of its ancestors are selected.
+		 */
+		void updateCachedRenderables();
+
+		/** Triggered when the scene object or resource selection changes. */
+		void onSelectionChanged(const Vector<HSceneObject>& sceneObjects, const Vector<Path>& resourcePaths);
+
+		/** Triggered when any game object is destroyed. */
+		void onGameObjectDestroyed(const HGameObject& go);
+
 		SPtr<ct::SelectionRendererCore> mRenderer;
+
+		Vector<HRenderable> mCachedRenderables;
+		UnorderedSet<UINT64> mCachedInstanceIds;
+		bool mCacheDirty = true;
+		HEvent mSelectionChangedConn;
+		HEvent mUndoRedoModifiedConn;
+		HEvent mGameObjectDestroyedConn;
 	};
 
 	namespace ct
@@ -18,6 +18,8 @@
 #include "Scene/BsSceneManager.h"
 #include "Renderer/BsRendererUtility.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "Scene/BsGameObjectManager.h"
+#include "UndoRedo/BsUndoRedo.h"
 
 using namespace std::placeholders;
 
@@ -28,33 +30,100 @@ namespace bs
 		HMaterial selectionMat = BuiltinEditorResources::instance().createSelectionMat();
 			
 		mRenderer = RendererExtension::create<ct::SelectionRendererCore>(selectionMat->getCore());
+
+		mSelectionChangedConn = Selection::instance().onSelectionChanged.connect(
+			std::bind(&SelectionRenderer::onSelectionChanged, this, _1, _2));
+
+		// Editor operations that add or move scene objects and components all go through undo/redo commands
+		mUndoRedoModifiedConn = UndoRedo::instance().onModified.connect(
+			std::bind(&SelectionRenderer::notifyHierarchyModified, this));
+
+		mGameObjectDestroyedConn = GameObjectManager::instance().onDestroyed.connect(
+			std::bind(&SelectionRenderer::onGameObjectDestroyed, this, _1));
 	}
 
 	SelectionRenderer::~SelectionRenderer()
-	{ }
+	{
+		mSelectionChangedConn.disconnect();
+		mUndoRedoModifiedConn.disconnect();
+		mGameObjectDestroyedConn.disconnect();
+	}
 
 	void SelectionRenderer::update(const SPtr<Camera>& camera)
 	{
+		if (mCacheDirty)
+			updateCachedRenderables();
+
+		// Activity is checked every frame, as toggling it doesn't invalidate the cache
 		Vector<SPtr<ct::Renderable>> objects;
+		for (auto& renderable : mCachedRenderables)
+		{
+			if (renderable.isDestroyed() || !renderable->SO()->getActive() || !renderable->getMesh().isLoaded())
+				continue;
 
-		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
-		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
+			SPtr<Renderable> internalRenderable = renderable->_getRenderable();
+			if (internalRenderable == nullptr)
+				continue;
+
+			SPtr<ct::Renderable> renderableCore = internalRenderable->getCore();
+			if (renderableCore != nullptr)
+				objects.push_back(renderableCore);
+		}
+
+		ct::SelectionRendererCore* renderer = mRenderer.get();
+		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), objects));
+	}
+
+	void SelectionRenderer::updateCachedRenderables()
+	{
+		mCachedRenderables.clear();
+		mCachedInstanceIds.clear();
 
-		for (auto& renderable : renderables)
+		Stack<HSceneObject> todo;
+		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
+		for (auto& so : sceneObjects)
 		{
-			HSceneObject renderableSO = renderable->SO();
-			for (auto& so : sceneObjects)
+			if (so.isDestroyed())
+				continue;
+
+			todo.push(so);
+			while (!todo.empty())
 			{
-				if (renderableSO != so)
+				HSceneObject curSO = todo.top();
+				todo.pop();
+
+				if (!mCachedInstanceIds.insert(curSO.getInstanceId()).second)
 					continue;
 
-				if (renderable->getMesh().isLoaded())
-					objects.push_back(renderable->_getRenderable()->getCore());
+				const Vector<HComponent>& components = curSO->getComponents();
+				for (auto& component : components)
+				{
+					if (component->isDerivedFrom(CRenderable::getRTTIStatic()))
+					{
+						mCachedRenderables.push_back(static_object_cast<CRenderable>(component));
+						mCachedInstanceIds.insert(component.getInstanceId());
+					}
+				}
+
+				UINT32 numChildren = curSO->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+					todo.push(curSO->getChild(i));
 			}
 		}
 
-		ct::SelectionRendererCore* renderer = mRenderer.get();
-		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), objects));
+		mCacheDirty = false;
+	}
+
+	void SelectionRenderer::onSelectionChanged(const Vector<HSceneObject>& sceneObjects, const Vector<Path>& resourcePaths)
+	{
+		mCacheDirty = true;
+	}
+
+	void SelectionRenderer::onGameObjectDestroyed(const HGameObject& go)
+	{
+		// Only selected scene objects, their descendants and their renderables are of interest
+		if (!mCacheDirty && mCachedInstanceIds.find(go.getInstanceId()) != mCachedInstanceIds.end())
+			mCacheDirty = true;
 	}
 
 	namespace ct
@@ -46,6 +46,7 @@ namespace bs
 	void CmdCloneSO::commit()
 	{
 		mClones.clear();
+		mClones.reserve(mOriginals.size());
 
 		for (auto& original : mOriginals)
 		{
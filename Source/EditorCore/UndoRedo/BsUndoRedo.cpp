@@ -35,6 +35,7 @@ namespace bs
 		mRedoNumElements = std::min(mRedoNumElements + 1, MAX_STACK_ELEMENTS);
 
 		command->revert();
+		onModified();
 	}
 
 	void UndoRedo::redo()
@@ -50,6 +51,7 @@ namespace bs
 		addToUndoStack(command);
 
 		command->commit();
+		onModified();
 	}
 
 	void UndoRedo::pushGroup(const String& name)
@@ -96,6 +98,7 @@ namespace bs
 			existingCommand->onCommandRemoved();
 
 		clearRedoStack();
+		onModified();
 	}
 
 	UINT32 UndoRedo::getTopCommandId() const
@@ -68,6 +68,12 @@ namespace bs
 		/**	Resets the undo/redo stacks. */
 		void clear();
 
+		/**
+		 * Triggered whenever a command is registered, undone or redone. Commands usually modify the scene, so this can be
+		 * used to refresh data derived from it.
+		 */
+		Event<void()> onModified;
+
 	private:
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		SPtr<EditorCommand> removeLastFromUndoStack();
@@ -0,0 +1,191 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsEditorProfiler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	/** Appends a string to a JSON document, escaping any characters that cannot appear in a JSON string as is. */
+	static void appendJSONString(StringStream& stream, const char* value)
+	{
+		stream << '"';
+		for (const char* iter = value; *iter != '\0'; ++iter)
+		{
+			char c = *iter;
+			if (c == '"' || c == '\\')
+				stream << '\\' << c;
+			else if ((unsigned char)c < 0x20)
+				stream << ' ';
+			else
+				stream << c;
+		}
+		stream << '"';
+	}
+
+	/** Appends a complete (begin and end) trace event to a Chrome trace document. */
+	static void appendTraceEvent(StringStream& stream, const char* name, UINT64 start, UINT64 duration, bool first)
+	{
+		if (!first)
+			stream << ",\n";
+
+		stream << "{\"name\":";
+		appendJSONString(stream, name);
+		stream << ",\"cat\":\"editor\",\"ph\":\"X\",\"ts\":" << start << ",\"dur\":" << duration << ",\"pid\":1,\"tid\":1}";
+	}
+
+	EditorProfiler::EditorProfiler()
+	{
+		mActiveSamples.reserve(32);
+	}
+
+	void EditorProfiler::setEnabled(bool enabled)
+	{
+		if (mEnabled == enabled)
+			return;
+
+		mEnabled = enabled;
+
+		mCurrentFrame.samples.clear();
+		mCurrentFrame.start = getTime();
+		mActiveSamples.clear();
+
+		if (enabled)
+		{
+			mNextFrame = 0;
+			mNumFrames = 0;
+		}
+	}
+
+	void EditorProfiler::beginSample(const char* name)
+	{
+		if (!mEnabled)
+			return;
+
+		mActiveSamples.push_back((UINT32)mCurrentFrame.samples.size());
+		mCurrentFrame.samples.push_back({ name, getTime(), 0, (UINT32)mActiveSamples.size() - 1 });
+	}
+
+	void EditorProfiler::beginSample(const String& name)
+	{
+		if (!mEnabled)
+			return;
+
+		// Elements of an unordered set never move, so the name pointer remains valid for the lifetime of the profiler
+		auto iterFind = mNames.insert(name).first;
+		beginSample(iterFind->c_str());
+	}
+
+	void EditorProfiler::endSample()
+	{
+		if (!mEnabled || mActiveSamples.empty())
+			return;
+
+		Sample& sample = mCurrentFrame.samples[mActiveSamples.back()];
+		sample.duration = getTime() - sample.start;
+
+		mActiveSamples.pop_back();
+	}
+
+	void EditorProfiler::endFrame()
+	{
+		if (!mEnabled)
+			return;
+
+		UINT64 time = getTime();
+
+		// Samples aren't allowed to span frames, close any that were left open
+		for (auto& sampleIdx : mActiveSamples)
+		{
+			Sample& sample = mCurrentFrame.samples[sampleIdx];
+			sample.duration = time - sample.start;
+		}
+
+		mActiveSamples.clear();
+
+		Frame& frame = mFrames[mNextFrame];
+		frame.index = mCurrentFrame.index;
+		frame.start = mCurrentFrame.start;
+		frame.duration = time - mCurrentFrame.start;
+
+		// Swap instead of copy, so both the stored and current frame keep their sample allocations
+		std::swap(frame.samples, mCurrentFrame.samples);
+		mCurrentFrame.samples.clear();
+
+		mCurrentFrame.index++;
+		mCurrentFrame.start = time;
+
+		mNextFrame = (mNextFrame + 1) % MAX_FRAMES;
+		mNumFrames = std::min(mNumFrames + 1, MAX_FRAMES);
+
+		if (mCaptureFramesLeft > 0)
+		{
+			mCaptureFramesLeft--;
+
+			if (mCaptureFramesLeft == 0)
+			{
+				saveTrace(mCapturePath, mCaptureFrames);
+				LOGDBG("Editor profiler trace saved to '" + mCapturePath.toString() + "'.");
+
+				setEnabled(mEnabledBeforeCapture);
+			}
+		}
+	}
+
+	const EditorProfiler::Frame& EditorProfiler::getFrame(UINT32 idx) const
+	{
+		assert(idx < mNumFrames);
+
+		return mFrames[(mNextFrame + MAX_FRAMES - 1 - idx) % MAX_FRAMES];
+	}
+
+	void EditorProfiler::saveTrace(const Path& path, UINT32 numFrames) const
+	{
+		if (numFrames == 0 || numFrames > mNumFrames)
+			numFrames = mNumFrames;
+
+		StringStream stream;
+		stream << "{\"traceEvents\":[\n";
+
+		bool first = true;
+		for (UINT32 i = numFrames; i > 0; i--)
+		{
+			const Frame& frame = getFrame(i - 1);
+
+			String frameName = "Frame " + toString(frame.index);
+			appendTraceEvent(stream, frameName.c_str(), frame.start, frame.duration, first);
+			first = false;
+
+			for (auto& sample : frame.samples)
+				appendTraceEvent(stream, sample.name, sample.start, sample.duration, false);
+		}
+
+		stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		String output = stream.str();
+
+		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
+		if (fileStream == nullptr)
+		{
+			LOGERR("Unable to write the editor profiler trace to '" + path.toString() + "'.");
+			return;
+		}
+
+		fileStream->write(output.c_str(), output.size() * sizeof(String::value_type));
+		fileStream->close();
+	}
+
+	void EditorProfiler::captureFrames(const Path& path, UINT32 numFrames)
+	{
+		if (mCaptureFramesLeft == 0)
+			mEnabledBeforeCapture = mEnabled;
+
+		mCapturePath = path;
+		mCaptureFrames = Math::clamp(numFrames, 1U, MAX_FRAMES);
+		mCaptureFramesLeft = mCaptureFrames;
+
+		setEnabled(true);
+	}
+}
\ No newline at end of file
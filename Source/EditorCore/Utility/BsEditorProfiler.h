@@ -0,0 +1,144 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Records CPU time spent in various editor subsystems. Samples are aggregated per frame, and a fixed number of most
+	 * recent frames is kept in a ring buffer. Recorded frames can be inspected directly or exported as a Chrome trace file
+	 * (viewable in chrome://tracing).
+	 *
+	 * Profiler is disabled by default, in which case beginning and ending samples has no effect. Must only be used from
+	 * the main thread.
+	 */
+	class BS_ED_EXPORT EditorProfiler : public Module<EditorProfiler>
+	{
+	public:
+		/** Time spent in a single profiled scope. */
+		struct Sample
+		{
+			const char* name;
+			UINT64 start; /**< Time at which the sample started, in microseconds since the profiler was started. */
+			UINT64 duration; /**< Sample duration in microseconds. */
+			UINT32 depth; /**< Number of samples that were active when this sample started. */
+		};
+
+		/** All samples recorded during a single frame, in the order they were started. */
+		struct Frame
+		{
+			UINT64 index = 0;
+			UINT64 start = 0; /**< Time at which the frame started, in microseconds since the profiler was started. */
+			UINT64 duration = 0; /**< Frame duration in microseconds. */
+			Vector<Sample> samples;
+		};
+
+		/** Maximum number of frames kept by the profiler. */
+		static constexpr UINT32 MAX_FRAMES = 300;
+
+		EditorProfiler();
+
+		/** Enables or disables sample recording. Recorded frames are cleared when the profiler is enabled. */
+		void setEnabled(bool enabled);
+
+		/** Checks is the profiler currently recording samples. */
+		bool isEnabled() const { return mEnabled; }
+
+		/**
+		 * Starts a new sample. Must be followed by a call to endSample(). Samples can be nested.
+		 *
+		 * @param[in]	name	Name of the sample. Must remain valid for the lifetime of the profiler, normally a string
+		 *						literal.
+		 */
+		void beginSample(const char* name);
+
+		/** Same as beginSample(const char*), except the name is copied and can be released after the call. */
+		void beginSample(const String& name);
+
+		/** Ends the most recently started sample. */
+		void endSample();
+
+		/** Ends the current frame and moves its samples into the ring buffer. Called by the editor once per frame. */
+		void endFrame();
+
+		/** Returns the number of frames currently stored in the ring buffer. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/**
+		 * Returns one of the recorded frames.
+		 *
+		 * @param[in]	idx		Index of the frame, with zero being the most recently completed frame. Must be lower than
+		 *						getNumFrames().
+		 */
+		const Frame& getFrame(UINT32 idx) const;
+
+		/**
+		 * Writes the recorded frames into a trace file in Chrome trace event format.
+		 *
+		 * @param[in]	path		Path of the file to write.
+		 * @param[in]	numFrames	Maximum number of most recent frames to write. Zero writes all recorded frames.
+		 */
+		void saveTrace(const Path& path, UINT32 numFrames = 0) const;
+
+		/**
+		 * Enables the profiler, records the provided number of frames and writes them into a trace file. Profiler is
+		 * returned to its previous state once the capture is done.
+		 *
+		 * @param[in]	path		Path of the trace file to write.
+		 * @param[in]	numFrames	Number of frames to capture. Limited to MAX_FRAMES.
+		 */
+		void captureFrames(const Path& path, UINT32 numFrames);
+
+	private:
+		/** Returns the current time in microseconds since the profiler was started. */
+		UINT64 getTime() const { return mTimer.getMicroseconds(); }
+
+		Frame mFrames[MAX_FRAMES];
+		UINT32 mNextFrame = 0;
+		UINT32 mNumFrames = 0;
+
+		Frame mCurrentFrame;
+		Vector<UINT32> mActiveSamples;
+		UnorderedSet<String> mNames;
+		bool mEnabled = false;
+		Timer mTimer;
+
+		Path mCapturePath;
+		UINT32 mCaptureFramesLeft = 0;
+		UINT32 mCaptureFrames = 0;
+		bool mEnabledBeforeCapture = false;
+	};
+
+	/** Records an EditorProfiler sample for the duration of its scope. Does nothing if the profiler is disabled. */
+	class BS_ED_EXPORT EditorProfilerSample
+	{
+	public:
+		EditorProfilerSample(const char* name)
+		{
+			if (EditorProfiler::isStarted() && EditorProfiler::instance().isEnabled())
+			{
+				mProfiler = EditorProfiler::instancePtr();
+				mProfiler->beginSample(name);
+			}
+		}
+
+		~EditorProfilerSample()
+		{
+			if (mProfiler != nullptr)
+				mProfiler->endSample();
+		}
+
+	private:
+		EditorProfiler* mProfiler = nullptr;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace BansheeEditor
     public abstract class GUIListFieldBase
     {
         private const int IndentAmount = 5;
+        private const int RowsPerPage = 50;
 
         protected List<GUIListFieldRow> rows = new List<GUIListFieldRow>();
         protected GUILayoutY guiLayout;
@@ -26,6 +27,8 @@ namespace BansheeEditor
         protected GUILayoutX guiInternalTitleLayout;
         protected GUILayoutY guiContentLayout;
         protected GUIToggle guiFoldout;
+        protected GUILayoutX guiPageLayout;
+        protected GUILabel guiPageLabel;
 
         protected bool isExpanded;
         protected int depth;
@@ -33,6 +36,8 @@ namespace BansheeEditor
 
         private State state;
         private bool isModified;
+        private int page;
+        private int rowsPage = -1;
 
         /// <summary>
         /// Expands or collapses the entries of the dictionary.
@@ -70,6 +75,7 @@ namespace BansheeEditor
 
         /// <summary>
         /// (Re)builds the list GUI elements. Must be called at least once in order for the contents to be populated.
+        /// Only rows for elements on the current page are created, so large lists don't create GUI for every element.
         /// </summary>
         public void BuildGUI()
         {
@@ -77,9 +83,24 @@ namespace BansheeEditor
 
             if (!IsNull())
             {
+                int numElements = GetNumRows();
+                int numPages = MathEx.Max(1, (numElements + RowsPerPage - 1) / RowsPerPage);
+                page = MathEx.Clamp(page, 0, numPages - 1);
+
+                // Rows display their element index, so rebuild them all when switching pages
+                if (page != rowsPage)
+                {
+                    foreach (var row in rows)
+                        row.Destroy();
+
+                    rows.Clear();
+                    rowsPage = page;
+                }
+
                 // Hidden dependency: Initialize must be called after all elements are 
                 // in the dictionary so we do it in two steps
-                int numRows = GetNumRows();
+                int firstRow = page * RowsPerPage;
+                int numRows = MathEx.Min(numElements - firstRow, RowsPerPage);
                 int oldNumRows = rows.Count;
 
                 for (int i = oldNumRows; i < numRows; i++)
@@ -95,10 +116,12 @@ namespace BansheeEditor
                 }
 
                 for (int i = oldNumRows; i < numRows; i++)
-                    rows[i].Initialize(this, guiContentLayout, i, depth + 1);
+                    rows[i].Initialize(this, guiContentLayout, firstRow + i, depth + 1);
 
                 for (int i = 0; i < rows.Count; i++)
-                    rows[i].SetIndex(i);
+                    rows[i].SetIndex(firstRow + i);
+
+                UpdatePageGUI(numElements, numPages);
             }
             else
             {
@@ -106,9 +129,41 @@ namespace BansheeEditor
                     row.Destroy();
 
                 rows.Clear();
+                rowsPage = -1;
             }
         }
 
+        /// <summary>
+        /// Updates the page selection controls displayed below the rows. Controls are hidden if all elements fit on a
+        /// single page.
+        /// </summary>
+        /// <param name="numElements">Total number of elements in the list.</param>
+        /// <param name="numPages">Total number of pages required for displaying all the elements.</param>
+        private void UpdatePageGUI(int numElements, int numPages)
+        {
+            if (guiPageLayout == null)
+                return;
+
+            guiPageLayout.Active = numPages > 1;
+            if (numPages <= 1)
+                return;
+
+            int firstRow = page * RowsPerPage;
+            int lastRow = MathEx.Min(firstRow + RowsPerPage, numElements) - 1;
+
+            guiPageLabel.SetContent(new LocEdString(firstRow + " - " + lastRow + " (" + numElements + ")"));
+        }
+
+        /// <summary>
+        /// Switches to the previous or next page of elements.
+        /// </summary>
+        /// <param name="offset">Number of pages to move by. Negative to move backwards.</param>
+        private void ChangePage(int offset)
+        {
+            page += offset;
+            BuildGUI();
+        }
+
         /// <summary>
         /// Rebuilds the GUI list header if needed.
         /// </summary>
@@ -167,6 +222,22 @@ namespace BansheeEditor
                 GUILayoutY guiIndentLayoutY = guiIndentLayoutX.AddLayoutY();
                 guiIndentLayoutY.AddSpace(IndentAmount);
                 guiContentLayout = guiIndentLayoutY.AddLayoutY();
+
+                guiPageLayout = guiIndentLayoutY.AddLayoutX();
+                guiPageLayout.AddFlexibleSpace();
+
+                GUIButton guiPrevPageBtn = new GUIButton(new LocEdString("<"), GUIOption.FixedWidth(30));
+                guiPrevPageBtn.OnClick += () => ChangePage(-1);
+                guiPageLabel = new GUILabel(new LocEdString(""));
+                GUIButton guiNextPageBtn = new GUIButton(new LocEdString(">"), GUIOption.FixedWidth(30));
+                guiNextPageBtn.OnClick += () => ChangePage(1);
+
+                guiPageLayout.AddElement(guiPrevPageBtn);
+                guiPageLayout.AddElement(guiPageLabel);
+                guiPageLayout.AddElement(guiNextPageBtn);
+                guiPageLayout.AddFlexibleSpace();
+                guiPageLayout.Active = false;
+
                 guiIndentLayoutY.AddSpace(IndentAmount);
                 guiIndentLayoutX.AddSpace(IndentAmount);
                 guiChildLayout.AddSpace(IndentAmount);
@@ -210,6 +281,8 @@ namespace BansheeEditor
                 {
                     guiInternalTitleLayout.Destroy();
                     guiChildLayout.Destroy();
+                    guiPageLayout = null;
+                    guiPageLabel = null;
                     BuildEmptyGUI();
 
                     state = State.Empty;
@@ -227,15 +300,19 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Refreshes contents of all list rows and checks if anything was modified.
+        /// Refreshes contents of all list rows and checks if anything was modified. Rows are not refreshed while the
+        /// list is collapsed, as they cannot be seen or modified.
         /// </summary>
         /// <returns>State representing was anything modified between two last calls to <see cref="Refresh"/>.</returns>
         public virtual InspectableState Refresh()
         {
             InspectableState state = InspectableState.NotModified;
 
-            for (int i = 0; i < rows.Count; i++)
-                state |= rows[i].Refresh();
+            if (isExpanded)
+            {
+                for (int i = 0; i < rows.Count; i++)
+                    state |= rows[i].Refresh();
+            }
 
             if (isModified)
             {
@@ -263,10 +340,14 @@ namespace BansheeEditor
                 guiChildLayout = null;
             }
 
+            guiPageLayout = null;
+            guiPageLabel = null;
+
             for (int i = 0; i < rows.Count; i++)
                 rows[i].Destroy();
 
             rows.Clear();
+            rowsPage = -1;
         }
 
         /// <summary>
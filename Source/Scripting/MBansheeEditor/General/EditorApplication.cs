@@ -119,6 +119,8 @@ namespace BansheeEditor
                     Selection.SceneObject = null;
                 else
                 {
+                    PrefabUtility.FinishUpdatingInstances();
+
                     if (EditorSettings.GetBool(LogWindow.CLEAR_ON_PLAY_KEY, true))
                     {
                         Debug.Clear();
@@ -315,6 +317,7 @@ namespace BansheeEditor
                 monitor.OnAdded += OnAssetModified;
                 monitor.OnRemoved += OnAssetModified;
                 monitor.OnModified += OnAssetModified;
+                monitor.OnRenamed += OnAssetRenamed;
             }
         }
 
@@ -324,7 +327,18 @@ namespace BansheeEditor
         /// <param name="path">Path to the modified file or folder.</param>
         private static void OnAssetModified(string path)
         {
-            ProjectLibrary.Refresh(path);
+            ProjectLibrary.QueueRefresh(path);
+        }
+
+        /// <summary>
+        /// Triggered when the folder monitor detects an asset in the monitored folder was renamed.
+        /// </summary>
+        /// <param name="from">Path to the original file or folder location.</param>
+        /// <param name="to">Path to the new file or folder location.</param>
+        private static void OnAssetRenamed(string from, string to)
+        {
+            ProjectLibrary.QueueRefresh(from);
+            ProjectLibrary.QueueRefresh(to);
         }
 
         /// <summary>
@@ -333,8 +347,17 @@ namespace BansheeEditor
         internal void OnEditorUpdate()
         {
             // Update managers
+            EditorProfiler.BeginSample("ProjectLibrary.Update");
             ProjectLibrary.Update();
+            EditorProfiler.EndSample();
+
+            EditorProfiler.BeginSample("PrefabUtility.Update");
+            PrefabUtility.Update();
+            EditorProfiler.EndSample();
+
+            EditorProfiler.BeginSample("ScriptCodeManager.Update");
             codeManager.Update();
+            EditorProfiler.EndSample();
         }
 
         /// <summary>
@@ -532,6 +555,8 @@ namespace BansheeEditor
         ///                    prefab if it just needs updating. </param>
         internal static void SaveScene(string path)
         {
+            PrefabUtility.FinishUpdatingInstances();
+
             Prefab scene = Internal_SaveScene(path);
             Scene.SetActive(scene);
 
@@ -978,6 +1003,7 @@ namespace BansheeEditor
             monitor.OnAdded += OnAssetModified;
             monitor.OnRemoved += OnAssetModified;
             monitor.OnModified += OnAssetModified;
+            monitor.OnRenamed += OnAssetRenamed;
 
             if (!string.IsNullOrWhiteSpace(ProjectSettings.LastOpenScene))
             {
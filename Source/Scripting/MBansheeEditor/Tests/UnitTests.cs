@@ -776,6 +776,387 @@ namespace BansheeEditor
             */
         }
 
+        /// <summary>
+        /// Tests deep cloning of managed serializable objects.
+        /// </summary>
+        static void UnitTest5_SerializableClone()
+        {
+            UT_DiffObj original = new UT_DiffObj();
+            original.complex = new UT_DiffChildObj();
+            original.arrComplex = new UT_DiffChildObj[1];
+            original.listComplex = new List<UT_DiffChildObj>();
+            original.listComplex.Add(new UT_DiffChildObj());
+            original.dictComplex = new Dictionary<int, UT_DiffChildObj>();
+            original.dictComplex[40] = new UT_DiffChildObj();
+
+            UT_DiffObj clone = (UT_DiffObj)SerializableUtility.Clone(original);
+
+            DebugUnit.Assert(clone != null && clone != original);
+            DebugUnit.Assert(clone.plain1 == original.plain1);
+            DebugUnit.Assert(clone.plain2 == original.plain2);
+            DebugUnit.Assert(clone.complex != original.complex && clone.complex.plain2 == original.complex.plain2);
+
+            DebugUnit.Assert(clone.arrPlain1 != original.arrPlain1);
+            DebugUnit.Assert(clone.arrPlain1.Length == original.arrPlain1.Length);
+            for (int i = 0; i < original.arrPlain1.Length; i++)
+                DebugUnit.Assert(clone.arrPlain1[i] == original.arrPlain1[i]);
+
+            for (int i = 0; i < original.arrPlain2.Length; i++)
+                DebugUnit.Assert(clone.arrPlain2[i] == original.arrPlain2[i]);
+
+            DebugUnit.Assert(clone.arrComplex.Length == 1 && clone.arrComplex[0] == null);
+            DebugUnit.Assert(clone.arrComplex2[0] != original.arrComplex2[0]);
+            DebugUnit.Assert(clone.arrComplex2[0].plain1 == original.arrComplex2[0].plain1);
+            DebugUnit.Assert(clone.arrComplex2[1] == null);
+
+            DebugUnit.Assert(clone.listPlain1 != original.listPlain1);
+            for (int i = 0; i < original.listPlain1.Count; i++)
+                DebugUnit.Assert(clone.listPlain1[i] == original.listPlain1[i]);
+
+            DebugUnit.Assert(clone.listComplex.Count == 1 && clone.listComplex[0] != original.listComplex[0]);
+            DebugUnit.Assert(clone.listComplex2.Count == original.listComplex2.Count);
+
+            DebugUnit.Assert(clone.dictPlain1.Count == original.dictPlain1.Count);
+            foreach (var entry in original.dictPlain2)
+                DebugUnit.Assert(clone.dictPlain2[entry.Key] == entry.Value);
+
+            DebugUnit.Assert(clone.dictComplex[40] != original.dictComplex[40]);
+            DebugUnit.Assert(clone.dictComplex[40].plain1 == original.dictComplex[40].plain1);
+            DebugUnit.Assert(clone.dictComplex2.Count == original.dictComplex2.Count);
+
+            // Modifying the clone must not affect the original
+            clone.arrPlain1[0] = -1;
+            clone.complex.plain1 = -2;
+            DebugUnit.Assert(original.arrPlain1[0] != -1);
+            DebugUnit.Assert(original.complex.plain1 != -2);
+
+            UT1_SerzObj structClone = (UT1_SerzObj)SerializableUtility.Clone(new UT1_SerzObj(7, "seven"));
+            DebugUnit.Assert(structClone.someValue == 7 && structClone.anotherValue == "seven");
+
+            UT_DiffChildObj created = SerializableUtility.Create<UT_DiffChildObj>();
+            DebugUnit.Assert(created != null);
+        }
+
+        /// <summary>
+        /// Tests batched scene object transform methods.
+        /// </summary>
+        static void UnitTest6_BatchedTransforms()
+        {
+            SceneObject parent = new SceneObject("BatchParent");
+            SceneObject child = new SceneObject("BatchChild");
+            child.Parent = parent;
+
+            // Child is listed first, but the parent must still be moved before the child's world position is applied
+            SceneObject[] sceneObjects = { child, parent };
+            SceneObject.SetPositions(sceneObjects, new [] { new Vector3(5.0f, 0.0f, 0.0f), new Vector3(2.0f, 0.0f, 0.0f) });
+
+            DebugUnit.Assert(MathEx.ApproxEquals(parent.Position.x, 2.0f, 0.001f));
+            DebugUnit.Assert(MathEx.ApproxEquals(child.Position.x, 5.0f, 0.001f));
+            DebugUnit.Assert(MathEx.ApproxEquals(child.LocalPosition.x, 3.0f, 0.001f));
+
+            Vector3[] localPositions = new Vector3[2];
+            SceneObject.GetPositions(sceneObjects, localPositions, true);
+            DebugUnit.Assert(MathEx.ApproxEquals(localPositions[0].x, 3.0f, 0.001f));
+            DebugUnit.Assert(MathEx.ApproxEquals(localPositions[1].x, 2.0f, 0.001f));
+
+            SceneObject.SetLocalScales(sceneObjects, new [] { Vector3.One, new Vector3(2.0f, 2.0f, 2.0f) });
+
+            Vector3[] scales = new Vector3[2];
+            SceneObject.GetScales(sceneObjects, scales);
+            DebugUnit.Assert(MathEx.ApproxEquals(scales[0].x, 2.0f, 0.001f));
+
+            Matrix4[] transforms = new Matrix4[2];
+            SceneObject.GetTransforms(sceneObjects, transforms);
+            DebugUnit.Assert(transforms[0] == child.WorldTransform);
+
+            parent.Destroy();
+        }
+
+        /// <summary>
+        /// Tests scene object lookups by name, with and without the name index.
+        /// </summary>
+        static void UnitTest7_SceneNameIndex()
+        {
+            bool wasIndexEnabled = Scene.NameIndexEnabled;
+
+            SceneObject root = new SceneObject("NameIndexRoot");
+            SceneObject child = new SceneObject("NameIndexChild");
+            child.Parent = root;
+            SceneObject grandChild = new SceneObject("NameIndexGrandChild");
+            grandChild.Parent = child;
+
+            for (int i = 0; i < 2; i++)
+            {
+                Scene.NameIndexEnabled = i == 1;
+
+                DebugUnit.Assert(root.FindChild("NameIndexGrandChild") == grandChild);
+                DebugUnit.Assert(root.FindChild("NameIndexGrandChild", false) == null);
+                DebugUnit.Assert(child.FindChild("NameIndexChild") == null);
+                DebugUnit.Assert(root.FindChildrenWithPrefix("NameIndex").Length == 2);
+
+                grandChild.Name = "NameIndexRenamed";
+                DebugUnit.Assert(root.FindChild("NameIndexGrandChild") == null);
+                DebugUnit.Assert(root.FindChildren("NameIndexRenamed").Length == 1);
+                grandChild.Name = "NameIndexGrandChild";
+
+                // Direct children are returned before deeper descendants, regardless of creation order
+                SceneObject sibling = new SceneObject("NameIndexGrandChild");
+                sibling.Parent = root;
+
+                SceneObject[] duplicates = root.FindChildren("NameIndexGrandChild");
+                DebugUnit.Assert(duplicates.Length == 2 && duplicates[0] == sibling && duplicates[1] == grandChild);
+                DebugUnit.Assert(root.FindChild("NameIndexGrandChild") == sibling);
+
+                sibling.Destroy(true);
+            }
+
+            root.Destroy(true);
+            DebugUnit.Assert(Scene.Root.FindChild("NameIndexGrandChild") == null);
+
+            Scene.NameIndexEnabled = wasIndexEnabled;
+        }
+
+        /// <summary>
+        /// Tests keyframe level editing of animation curves.
+        /// </summary>
+        static void UnitTest8_AnimationCurveKeyFrames()
+        {
+            AnimationCurves curves = new AnimationCurves();
+            curves.AddGenericCurve("UT8_Curve", new AnimationCurve(new KeyFrame[]
+            {
+                new KeyFrame { time = 0.0f, value = 0.0f },
+                new KeyFrame { time = 1.0f, value = 1.0f }
+            }));
+
+            int curveIdx = curves.FindCurve(AnimationCurveSet.Generic, "UT8_Curve");
+            DebugUnit.Assert(curveIdx == 0);
+            DebugUnit.Assert(curves.FindCurve(AnimationCurveSet.Position, "UT8_Curve") == -1);
+
+            DebugUnit.Assert(curves.AddKeyFrame(curveIdx, new KeyFrame { time = 0.5f, value = 2.0f }) == 1);
+            DebugUnit.Assert(curves.GetNumKeyFrames(AnimationCurveSet.Generic, curveIdx) == 3);
+
+            // Moving a key past its neighbor keeps the keys sorted
+            DebugUnit.Assert(curves.SetKeyFrame(curveIdx, 1, new KeyFrame { time = 2.0f, value = 3.0f }) == 2);
+
+            KeyFrame[] keyFrames = new KeyFrame[4];
+            DebugUnit.Assert(curves.GetKeyFrames(curveIdx, keyFrames) == 3);
+            DebugUnit.Assert(keyFrames[1].time == 1.0f && keyFrames[2].value == 3.0f);
+
+            DebugUnit.Assert(curves.RemoveKeyFrame(AnimationCurveSet.Generic, curveIdx, 0));
+            DebugUnit.Assert(!curves.RemoveKeyFrame(AnimationCurveSet.Generic, curveIdx, 5));
+            DebugUnit.Assert(curves.Generic[0].curve.KeyFrames.Length == 2);
+
+            // Curves of a clip are shared with it, and can only be modified through the clip
+            AnimationClip clip = new AnimationClip();
+            clip.Curves = curves;
+
+            DebugUnit.Assert(clip.Curves.AddKeyFrame(curveIdx, new KeyFrame { time = 3.0f, value = 4.0f }) == -1);
+
+            clip.EditCurves(x => x.AddKeyFrame(curveIdx, new KeyFrame { time = 3.0f, value = 4.0f }));
+            DebugUnit.Assert(clip.Curves.GetNumKeyFrames(AnimationCurveSet.Generic, curveIdx) == 3);
+            DebugUnit.Assert(curves.GetNumKeyFrames(AnimationCurveSet.Generic, curveIdx) == 2);
+        }
+
+        /// <summary>
+        /// Tests the GPU readback ring. Reads are only submitted to the core thread at the end of the frame, so
+        /// requests remain pending until the core thread queue is explicitly flushed, which stands in for the frame
+        /// ending.
+        /// </summary>
+        static void UnitTest9_TextureReadback()
+        {
+            Texture texture = Texture.Create2D(4, 4, PixelFormat.RGBA8);
+            TextureReadback readback = new TextureReadback(texture, 0, 0, 2);
+
+            DebugUnit.Assert(readback.ResultSize == 4 * 4 * 4);
+            DebugUnit.Assert(!readback.IsResultAvailable);
+            DebugUnit.Assert(!readback.TryGetResult(new byte[readback.ResultSize]));
+
+            // Requests beyond the number of frames in flight are rejected instead of allocating new buffers
+            DebugUnit.Assert(readback.Request());
+            DebugUnit.Assert(readback.Request());
+            DebugUnit.Assert(!readback.Request());
+            DebugUnit.Assert(readback.NumPending == 2);
+
+            TextureReadback invalidReadback = new TextureReadback(texture, 0, 5);
+            DebugUnit.Assert(invalidReadback.ResultSize == 0);
+            DebugUnit.Assert(!invalidReadback.Request());
+
+            // Over multiple frames, only the most recent completed read is returned and it supersedes the older ones
+            Internal_UT9_SubmitCoreThread();
+            DebugUnit.Assert(readback.NumPending == 0);
+
+            byte[] result = new byte[readback.ResultSize];
+            DebugUnit.Assert(readback.TryGetResult(result));
+            DebugUnit.Assert(!readback.IsResultAvailable);
+
+            Color[] colors = new Color[4 * 4];
+            Color[] frameColors = { Color.Red, Color.Blue };
+            for (int i = 0; i < frameColors.Length; i++)
+            {
+                for (int j = 0; j < colors.Length; j++)
+                    colors[j] = frameColors[i];
+
+                texture.SetPixels(colors);
+                DebugUnit.Assert(readback.Request());
+            }
+
+            Internal_UT9_SubmitCoreThread();
+            DebugUnit.Assert(readback.NumPending == 0 && readback.IsResultAvailable);
+
+            DebugUnit.Assert(readback.TryGetResult(result));
+            for (int i = 0; i < result.Length; i += 4)
+            {
+                DebugUnit.Assert(result[i + 0] == 0 && result[i + 1] == 0);
+                DebugUnit.Assert(result[i + 2] == 255 && result[i + 3] == 255);
+            }
+
+            DebugUnit.Assert(!readback.IsResultAvailable);
+            DebugUnit.Assert(!readback.TryGetResult(result));
+
+            // Retrieved slots are reused by later requests
+            DebugUnit.Assert(readback.Request());
+            DebugUnit.Assert(readback.Request());
+            Internal_UT9_SubmitCoreThread();
+
+            DebugUnit.Assert(readback.TryGetResult(result));
+            DebugUnit.Assert(result[2] == 255);
+        }
+
+        /// <summary>
+        /// Tests recycling of prefab instances through a prefab pool.
+        /// </summary>
+        static void UnitTest10_PrefabPool()
+        {
+            SceneObject root = new SceneObject("UT10_Root");
+            SceneObject child = new SceneObject("UT10_Child");
+            child.Parent = root;
+
+            Prefab prefab = new Prefab(root, false);
+            PrefabPool pool = new PrefabPool(prefab, 1);
+
+            int numSpawned = 0;
+            int numReleased = 0;
+            pool.OnSpawn += x => numSpawned++;
+            pool.OnRelease += x => numReleased++;
+
+            SceneObject first = pool.Spawn();
+            SceneObject second = pool.Spawn();
+            DebugUnit.Assert(first != null && second != null && first != second);
+            DebugUnit.Assert(first.FindChild("UT10_Child", false) != null);
+
+            // Released instances are handed out again, with the same managed object
+            DebugUnit.Assert(pool.Release(first));
+            DebugUnit.Assert(!first.Active);
+            DebugUnit.Assert(!pool.Release(first));
+            DebugUnit.Assert(!pool.Release(root));
+
+            SceneObject third = pool.Spawn();
+            DebugUnit.Assert(third == first && third.Active);
+
+            // Pool only keeps a single free instance, the second release destroys its instance
+            DebugUnit.Assert(pool.Release(second));
+            DebugUnit.Assert(pool.Release(third));
+
+            PrefabPoolStats stats = pool.Stats;
+            DebugUnit.Assert(stats.NumCreated == 2 && stats.NumReused == 1 && stats.NumReleased == 3);
+            DebugUnit.Assert(stats.NumDiscarded == 1 && stats.NumActive == 0 && stats.NumFree == 1);
+            DebugUnit.Assert(numSpawned == 3 && numReleased == 3);
+
+            pool.Clear();
+            DebugUnit.Assert(pool.Stats.NumFree == 0);
+
+            root.Destroy();
+        }
+
+        /// <summary>
+        /// Tests releasing and recreating of managed objects wrapping built-in components.
+        /// </summary>
+        static void UnitTest11_ComponentWrappers()
+        {
+            SceneObject so = new SceneObject("UT11_Object");
+            WeakReference original = UT11_AddRenderable(so);
+
+            // Idle wrappers are still returned while managed code references them
+            UT11_CheckReacquire(so, original);
+
+            // Once collected, a new wrapper is created for the same component
+            Internal_UT11_ReleaseComponentWrappers();
+            for (int i = 0; i < 10 && original.IsAlive; i++)
+            {
+                GC.Collect();
+                GC.WaitForPendingFinalizers();
+            }
+
+            DebugUnit.Assert(!original.IsAlive);
+
+            ComponentWrapperStats before = UT11_GetRenderableStats();
+            Renderable recreated = so.GetComponent<Renderable>();
+            ComponentWrapperStats after = UT11_GetRenderableStats();
+
+            DebugUnit.Assert(recreated != null && recreated.SceneObject == so);
+            DebugUnit.Assert(!ReferenceEquals(recreated, original.Target));
+
+            // A new wrapper adds a referenced one, while a reacquired wrapper would also leave the idle ones
+            DebugUnit.Assert(after.NumReferenced == before.NumReferenced + 1 && after.NumIdle == before.NumIdle);
+
+            so.Destroy();
+        }
+
+        /// <summary>
+        /// Adds a renderable to the scene object and returns a weak reference to its managed object. Done in a separate
+        /// method so no strong reference to the managed object is left on the caller's stack.
+        /// </summary>
+        /// <param name="so">Scene object to add the renderable to.</param>
+        /// <returns>Weak reference to the managed object of the new renderable.</returns>
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static WeakReference UT11_AddRenderable(SceneObject so)
+        {
+            Renderable renderable = so.AddComponent<Renderable>();
+            DebugUnit.Assert(UT11_GetRenderableStats().NumReferenced > 0);
+
+            return new WeakReference(renderable);
+        }
+
+        /// <summary>
+        /// Releases all component wrappers and checks that a wrapper still referenced from managed code is returned
+        /// again, instead of a new one. Done in a separate method so no strong reference to the managed object is left
+        /// on the caller's stack.
+        /// </summary>
+        /// <param name="so">Scene object containing the renderable.</param>
+        /// <param name="original">Weak reference to the original managed object of the renderable.</param>
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static void UT11_CheckReacquire(SceneObject so, WeakReference original)
+        {
+            Renderable renderable = (Renderable)original.Target;
+            DebugUnit.Assert(renderable != null);
+
+            Internal_UT11_ReleaseComponentWrappers();
+
+            ComponentWrapperStats before = UT11_GetRenderableStats();
+            DebugUnit.Assert(before.NumReferenced == 0 && before.NumIdle > 0);
+
+            DebugUnit.Assert(ReferenceEquals(so.GetComponent<Renderable>(), renderable));
+
+            ComponentWrapperStats after = UT11_GetRenderableStats();
+            DebugUnit.Assert(after.NumReferenced == 1 && after.NumIdle == before.NumIdle - 1);
+        }
+
+        /// <summary>
+        /// Returns wrapper statistics for the <see cref="Renderable"/> component type.
+        /// </summary>
+        /// <returns>Wrapper statistics, or empty statistics if no wrappers exist.</returns>
+        private static ComponentWrapperStats UT11_GetRenderableStats()
+        {
+            string typeName = typeof(Renderable).FullName;
+            foreach (var entry in ComponentWrappers.GetStats())
+            {
+                if (entry.TypeName == typeName)
+                    return entry;
+            }
+
+            return new ComponentWrapperStats();
+        }
+
         /// <summary>
         /// Runs all tests.
         /// </summary>
@@ -785,6 +1166,13 @@ namespace BansheeEditor
             UnitTest2_SerializableProperties();
             UnitTest3_ManagedDiff();
             UnitTest4_Prefabs();
+            UnitTest5_SerializableClone();
+            UnitTest6_BatchedTransforms();
+            UnitTest7_SceneNameIndex();
+            UnitTest8_AnimationCurveKeyFrames();
+            UnitTest9_TextureReadback();
+            UnitTest10_PrefabPool();
+            UnitTest11_ComponentWrappers();
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -795,6 +1183,12 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_UT3_ApplyDiff(UT_DiffObj obj);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT9_SubmitCoreThread();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT11_ReleaseComponentWrappers();
     }
 
     /** @} */
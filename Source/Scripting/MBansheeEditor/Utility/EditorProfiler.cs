@@ -0,0 +1,166 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+using BansheeEngine;
+
+namespace BansheeEditor
+{
+    /** @addtogroup Utility-Editor
+     *  @{
+     */
+
+    /// <summary>
+    /// Records CPU time spent in various editor subsystems. Samples are aggregated per frame and a fixed number of most
+    /// recent frames is kept. Recorded frames can be exported as a Chrome trace file (viewable in chrome://tracing).
+    /// Profiler is disabled by default, in which case beginning and ending samples has no effect.
+    /// </summary>
+    public static class EditorProfiler
+    {
+        /// <summary>
+        /// Determines is the profiler recording samples. Recorded frames are cleared when the profiler is enabled.
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return Internal_IsEnabled(); }
+            set { Internal_SetEnabled(value); }
+        }
+
+        /// <summary>
+        /// Number of frames currently recorded by the profiler.
+        /// </summary>
+        public static int NumFrames
+        {
+            get { return (int)Internal_GetNumFrames(); }
+        }
+
+        /// <summary>
+        /// Starts a new sample. Must be followed by a call to <see cref="EndSample"/>. Samples can be nested.
+        /// </summary>
+        /// <param name="name">Name of the sample.</param>
+        public static void BeginSample(string name)
+        {
+            Internal_BeginSample(name);
+        }
+
+        /// <summary>
+        /// Ends the most recently started sample.
+        /// </summary>
+        public static void EndSample()
+        {
+            Internal_EndSample();
+        }
+
+        /// <summary>
+        /// Returns one of the recorded frames.
+        /// </summary>
+        /// <param name="idx">Index of the frame, with zero being the most recently completed frame.</param>
+        /// <returns>Recorded frame, or an empty frame if the index is out of range.</returns>
+        public static ProfilerFrame GetFrame(int idx)
+        {
+            string[] names;
+            ulong[] durations;
+            uint[] depths;
+            ulong frameDuration = Internal_GetFrame((uint)idx, out names, out durations, out depths);
+
+            ProfilerFrame frame = new ProfilerFrame();
+            frame.duration = frameDuration / 1000.0f;
+            frame.samples = new ProfilerSample[names.Length];
+
+            for (int i = 0; i < names.Length; i++)
+            {
+                frame.samples[i].name = names[i];
+                frame.samples[i].duration = durations[i] / 1000.0f;
+                frame.samples[i].depth = (int)depths[i];
+            }
+
+            return frame;
+        }
+
+        /// <summary>
+        /// Writes the recorded frames into a trace file in Chrome trace event format.
+        /// </summary>
+        /// <param name="path">Path of the file to write.</param>
+        /// <param name="numFrames">Maximum number of most recent frames to write. Zero writes all recorded frames.
+        ///                         </param>
+        public static void SaveTrace(string path, int numFrames = 0)
+        {
+            Internal_SaveTrace(path, (uint)Math.Max(numFrames, 0));
+        }
+
+        /// <summary>
+        /// Enables the profiler, records the provided number of frames and writes them into a trace file. Profiler is
+        /// returned to its previous state once the capture is done.
+        /// </summary>
+        /// <param name="path">Path of the trace file to write.</param>
+        /// <param name="numFrames">Number of frames to capture.</param>
+        public static void CaptureFrames(string path, int numFrames)
+        {
+            Internal_CaptureFrames(path, (uint)Math.Max(numFrames, 1));
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetEnabled(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsEnabled();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_BeginSample(string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_EndSample();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetNumFrames();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetFrame(uint idx, out string[] names, out ulong[] durations,
+            out uint[] depths);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SaveTrace(string path, uint numFrames);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CaptureFrames(string path, uint numFrames);
+    }
+
+    /// <summary>
+    /// Time spent in a single scope recorded by <see cref="EditorProfiler"/>.
+    /// </summary>
+    public struct ProfilerSample
+    {
+        /// <summary>
+        /// Name of the sample.
+        /// </summary>
+        public string name;
+
+        /// <summary>
+        /// Duration of the sample, in milliseconds.
+        /// </summary>
+        public float duration;
+
+        /// <summary>
+        /// Number of samples that were active when this sample started.
+        /// </summary>
+        public int depth;
+    }
+
+    /// <summary>
+    /// All samples recorded by <see cref="EditorProfiler"/> during a single frame.
+    /// </summary>
+    public class ProfilerFrame
+    {
+        /// <summary>
+        /// Duration of the frame, in milliseconds.
+        /// </summary>
+        public float duration;
+
+        /// <summary>
+        /// Samples recorded during the frame, in the order they were started.
+        /// </summary>
+        public ProfilerSample[] samples;
+    }
+
+    /** @} */
+}
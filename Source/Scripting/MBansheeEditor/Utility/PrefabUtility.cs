@@ -1,6 +1,7 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
 using System.Runtime.CompilerServices;
 using BansheeEngine;
 
@@ -15,6 +16,29 @@ namespace BansheeEditor
     /// </summary>
     public static class PrefabUtility
     {
+        private static Queue<SceneObject> pendingInstances = new Queue<SceneObject>();
+        private static int numPendingInstancesTotal;
+        private static Action<float> pendingProgressCallback;
+        private static int instancesPerFrame = 50;
+
+        /// <summary>
+        /// Maximum number of prefab instances updated per frame after a prefab is applied. Remaining instances are
+        /// updated in the following frames. Zero means all instances are updated immediately.
+        /// </summary>
+        public static int InstancesPerFrame
+        {
+            get { return instancesPerFrame; }
+            set { instancesPerFrame = Math.Max(value, 0); }
+        }
+
+        /// <summary>
+        /// Checks are there prefab instances in the scene still waiting to be updated with changes from an applied prefab.
+        /// </summary>
+        public static bool IsUpdatingInstances
+        {
+            get { return pendingInstances.Count > 0; }
+        }
+
         /// <summary>
         /// Breaks the link between a prefab instance and its prefab. Object will retain all current values but will
         /// no longer be influenced by modifications to its parent prefab.
@@ -35,8 +59,11 @@ namespace BansheeEditor
         /// </summary>
         /// <param name="obj">Prefab instance whose prefab to update.</param>
         /// <param name="refreshScene">If true, all prefab instances in the current scene will be updated so they consistent
-        ///                            with the newly saved data.</param>
-        public static void ApplyPrefab(SceneObject obj, bool refreshScene = true)
+        ///                            with the newly saved data. Only instances of the applied prefab are updated, spread
+        ///                            over multiple frames as determined by <see cref="InstancesPerFrame"/>.</param>
+        /// <param name="onProgress">Optional callback triggered as scene instances are updated, with the fraction of
+        ///                          updated instances in range [0, 1]. Called with 1 once all instances are updated.</param>
+        public static void ApplyPrefab(SceneObject obj, bool refreshScene = true, Action<float> onProgress = null)
         {
             if (obj == null)
                 return;
@@ -45,14 +72,31 @@ namespace BansheeEditor
             if (prefabInstanceRoot == null)
                 return;
 
+            // Instances pending from an earlier apply must be updated before their prefab changes again
+            FinishUpdatingInstances();
+
+            UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
+
+            SceneObject[] instances = null;
             if (refreshScene)
             {
                 SceneObject root = Scene.Root;
                 if (root != null)
-                    Internal_RecordPrefabDiff(root.GetCachedPtr());
+                {
+                    SceneObject[] allInstances = Internal_FindPrefabInstances(root.GetCachedPtr(), ref prefabUUID);
+
+                    // Applied instance is in sync with the prefab once the prefab is updated
+                    List<SceneObject> otherInstances = new List<SceneObject>(allInstances.Length);
+                    foreach (var instance in allInstances)
+                    {
+                        if (instance != prefabInstanceRoot)
+                            otherInstances.Add(instance);
+                    }
+
+                    instances = otherInstances.ToArray();
+                }
             }
 
-            UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
             string prefabPath = ProjectLibrary.GetPath(prefabUUID);
             Prefab prefab = ProjectLibrary.Load<Prefab>(prefabPath);
             if (prefab != null)
@@ -60,16 +104,85 @@ namespace BansheeEditor
                 IntPtr soPtr = prefabInstanceRoot.GetCachedPtr();
                 IntPtr prefabPtr = prefab.GetCachedPtr();
 
+                // Instance diffs are recorded right before each instance is updated, against the prefab as it was
+                // before this apply
+                if (instances != null && instances.Length > 0)
+                    Internal_CreatePrefabSnapshot(prefabPtr);
+
                 Internal_ApplyPrefab(soPtr, prefabPtr);
                 ProjectLibrary.Save(prefab);
             }
 
-            if (refreshScene)
+            if (instances != null)
             {
-                SceneObject root = Scene.Root;
-                if (root != null)
-                    Internal_UpdateFromPrefab(root.GetCachedPtr());
+                foreach (var instance in instances)
+                    pendingInstances.Enqueue(instance);
+
+                numPendingInstancesTotal = pendingInstances.Count;
+                pendingProgressCallback = onProgress;
+
+                Update();
             }
+            else if (onProgress != null)
+                onProgress(1.0f);
+        }
+
+        /// <summary>
+        /// Immediately updates all prefab instances still waiting to be updated after a prefab was applied. Also called by
+        /// the runtime before the script assemblies are reloaded, as the pending queue doesn't survive the reload.
+        /// </summary>
+        public static void FinishUpdatingInstances()
+        {
+            if (pendingInstances.Count == 0)
+                return;
+
+            Internal_UpdateFromPrefabs(pendingInstances.ToArray());
+            pendingInstances.Clear();
+            Internal_ReleasePrefabSnapshot();
+
+            NotifyProgress();
+        }
+
+        /// <summary>
+        /// Updates the next batch of prefab instances waiting to be updated after a prefab was applied. Called once per
+        /// frame.
+        /// </summary>
+        internal static void Update()
+        {
+            if (pendingInstances.Count == 0)
+                return;
+
+            int numToUpdate = pendingInstances.Count;
+            if (instancesPerFrame > 0)
+                numToUpdate = Math.Min(numToUpdate, instancesPerFrame);
+
+            SceneObject[] batch = new SceneObject[numToUpdate];
+            for (int i = 0; i < numToUpdate; i++)
+                batch[i] = pendingInstances.Dequeue();
+
+            Internal_UpdateFromPrefabs(batch);
+            if (pendingInstances.Count == 0)
+                Internal_ReleasePrefabSnapshot();
+
+            NotifyProgress();
+        }
+
+        /// <summary>
+        /// Reports the progress of pending instance updates to the callback provided to <see cref="ApplyPrefab"/>.
+        /// </summary>
+        private static void NotifyProgress()
+        {
+            Action<float> callback = pendingProgressCallback;
+            if (pendingInstances.Count == 0)
+                pendingProgressCallback = null;
+
+            if (callback == null)
+                return;
+
+            if (numPendingInstancesTotal > 0)
+                callback(1.0f - pendingInstances.Count / (float)numPendingInstancesTotal);
+            else
+                callback(1.0f);
         }
 
         /// <summary>
@@ -170,6 +283,18 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetPrefabUUID(IntPtr soPtr, out UUID uuid);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern SceneObject[] Internal_FindPrefabInstances(IntPtr soPtr, ref UUID prefabUUID);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UpdateFromPrefabs(SceneObject[] sceneObjects);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CreatePrefabSnapshot(IntPtr prefabPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_ReleasePrefabSnapshot();
     }
 
     /** @} */
@@ -135,19 +135,20 @@ namespace BansheeEditor
         /// </summary>
         /// <param name="so">Scene object(s) to clone.</param>
         /// <param name="description">Optional description of what exactly the command does.</param>
-        /// <returns>Cloned scene objects.</returns>
+        /// <returns>Cloned scene objects, in the same order as <paramref name="so"/>. Entries for null or destroyed
+        ///          scene objects are null.</returns>
         public static SceneObject[] CloneSO(SceneObject[] so, string description = "")
         {
             if (so != null)
             {
-                List<IntPtr> soPtrs = new List<IntPtr>();
+                IntPtr[] soPtrs = new IntPtr[so.Length];
                 for (int i = 0; i < so.Length; i++)
                 {
                     if(so[i] != null)
-                        soPtrs.Add(so[i].GetCachedPtr());
+                        soPtrs[i] = so[i].GetCachedPtr();
                 }
 
-                return Internal_CloneSOMulti(soPtrs.ToArray(), description);
+                return Internal_CloneSOMulti(soPtrs, description);
             }
 
             return new SceneObject[0];
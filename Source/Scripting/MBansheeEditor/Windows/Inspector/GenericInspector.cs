@@ -47,6 +47,12 @@ namespace BansheeEditor
             }
         }
 
+        /// <inheritdoc/>
+        internal override bool TracksModifications
+        {
+            get { return true; }
+        }
+
         /// <inheritdoc/>
         protected internal override InspectableState Refresh()
         {
@@ -63,6 +63,8 @@ namespace BansheeEditor
         {
             private Array array;
             private int numElements;
+            private SerializableArray serializableArray;
+            private Array serializableArraySource;
             private Inspector parent;
             private SerializableProperty property;
             private string path;
@@ -146,6 +148,13 @@ namespace BansheeEditor
                     numElements = 0;
                     BuildGUI();
                 }
+                else if (newArray != array)
+                {
+                    // Instance was replaced, make sure rows don't keep referencing the old one
+                    array = newArray;
+                    numElements = array.Length;
+                    BuildGUI();
+                }
                 else
                 {
                     if (array != null)
@@ -185,9 +194,14 @@ namespace BansheeEditor
             /// <inheritdoc/>
             protected internal override object GetValue(int seqIndex)
             {
-                SerializableArray array = property.GetArray();
+                // Rows query their values on every refresh, so avoid creating a new serializable object for each one
+                if (serializableArray == null || serializableArraySource != array)
+                {
+                    serializableArray = property.GetArray();
+                    serializableArraySource = array;
+                }
 
-                return array.GetProperty(seqIndex);
+                return serializableArray.GetProperty(seqIndex);
             }
 
             /// <inheritdoc/>
@@ -65,6 +65,8 @@ namespace BansheeEditor
         {
             private IList list;
             private int numElements;
+            private SerializableList serializableList;
+            private IList serializableListSource;
             private Inspector parent;
             private SerializableProperty property;
             private string path;
@@ -148,6 +150,13 @@ namespace BansheeEditor
                     numElements = 0;
                     BuildGUI();
                 }
+                else if (newList != list)
+                {
+                    // Instance was replaced, make sure rows don't keep referencing the old one
+                    list = newList;
+                    numElements = list.Count;
+                    BuildGUI();
+                }
                 else
                 {
                     if (list != null)
@@ -187,9 +196,14 @@ namespace BansheeEditor
             /// <inheritdoc/>
             protected internal override object GetValue(int seqIndex)
             {
-                SerializableList list = property.GetList();
+                // Rows query their values on every refresh, so avoid creating a new serializable object for each one
+                if (serializableList == null || serializableListSource != list)
+                {
+                    serializableList = property.GetList();
+                    serializableListSource = list;
+                }
 
-                return list.GetProperty(seqIndex);
+                return serializableList.GetProperty(seqIndex);
             }
 
             /// <inheritdoc/>
@@ -154,6 +154,16 @@ namespace BansheeEditor
             GUI.Destroy();
         }
 
+        /// <summary>
+        /// Determines if the inspector only displays values accessed through serializable properties. Such inspectors
+        /// don't need to be refreshed unless a serializable value or the inspected component was modified. Inspectors
+        /// that read values directly from the inspected object must return false, so they are refreshed every frame.
+        /// </summary>
+        internal virtual bool TracksModifications
+        {
+            get { return false; }
+        }
+
         /// <summary>
         /// Called when the inspector is first created.
         /// </summary>
@@ -40,6 +40,8 @@ namespace BansheeEditor
             public Inspector inspector;
             public UInt64 instanceId;
             public bool folded;
+            public int modificationCount = -1;
+            public float lastRefreshTime;
         }
 
         /// <summary>
@@ -55,6 +57,7 @@ namespace BansheeEditor
         private const int RESOURCE_TITLE_HEIGHT = 30;
         private const int COMPONENT_SPACING = 10;
         private const int PADDING = 5;
+        private const float FULL_REFRESH_INTERVAL = 0.1f;
 
         private List<InspectorComponent> inspectorComponents = new List<InspectorComponent>();
         private InspectorPersistentData persistentData;
@@ -492,6 +495,40 @@ namespace BansheeEditor
             Selection.OnSelectionChanged -= OnSelectionChanged;
         }
 
+        /// <summary>
+        /// Checks if the inspector for the provided component needs to be refreshed. Inspectors that track modifications
+        /// are only refreshed if the component was modified since the last refresh, either by the native code or through
+        /// one of its serializable properties. They are still refreshed periodically in order to catch values modified
+        /// directly by scripts, which don't go through serializable properties.
+        /// </summary>
+        /// <param name="data">Inspector GUI elements for the component.</param>
+        /// <param name="component">Component displayed by the inspector.</param>
+        /// <returns>True if the inspector should be refreshed.</returns>
+        private bool RequiresRefresh(InspectorComponent data, Component component)
+        {
+            if (!data.inspector.TracksModifications)
+                return true;
+
+            float time = Time.RealElapsed;
+            bool requiresRefresh = (time - data.lastRefreshTime) >= FULL_REFRESH_INTERVAL;
+
+            ManagedComponent managedComponent = component as ManagedComponent;
+            if (managedComponent != null)
+            {
+                int modificationCount = managedComponent.ModificationCount;
+                if (modificationCount != data.modificationCount)
+                {
+                    data.modificationCount = modificationCount;
+                    requiresRefresh = true;
+                }
+            }
+
+            if (requiresRefresh)
+                data.lastRefreshTime = time;
+
+            return requiresRefresh;
+        }
+
         private void OnEditorUpdate()
         {
             if (currentType == InspectorType.SceneObject)
@@ -523,7 +560,12 @@ namespace BansheeEditor
 
                     InspectableState componentModifyState = InspectableState.NotModified;
                     for (int i = 0; i < inspectorComponents.Count; i++)
+                    {
+                        if (!RequiresRefresh(inspectorComponents[i], allComponents[i]))
+                            continue;
+
                         componentModifyState |= inspectorComponents[i].inspector.Refresh();
+                    }
 
                     if (componentModifyState.HasFlag(InspectableState.ModifyInProgress))
                         EditorApplication.SetSceneDirty();
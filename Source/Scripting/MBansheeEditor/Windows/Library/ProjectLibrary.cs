@@ -81,6 +81,18 @@ namespace BansheeEditor
             totalFilesToImport += Internal_Refresh(path, false);
         }
 
+        /// <summary>
+        /// Queues a file or folder to be checked for modifications, as reported by a folder monitor. The check is 
+        /// delayed until no further changes are reported for the path for a short period. Unlike 
+        /// <see cref="Refresh(string)"/> folders are not checked recursively.
+        /// </summary>
+        /// <param name="path">Path to a file or folder to refresh. Relative to the project library resources folder or 
+        ///                    absolute.</param>
+        internal static void QueueRefresh(string path)
+        {
+            Internal_QueueRefresh(path);
+        }
+
         /// <summary>
         /// Registers a new resource in the library.
         /// </summary>
@@ -285,6 +297,7 @@ namespace BansheeEditor
         /// </summary>
         internal static void Update()
         {
+            totalFilesToImport += Internal_ProcessQueuedRefreshes();
             Internal_FinalizeImports();
 
             int inProgressImports = InProgressImportCount;
@@ -342,6 +355,12 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_FinalizeImports();
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_QueueRefresh(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_ProcessQueuedRefreshes();
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern int Internal_GetInProgressImportCount();
 
@@ -33,6 +33,7 @@ namespace BansheeEditor
         private List<ConsoleEntryData> entries = new List<ConsoleEntryData>();
         private List<ConsoleEntryData> filteredEntries = new List<ConsoleEntryData>();
         private EntryFilter filter = EntryFilter.All;
+        private ulong nextSequence;
         private GUITexture detailsSeparator;
         private GUIScrollArea detailsArea;
         #endregion
@@ -55,9 +56,8 @@ namespace BansheeEditor
         {
             ClearEntries();
 
-            LogEntry[] existingEntries = Debug.Messages;
-            for (int i = 0; i < existingEntries.Length; i++)
-                OnEntryAdded(existingEntries[i].type, existingEntries[i].message);
+            nextSequence = 0;
+            OnEntriesAdded();
         }
 
         #endregion
@@ -159,7 +159,7 @@ namespace BansheeEditor
             detailsSeparator.SetTint(SEPARATOR_COLOR);
 
             Refresh();
-            Debug.OnAdded += OnEntryAdded;
+            Debug.OnEntriesAdded += OnEntriesAdded;
         }
 
         private void OnEditorUpdate()
@@ -169,7 +169,7 @@ namespace BansheeEditor
 
         private void OnDestroy()
         {
-            Debug.OnAdded -= OnEntryAdded;
+            Debug.OnEntriesAdded -= OnEntriesAdded;
         }
 
         /// <inheritdoc/>
@@ -187,31 +187,65 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Triggered when a new entry is added in the debug log.
+        /// Triggered when new entries are added in the debug log. Adds all entries the console hasn't seen yet. Message
+        /// strings are not retrieved until an entry is displayed.
         /// </summary>
-        /// <param name="type">Type of the message.</param>
-        /// <param name="message">Message string.</param>
-        private void OnEntryAdded(DebugMessageType type, string message)
+        private void OnEntriesAdded()
         {
-            // Check if compiler message or reported exception, otherwise parse it as a normal log message
-            ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(message);
-            if (logEntry == null)
-                logEntry = Debug.ParseExceptionMessage(message);
-
-            if (logEntry == null)
-                logEntry = Debug.ParseLogMessage(message);
-
-            ConsoleEntryData newEntry = new ConsoleEntryData();
-            newEntry.type = type;
-            newEntry.callstack = logEntry.callstack;
-            newEntry.message = logEntry.message;
-
-            entries.Add(newEntry);
-            
-            if (DoesFilterMatch(type))
+            LogEntry[] newEntries = Debug.GetEntries(nextSequence, false);
+            for (int i = 0; i < newEntries.Length; i++)
             {
-                listView.AddEntry(newEntry);
-                filteredEntries.Add(newEntry);
+                ConsoleEntryData newEntry = new ConsoleEntryData();
+                newEntry.type = newEntries[i].type;
+                newEntry.sequence = newEntries[i].sequence;
+
+                entries.Add(newEntry);
+
+                if (DoesFilterMatch(newEntry.type))
+                {
+                    listView.AddEntry(newEntry);
+                    filteredEntries.Add(newEntry);
+                }
+            }
+
+            if (newEntries.Length > 0)
+                nextSequence = newEntries[newEntries.Length - 1].sequence + 1;
+
+            // The debug log only keeps the most recent entries, and messages of removed ones can no longer be retrieved
+            ulong firstSequence = Debug.GetFirstSequence();
+            if (entries.Count > 0 && entries[0].sequence < firstSequence)
+                RemoveEntriesBefore(firstSequence);
+        }
+
+        /// <summary>
+        /// Removes all entries older than the specified one from the console. The current selection is kept, unless
+        /// the selected entry was removed.
+        /// </summary>
+        /// <param name="sequence">Sequence number of the oldest entry to keep.</param>
+        private void RemoveEntriesBefore(ulong sequence)
+        {
+            ConsoleEntryData selectedEntry = null;
+            if (sSelectedElementIdx != -1)
+                selectedEntry = filteredEntries[sSelectedElementIdx];
+
+            entries.RemoveAll(x => x.sequence < sequence);
+
+            listView.Clear();
+            filteredEntries.Clear();
+            foreach (var entry in entries)
+            {
+                if (DoesFilterMatch(entry.type))
+                {
+                    listView.AddEntry(entry);
+                    filteredEntries.Add(entry);
+                }
+            }
+
+            if (selectedEntry != null)
+            {
+                sSelectedElementIdx = filteredEntries.IndexOf(selectedEntry);
+                if (sSelectedElementIdx == -1)
+                    RefreshDetailsPanel();
             }
         }
 
@@ -334,6 +368,7 @@ namespace BansheeEditor
                 paddingY.AddSpace(5);
 
                 ConsoleEntryData entry = filteredEntries[sSelectedElementIdx];
+                entry.Parse();
 
                 LocString message = new LocEdString(entry.message);
                 GUILabel messageLabel = new GUILabel(message, EditorStyles.MultiLineLabel, GUIOption.FlexibleHeight());
@@ -396,8 +431,41 @@ namespace BansheeEditor
         private class ConsoleEntryData : GUIListViewData
         {
             public DebugMessageType type;
+            public ulong sequence;
             public string message;
             public CallStackEntry[] callstack;
+
+            private bool isParsed;
+
+            /// <summary>
+            /// Retrieves the message of the entry from the debug log and parses it into the message and callstack. Does
+            /// nothing if the entry was already parsed.
+            /// </summary>
+            public void Parse()
+            {
+                if (isParsed)
+                    return;
+
+                isParsed = true;
+
+                string rawMessage = Debug.GetMessage(sequence);
+                if (rawMessage == null)
+                {
+                    message = "";
+                    return;
+                }
+
+                // Check if compiler message or reported exception, otherwise parse it as a normal log message
+                ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(rawMessage);
+                if (logEntry == null)
+                    logEntry = Debug.ParseExceptionMessage(rawMessage);
+
+                if (logEntry == null)
+                    logEntry = Debug.ParseLogMessage(rawMessage);
+
+                message = logEntry.message;
+                callstack = logEntry.callstack;
+            }
         }
 
         /// <summary>
@@ -467,6 +535,8 @@ namespace BansheeEditor
             /// <inheritdoc/>
             public override void UpdateContents(int index, ConsoleEntryData data)
             {
+                data.Parse();
+
                 if (index != sSelectedElementIdx)
                 {
                     if (index%2 != 0)
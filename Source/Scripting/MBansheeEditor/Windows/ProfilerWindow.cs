@@ -0,0 +1,168 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System.Collections.Generic;
+using BansheeEngine;
+
+namespace BansheeEditor
+{
+    /** @addtogroup Windows
+     *  @{
+     */
+
+    /// <summary>
+    /// Displays CPU time spent in editor subsystems, as recorded by <see cref="EditorProfiler"/>.
+    /// </summary>
+    [DefaultSize(500, 400)]
+    public class ProfilerWindow : EditorWindow
+    {
+        private const int TITLE_HEIGHT = 25;
+        private const int NAME_WIDTH = 260;
+        private const int TIME_WIDTH = 80;
+        private const int INDENT_WIDTH = 10;
+        private const int NUM_AVERAGED_FRAMES = 60;
+        private const float REFRESH_INTERVAL = 0.25f;
+
+        private GUIToggle recordBtn;
+        private GUIScrollArea samplesArea;
+        private float lastRefreshTime;
+
+        /// <summary>
+        /// Opens the profiler window.
+        /// </summary>
+        [MenuItem("Windows/Profiler", 6000)]
+        private static void OpenProfilerWindow()
+        {
+            OpenWindow<ProfilerWindow>();
+        }
+
+        /// <inheritdoc/>
+        protected override LocString GetDisplayName()
+        {
+            return new LocEdString("Profiler");
+        }
+
+        private void OnInitialize()
+        {
+            GUILayoutY layout = GUI.AddLayoutY();
+            GUILayoutX titleLayout = layout.AddLayoutX();
+
+            recordBtn = new GUIToggle(new LocEdString("Record"), EditorStyles.Button, GUIOption.FixedHeight(TITLE_HEIGHT));
+            GUIButton saveBtn = new GUIButton(new LocEdString("Save trace"), GUIOption.FixedHeight(TITLE_HEIGHT));
+
+            titleLayout.AddElement(recordBtn);
+            titleLayout.AddFlexibleSpace();
+            titleLayout.AddElement(saveBtn);
+
+            recordBtn.Value = EditorProfiler.Enabled;
+            recordBtn.OnToggled += x =>
+            {
+                EditorProfiler.Enabled = x;
+                Refresh();
+            };
+
+            saveBtn.OnClick += () =>
+            {
+                string tracePath;
+                if (BrowseDialog.SaveFile(ProjectLibrary.ResourceFolder, "*.json", out tracePath))
+                    EditorProfiler.SaveTrace(tracePath);
+            };
+
+            samplesArea = new GUIScrollArea();
+            layout.AddElement(samplesArea);
+
+            Refresh();
+        }
+
+        private void OnEditorUpdate()
+        {
+            // Profiler state can also be changed from scripts or the command line
+            if (recordBtn.Value != EditorProfiler.Enabled)
+                recordBtn.Value = EditorProfiler.Enabled;
+
+            if (!EditorProfiler.Enabled)
+                return;
+
+            if ((Time.RealElapsed - lastRefreshTime) >= REFRESH_INTERVAL)
+                Refresh();
+        }
+
+        /// <summary>
+        /// Rebuilds the sample list from the most recent frame, along with sample times averaged over a number of most
+        /// recent frames.
+        /// </summary>
+        private void Refresh()
+        {
+            lastRefreshTime = Time.RealElapsed;
+
+            GUILayout samplesLayout = samplesArea.Layout;
+            samplesLayout.Clear();
+
+            int numFrames = EditorProfiler.NumFrames;
+            if (numFrames == 0)
+            {
+                samplesLayout.AddElement(new GUILabel(new LocEdString("No frames recorded.")));
+                return;
+            }
+
+            // Average per sample name, as the same sample can be recorded multiple times in a frame
+            int numAveraged = MathEx.Min(numFrames, NUM_AVERAGED_FRAMES);
+            float averageFrameTime = 0.0f;
+            Dictionary<string, float> averageTimes = new Dictionary<string, float>();
+            for (int i = 0; i < numAveraged; i++)
+            {
+                ProfilerFrame averagedFrame = EditorProfiler.GetFrame(i);
+                averageFrameTime += averagedFrame.duration / numAveraged;
+
+                foreach (var sample in averagedFrame.samples)
+                {
+                    float time;
+                    averageTimes.TryGetValue(sample.name, out time);
+                    averageTimes[sample.name] = time + sample.duration / numAveraged;
+                }
+            }
+
+            ProfilerFrame frame = EditorProfiler.GetFrame(0);
+
+            AddRow(samplesLayout, new LocEdString("Sample"), 0, new LocEdString("Last (ms)"),
+                new LocEdString("Average (ms)"));
+            AddRow(samplesLayout, new LocEdString("Frame"), 0, frame.duration.ToString("F3"), 
+                averageFrameTime.ToString("F3"));
+
+            foreach (var sample in frame.samples)
+            {
+                float averageTime;
+                averageTimes.TryGetValue(sample.name, out averageTime);
+
+                AddRow(samplesLayout, sample.name, sample.depth + 1, sample.duration.ToString("F3"),
+                    averageTime.ToString("F3"));
+            }
+
+            samplesLayout.AddFlexibleSpace();
+        }
+
+        /// <summary>
+        /// Appends a single row to the sample list.
+        /// </summary>
+        /// <param name="layout">Layout to append the row to.</param>
+        /// <param name="name">Name of the sample.</param>
+        /// <param name="depth">Nesting level of the sample, determining how far is its name indented.</param>
+        /// <param name="lastTime">Text displaying the time of the sample in the most recent frame.</param>
+        /// <param name="averageTime">Text displaying the averaged time of the sample.</param>
+        private static void AddRow(GUILayout layout, GUIContent name, int depth, GUIContent lastTime,
+            GUIContent averageTime)
+        {
+            GUILayoutX row = layout.AddLayoutX();
+
+            int indent = depth * INDENT_WIDTH;
+            if (indent > 0)
+                row.AddSpace(indent);
+
+            row.AddElement(new GUILabel(name, GUIOption.FixedWidth(NAME_WIDTH - indent)));
+            row.AddElement(new GUILabel(lastTime, GUIOption.FixedWidth(TIME_WIDTH)));
+            row.AddElement(new GUILabel(averageTime, GUIOption.FixedWidth(TIME_WIDTH)));
+            row.AddFlexibleSpace();
+        }
+    }
+
+    /** @} */
+}
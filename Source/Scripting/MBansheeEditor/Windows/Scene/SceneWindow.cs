@@ -334,15 +334,24 @@ namespace BansheeEditor
                 else
                     message = "Duplicated " + selectedObjects.Length + " elements";
 
-                Transform[] savedTransforms = new Transform[selectedObjects.Length];
-                for (int i = 0; i < savedTransforms.Length; i++)
-                    savedTransforms[i] = new Transform(selectedObjects[i]);
+                int numObjects = selectedObjects.Length;
+                Vector3[] positions = new Vector3[numObjects];
+                Quaternion[] rotations = new Quaternion[numObjects];
+                Vector3[] scales = new Vector3[numObjects];
+
+                SceneObject.GetPositions(selectedObjects, positions);
+                SceneObject.GetRotations(selectedObjects, rotations);
+                SceneObject.GetScales(selectedObjects, scales);
 
                 SceneObject[] clonedObjects = UndoRedo.CloneSO(selectedObjects, message);
 
-                // Restore world positions
-                for (int i = 0; i < savedTransforms.Length; i++)
-                    savedTransforms[i].Apply(clonedObjects[i]);
+                // Restore world transforms
+                if (clonedObjects.Length == numObjects)
+                {
+                    SceneObject.SetPositions(clonedObjects, positions);
+                    SceneObject.SetRotations(clonedObjects, rotations);
+                    SceneObject.SetLocalScales(clonedObjects, scales);
+                }
 
                 EditorApplication.SetSceneDirty();
             }
@@ -980,34 +989,6 @@ namespace BansheeEditor
             isDraggingSelection = false;
             return true;
         }
-
-        /// <summary>
-        /// Contains information about world transform of a single scene object.
-        /// </summary>
-        struct Transform
-        {
-            public Transform(SceneObject so)
-            {
-                position = so.Position;
-                rotation = so.Rotation;
-                scale = so.Scale;
-            }
-
-            /// <summary>
-            /// Applies the saved transform to the specified scene object. The transform is assumed to be in world space.
-            /// </summary>
-            /// <param name="so">Scene object to apply the transform to.</param>
-            public void Apply(SceneObject so)
-            {
-                so.Position = position;
-                so.Rotation = rotation;
-                so.LocalScale = scale;
-            }
-
-            public Vector3 position;
-            public Quaternion rotation;
-            public Vector3 scale;
-        }
     }
 
     /** @} */
@@ -0,0 +1,33 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Animation
+     *  @{
+     */
+
+    public partial class AnimationClip
+    {
+        /// <summary>
+        /// Modifies the curves of the clip. Curves returned by <see cref="Curves"/> are shared with the clip and can't
+        /// be modified directly. Instead the curves are copied, modified by the provided callback, and then assigned
+        /// back to the clip. This means the curves are only copied once regardless of the number of modifications
+        /// performed in the callback.
+        /// </summary>
+        /// <param name="edit">Callback that receives a copy of the clip's curves to modify.</param>
+        public void EditCurves(Action<AnimationCurves> edit)
+        {
+            if (edit == null)
+                return;
+
+            AnimationCurves curves = Curves.Clone();
+            edit(curves);
+
+            Curves = curves;
+        }
+    }
+
+    /** @} */
+}
@@ -0,0 +1,293 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Animation
+     *  @{
+     */
+
+    /// <summary>
+    /// Types of curves stored in <see cref="AnimationCurves"/>.
+    /// </summary>
+    public enum AnimationCurveSet // Note: Must match C++ enum AnimationCurveSet
+    {
+        /// <summary>
+        /// Curves stored in <see cref="AnimationCurves.Position"/>, with <see cref="KeyFrameVec3"/> keyframes.
+        /// </summary>
+        Position,
+        /// <summary>
+        /// Curves stored in <see cref="AnimationCurves.Rotation"/>, with <see cref="KeyFrameQuat"/> keyframes.
+        /// </summary>
+        Rotation,
+        /// <summary>
+        /// Curves stored in <see cref="AnimationCurves.Scale"/>, with <see cref="KeyFrameVec3"/> keyframes.
+        /// </summary>
+        Scale,
+        /// <summary>
+        /// Curves stored in <see cref="AnimationCurves.Generic"/>, with <see cref="KeyFrame"/> keyframes.
+        /// </summary>
+        Generic
+    }
+
+    public partial class AnimationCurves
+    {
+        // Unlike the Position, Rotation, Scale and Generic properties, keyframe methods below don't copy the entire
+        // curve set, and modifying a keyframe only rebuilds the curve containing it. Curves returned by
+        // AnimationClip.Curves are shared with the clip and cannot be modified this way, use AnimationClip.EditCurves
+        // instead.
+
+        /// <summary>
+        /// Finds a curve with the specified name.
+        /// </summary>
+        /// <param name="set">Type of the curve to find.</param>
+        /// <param name="name">Name of the curve to find.</param>
+        /// <returns>Index of the curve in the curve set, or -1 if there is no such curve.</returns>
+        public int FindCurve(AnimationCurveSet set, string name)
+        {
+            return AnimationCurvesKeyFrames.Internal_FindCurve(mCachedPtr, set, name);
+        }
+
+        /// <summary>
+        /// Returns the number of keyframes in a curve.
+        /// </summary>
+        /// <param name="set">Type of the curve.</param>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <returns>Number of keyframes in the curve, or zero if the curve doesn't exist.</returns>
+        public int GetNumKeyFrames(AnimationCurveSet set, int curveIdx)
+        {
+            if (curveIdx < 0)
+                return 0;
+
+            return AnimationCurvesKeyFrames.Internal_GetNumKeyFrames(mCachedPtr, set, curveIdx);
+        }
+
+        /// <summary>
+        /// Copies keyframes of a <see cref="AnimationCurveSet.Generic"/> curve into a caller provided buffer.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrames">Buffer to receive the keyframes. Keyframes that don't fit are not copied.</param>
+        /// <param name="start">Index of the first keyframe to copy.</param>
+        /// <returns>Number of keyframes copied into the buffer.</returns>
+        public int GetKeyFrames(int curveIdx, KeyFrame[] keyFrames, int start = 0)
+        {
+            return CopyKeyFrames(AnimationCurveSet.Generic, curveIdx, keyFrames, start);
+        }
+
+        /// <summary>
+        /// Copies keyframes of a <see cref="AnimationCurveSet.Position"/> or <see cref="AnimationCurveSet.Scale"/>
+        /// curve into a caller provided buffer.
+        /// </summary>
+        /// <param name="set">Type of the curve. Must be a set with <see cref="KeyFrameVec3"/> keyframes.</param>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrames">Buffer to receive the keyframes. Keyframes that don't fit are not copied.</param>
+        /// <param name="start">Index of the first keyframe to copy.</param>
+        /// <returns>Number of keyframes copied into the buffer.</returns>
+        public int GetKeyFrames(AnimationCurveSet set, int curveIdx, KeyFrameVec3[] keyFrames, int start = 0)
+        {
+            return CopyKeyFrames(set, curveIdx, keyFrames, start);
+        }
+
+        /// <summary>
+        /// Copies keyframes of a <see cref="AnimationCurveSet.Rotation"/> curve into a caller provided buffer.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrames">Buffer to receive the keyframes. Keyframes that don't fit are not copied.</param>
+        /// <param name="start">Index of the first keyframe to copy.</param>
+        /// <returns>Number of keyframes copied into the buffer.</returns>
+        public int GetKeyFrames(int curveIdx, KeyFrameQuat[] keyFrames, int start = 0)
+        {
+            return CopyKeyFrames(AnimationCurveSet.Rotation, curveIdx, keyFrames, start);
+        }
+
+        /// <summary>
+        /// Replaces a keyframe in a <see cref="AnimationCurveSet.Generic"/> curve.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyIdx">Index of the keyframe to replace.</param>
+        /// <param name="keyFrame">New keyframe.</param>
+        /// <returns>Index of the keyframe after the update, or -1 if the curve or keyframe doesn't exist. Keyframes are
+        ///          kept sorted by time, so the index changes if the new time moves the keyframe past its neighbors.
+        ///          </returns>
+        public int SetKeyFrame(int curveIdx, int keyIdx, KeyFrame keyFrame)
+        {
+            if (curveIdx < 0 || keyIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_SetKeyFrameFloat(mCachedPtr, AnimationCurveSet.Generic, curveIdx,
+                keyIdx, ref keyFrame);
+        }
+
+        /// <summary>
+        /// Replaces a keyframe in a <see cref="AnimationCurveSet.Position"/> or <see cref="AnimationCurveSet.Scale"/>
+        /// curve.
+        /// </summary>
+        /// <param name="set">Type of the curve. Must be a set with <see cref="KeyFrameVec3"/> keyframes.</param>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyIdx">Index of the keyframe to replace.</param>
+        /// <param name="keyFrame">New keyframe.</param>
+        /// <returns>Index of the keyframe after the update, or -1 if the curve or keyframe doesn't exist. Keyframes are
+        ///          kept sorted by time, so the index changes if the new time moves the keyframe past its neighbors.
+        ///          </returns>
+        public int SetKeyFrame(AnimationCurveSet set, int curveIdx, int keyIdx, KeyFrameVec3 keyFrame)
+        {
+            if (curveIdx < 0 || keyIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_SetKeyFrameVec3(mCachedPtr, set, curveIdx, keyIdx, ref keyFrame);
+        }
+
+        /// <summary>
+        /// Replaces a keyframe in a <see cref="AnimationCurveSet.Rotation"/> curve.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyIdx">Index of the keyframe to replace.</param>
+        /// <param name="keyFrame">New keyframe.</param>
+        /// <returns>Index of the keyframe after the update, or -1 if the curve or keyframe doesn't exist. Keyframes are
+        ///          kept sorted by time, so the index changes if the new time moves the keyframe past its neighbors.
+        ///          </returns>
+        public int SetKeyFrame(int curveIdx, int keyIdx, KeyFrameQuat keyFrame)
+        {
+            if (curveIdx < 0 || keyIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_SetKeyFrameQuat(mCachedPtr, AnimationCurveSet.Rotation, curveIdx,
+                keyIdx, ref keyFrame);
+        }
+
+        /// <summary>
+        /// Inserts a keyframe into a <see cref="AnimationCurveSet.Generic"/> curve, at the position determined by its
+        /// time.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrame">Keyframe to insert.</param>
+        /// <returns>Index of the inserted keyframe, or -1 if the curve doesn't exist.</returns>
+        public int AddKeyFrame(int curveIdx, KeyFrame keyFrame)
+        {
+            if (curveIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_AddKeyFrameFloat(mCachedPtr, AnimationCurveSet.Generic, curveIdx,
+                ref keyFrame);
+        }
+
+        /// <summary>
+        /// Inserts a keyframe into a <see cref="AnimationCurveSet.Position"/> or <see cref="AnimationCurveSet.Scale"/>
+        /// curve, at the position determined by its time.
+        /// </summary>
+        /// <param name="set">Type of the curve. Must be a set with <see cref="KeyFrameVec3"/> keyframes.</param>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrame">Keyframe to insert.</param>
+        /// <returns>Index of the inserted keyframe, or -1 if the curve doesn't exist.</returns>
+        public int AddKeyFrame(AnimationCurveSet set, int curveIdx, KeyFrameVec3 keyFrame)
+        {
+            if (curveIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_AddKeyFrameVec3(mCachedPtr, set, curveIdx, ref keyFrame);
+        }
+
+        /// <summary>
+        /// Inserts a keyframe into a <see cref="AnimationCurveSet.Rotation"/> curve, at the position determined by its
+        /// time.
+        /// </summary>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyFrame">Keyframe to insert.</param>
+        /// <returns>Index of the inserted keyframe, or -1 if the curve doesn't exist.</returns>
+        public int AddKeyFrame(int curveIdx, KeyFrameQuat keyFrame)
+        {
+            if (curveIdx < 0)
+                return -1;
+
+            return AnimationCurvesKeyFrames.Internal_AddKeyFrameQuat(mCachedPtr, AnimationCurveSet.Rotation, curveIdx,
+                ref keyFrame);
+        }
+
+        /// <summary>
+        /// Removes a keyframe from a curve.
+        /// </summary>
+        /// <param name="set">Type of the curve.</param>
+        /// <param name="curveIdx">Index of the curve in the curve set.</param>
+        /// <param name="keyIdx">Index of the keyframe to remove.</param>
+        /// <returns>True if the keyframe was removed, false if the curve or keyframe doesn't exist.</returns>
+        public bool RemoveKeyFrame(AnimationCurveSet set, int curveIdx, int keyIdx)
+        {
+            if (curveIdx < 0 || keyIdx < 0)
+                return false;
+
+            return AnimationCurvesKeyFrames.Internal_RemoveKeyFrame(mCachedPtr, set, curveIdx, keyIdx);
+        }
+
+        /// <summary>
+        /// Creates a deep copy of the curves, which isn't shared with any animation clip.
+        /// </summary>
+        /// <returns>New curve set with the same curves as this one.</returns>
+        internal AnimationCurves Clone()
+        {
+            return AnimationCurvesKeyFrames.Internal_Clone(mCachedPtr);
+        }
+
+        /// <summary>
+        /// Copies keyframes of any curve type into a caller provided buffer. Buffer element type must match the curve
+        /// set, otherwise nothing is copied.
+        /// </summary>
+        private int CopyKeyFrames(AnimationCurveSet set, int curveIdx, Array keyFrames, int start)
+        {
+            if (keyFrames == null || curveIdx < 0 || start < 0)
+                return 0;
+
+            return AnimationCurvesKeyFrames.Internal_GetKeyFrames(mCachedPtr, set, curveIdx, start, keyFrames);
+        }
+    }
+
+    /// <summary>
+    /// Provides keyframe level access to <see cref="AnimationCurves"/>.
+    /// </summary>
+    internal static class AnimationCurvesKeyFrames
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_FindCurve(IntPtr thisPtr, AnimationCurveSet set, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetNumKeyFrames(IntPtr thisPtr, AnimationCurveSet set, int curveIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetKeyFrames(IntPtr thisPtr, AnimationCurveSet set, int curveIdx, int start,
+            Array keyFrames);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_SetKeyFrameFloat(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            int keyIdx, ref KeyFrame keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_SetKeyFrameVec3(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            int keyIdx, ref KeyFrameVec3 keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_SetKeyFrameQuat(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            int keyIdx, ref KeyFrameQuat keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_AddKeyFrameFloat(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            ref KeyFrame keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_AddKeyFrameVec3(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            ref KeyFrameVec3 keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_AddKeyFrameQuat(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            ref KeyFrameQuat keyFrame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_RemoveKeyFrame(IntPtr thisPtr, AnimationCurveSet set, int curveIdx,
+            int keyIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern AnimationCurves Internal_Clone(IntPtr thisPtr);
+    }
+
+    /** @} */
+}
@@ -0,0 +1,321 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Physics
+     *  @{
+     */
+
+    /// <summary>
+    /// Reusable buffer that receives hits from batched physics casts performed through <see cref="PhysicsQueryBatch"/>.
+    /// </summary>
+    public sealed class PhysicsQueryResults
+    {
+        internal PhysicsQueryHit[] hits;
+        internal int[] hitCounts;
+        internal int maxHitsPerQuery;
+
+        /// <summary>
+        /// Creates a new result buffer.
+        /// </summary>
+        /// <param name="maxQueries">Maximum number of queries whose results can be stored in the buffer.</param>
+        /// <param name="maxHitsPerQuery">Maximum number of hits recorded per query. Additional hits are discarded.
+        ///                               </param>
+        public PhysicsQueryResults(int maxQueries, int maxHitsPerQuery = 1)
+        {
+            maxQueries = MathEx.Max(maxQueries, 0);
+            this.maxHitsPerQuery = MathEx.Max(maxHitsPerQuery, 1);
+
+            hits = new PhysicsQueryHit[maxQueries * this.maxHitsPerQuery];
+            hitCounts = new int[maxQueries];
+        }
+
+        /// <summary>
+        /// Maximum number of queries whose results can be stored in the buffer.
+        /// </summary>
+        public int MaxQueries
+        {
+            get { return hitCounts.Length; }
+        }
+
+        /// <summary>
+        /// Maximum number of hits recorded per query.
+        /// </summary>
+        public int MaxHitsPerQuery
+        {
+            get { return maxHitsPerQuery; }
+        }
+
+        /// <summary>
+        /// Number of queries whose results were written by the most recent batch.
+        /// </summary>
+        public int NumQueries { get; internal set; }
+
+        /// <summary>
+        /// Returns the number of hits recorded for a query.
+        /// </summary>
+        /// <param name="query">Index of the query in the most recent batch.</param>
+        /// <returns>Number of recorded hits.</returns>
+        public int GetHitCount(int query)
+        {
+            return hitCounts[query];
+        }
+
+        /// <summary>
+        /// Returns a hit recorded for a query.
+        /// </summary>
+        /// <param name="query">Index of the query in the most recent batch.</param>
+        /// <param name="hit">Index of the hit, in range [0, <see cref="GetHitCount"/>).</param>
+        /// <returns>Information about the hit.</returns>
+        public PhysicsQueryHit GetHit(int query, int hit)
+        {
+            return hits[query * maxHitsPerQuery + hit];
+        }
+    }
+
+    /// <summary>
+    /// Reusable buffer that receives colliders from batched physics overlap queries performed through
+    /// <see cref="PhysicsQueryBatch"/>.
+    /// </summary>
+    public sealed class PhysicsOverlapResults
+    {
+        internal Collider[] colliders;
+        internal int[] colliderCounts;
+        internal int maxCollidersPerQuery;
+
+        /// <summary>
+        /// Creates a new result buffer.
+        /// </summary>
+        /// <param name="maxQueries">Maximum number of queries whose results can be stored in the buffer.</param>
+        /// <param name="maxCollidersPerQuery">Maximum number of colliders recorded per query. Additional colliders are
+        ///                                    discarded.</param>
+        public PhysicsOverlapResults(int maxQueries, int maxCollidersPerQuery)
+        {
+            maxQueries = MathEx.Max(maxQueries, 0);
+            this.maxCollidersPerQuery = MathEx.Max(maxCollidersPerQuery, 1);
+
+            colliders = new Collider[maxQueries * this.maxCollidersPerQuery];
+            colliderCounts = new int[maxQueries];
+        }
+
+        /// <summary>
+        /// Maximum number of queries whose results can be stored in the buffer.
+        /// </summary>
+        public int MaxQueries
+        {
+            get { return colliderCounts.Length; }
+        }
+
+        /// <summary>
+        /// Maximum number of colliders recorded per query.
+        /// </summary>
+        public int MaxCollidersPerQuery
+        {
+            get { return maxCollidersPerQuery; }
+        }
+
+        /// <summary>
+        /// Number of queries whose results were written by the most recent batch.
+        /// </summary>
+        public int NumQueries { get; internal set; }
+
+        /// <summary>
+        /// Returns the number of colliders recorded for a query.
+        /// </summary>
+        /// <param name="query">Index of the query in the most recent batch.</param>
+        /// <returns>Number of recorded colliders.</returns>
+        public int GetColliderCount(int query)
+        {
+            return colliderCounts[query];
+        }
+
+        /// <summary>
+        /// Returns a collider recorded for a query.
+        /// </summary>
+        /// <param name="query">Index of the query in the most recent batch.</param>
+        /// <param name="collider">Index of the collider, in range [0, <see cref="GetColliderCount"/>).</param>
+        /// <returns>Overlapping collider.</returns>
+        public Collider GetCollider(int query, int collider)
+        {
+            return colliders[query * maxCollidersPerQuery + collider];
+        }
+    }
+
+    /// <summary>
+    /// Performs many physics queries in a single call. Unlike the queries in <see cref="Physics"/>, results are
+    /// written into caller provided buffers that can be reused between calls, so no garbage is generated. Queries can
+    /// optionally be split between worker threads.
+    /// </summary>
+    public static class PhysicsQueryBatch
+    {
+        /// <summary>
+        /// Casts multiple rays into the scene and records the closest hit for each.
+        /// </summary>
+        /// <param name="rays">Rays to cast into the scene.</param>
+        /// <param name="numRays">Number of entries from <paramref name="rays"/> to cast. Limited to the capacity of
+        ///                       <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the hits, at most one per ray.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="max">Maximum distance at which to perform the query. Hits past this distance will not be
+        ///                   detected.</param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void RayCast(Ray[] rays, int numRays, PhysicsQueryResults results,
+            ulong layer = ulong.MaxValue, float max = float.MaxValue, bool parallel = false)
+        {
+            numRays = GetNumQueries(rays, numRays, results.MaxQueries);
+
+            Internal_RayCast(rays, (uint)numRays, layer, max, false, parallel, results.hits, results.hitCounts,
+                (uint)results.maxHitsPerQuery);
+            results.NumQueries = numRays;
+        }
+
+        /// <summary>
+        /// Casts multiple rays into the scene and records all hits for each, up to the limit of the result buffer.
+        /// </summary>
+        /// <param name="rays">Rays to cast into the scene.</param>
+        /// <param name="numRays">Number of entries from <paramref name="rays"/> to cast. Limited to the capacity of
+        ///                       <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the hits.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="max">Maximum distance at which to perform the query. Hits past this distance will not be
+        ///                   detected.</param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void RayCastAll(Ray[] rays, int numRays, PhysicsQueryResults results,
+            ulong layer = ulong.MaxValue, float max = float.MaxValue, bool parallel = false)
+        {
+            numRays = GetNumQueries(rays, numRays, results.MaxQueries);
+
+            Internal_RayCast(rays, (uint)numRays, layer, max, true, parallel, results.hits, results.hitCounts,
+                (uint)results.maxHitsPerQuery);
+            results.NumQueries = numRays;
+        }
+
+        /// <summary>
+        /// Performs multiple sphere sweeps into the scene and records the closest hit for each.
+        /// </summary>
+        /// <param name="spheres">Spheres to sweep through the scene.</param>
+        /// <param name="unitDirs">Unit direction in which to sweep each sphere.</param>
+        /// <param name="numSpheres">Number of entries from <paramref name="spheres"/> to sweep. Limited to the capacity
+        ///                          of <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the hits, at most one per sphere.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="max">Maximum distance at which to perform the query. Hits past this distance will not be
+        ///                   detected.</param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void SphereCast(Sphere[] spheres, Vector3[] unitDirs, int numSpheres, PhysicsQueryResults results,
+            ulong layer = ulong.MaxValue, float max = float.MaxValue, bool parallel = false)
+        {
+            numSpheres = GetNumQueries(spheres, numSpheres, results.MaxQueries);
+            numSpheres = GetNumQueries(unitDirs, numSpheres, results.MaxQueries);
+
+            Internal_SphereCast(spheres, unitDirs, (uint)numSpheres, layer, max, false, parallel, results.hits,
+                results.hitCounts, (uint)results.maxHitsPerQuery);
+            results.NumQueries = numSpheres;
+        }
+
+        /// <summary>
+        /// Performs multiple sphere sweeps into the scene and records all hits for each, up to the limit of the result
+        /// buffer.
+        /// </summary>
+        /// <param name="spheres">Spheres to sweep through the scene.</param>
+        /// <param name="unitDirs">Unit direction in which to sweep each sphere.</param>
+        /// <param name="numSpheres">Number of entries from <paramref name="spheres"/> to sweep. Limited to the capacity
+        ///                          of <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the hits.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="max">Maximum distance at which to perform the query. Hits past this distance will not be
+        ///                   detected.</param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void SphereCastAll(Sphere[] spheres, Vector3[] unitDirs, int numSpheres,
+            PhysicsQueryResults results, ulong layer = ulong.MaxValue, float max = float.MaxValue,
+            bool parallel = false)
+        {
+            numSpheres = GetNumQueries(spheres, numSpheres, results.MaxQueries);
+            numSpheres = GetNumQueries(unitDirs, numSpheres, results.MaxQueries);
+
+            Internal_SphereCast(spheres, unitDirs, (uint)numSpheres, layer, max, true, parallel, results.hits,
+                results.hitCounts, (uint)results.maxHitsPerQuery);
+            results.NumQueries = numSpheres;
+        }
+
+        /// <summary>
+        /// Finds colliders overlapping each of the provided spheres.
+        /// </summary>
+        /// <param name="spheres">Spheres to check for overlap.</param>
+        /// <param name="numSpheres">Number of entries from <paramref name="spheres"/> to check. Limited to the capacity
+        ///                          of <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the overlapping colliders.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void SphereOverlap(Sphere[] spheres, int numSpheres, PhysicsOverlapResults results,
+            ulong layer = ulong.MaxValue, bool parallel = false)
+        {
+            numSpheres = GetNumQueries(spheres, numSpheres, results.MaxQueries);
+
+            Internal_SphereOverlap(spheres, (uint)numSpheres, layer, parallel, results.colliders,
+                results.colliderCounts, (uint)results.maxCollidersPerQuery);
+            results.NumQueries = numSpheres;
+        }
+
+        /// <summary>
+        /// Finds colliders overlapping each of the provided boxes.
+        /// </summary>
+        /// <param name="boxes">Boxes to check for overlap.</param>
+        /// <param name="rotations">Orientation of each box.</param>
+        /// <param name="numBoxes">Number of entries from <paramref name="boxes"/> to check. Limited to the capacity of
+        ///                        <paramref name="results"/>.</param>
+        /// <param name="results">Buffer to receive the overlapping colliders.</param>
+        /// <param name="layer">Layers to consider for the query. This allows you to ignore certain groups of objects.
+        ///                     </param>
+        /// <param name="parallel">True if the queries can be split between worker threads.</param>
+        public static void BoxOverlap(AABox[] boxes, Quaternion[] rotations, int numBoxes,
+            PhysicsOverlapResults results, ulong layer = ulong.MaxValue, bool parallel = false)
+        {
+            numBoxes = GetNumQueries(boxes, numBoxes, results.MaxQueries);
+            numBoxes = GetNumQueries(rotations, numBoxes, results.MaxQueries);
+
+            Internal_BoxOverlap(boxes, rotations, (uint)numBoxes, layer, parallel, results.colliders,
+                results.colliderCounts, (uint)results.maxCollidersPerQuery);
+            results.NumQueries = numBoxes;
+        }
+
+        /// <summary>
+        /// Clamps the requested number of queries to the number of provided inputs and the capacity of the result
+        /// buffer.
+        /// </summary>
+        private static int GetNumQueries(Array inputs, int numQueries, int maxQueries)
+        {
+            if (inputs == null)
+                return 0;
+
+            return MathEx.Clamp(numQueries, 0, MathEx.Min(inputs.Length, maxQueries));
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_RayCast(Ray[] rays, uint numQueries, ulong layer, float max, bool all,
+            bool parallel, PhysicsQueryHit[] hits, int[] hitCounts, uint maxHitsPerQuery);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SphereCast(Sphere[] spheres, Vector3[] unitDirs, uint numQueries,
+            ulong layer, float max, bool all, bool parallel, PhysicsQueryHit[] hits, int[] hitCounts,
+            uint maxHitsPerQuery);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SphereOverlap(Sphere[] spheres, uint numQueries, ulong layer,
+            bool parallel, Collider[] colliders, int[] counts, uint maxCollidersPerQuery);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_BoxOverlap(AABox[] boxes, Quaternion[] rotations, uint numQueries,
+            ulong layer, bool parallel, Collider[] colliders, int[] counts, uint maxCollidersPerQuery);
+    }
+
+    /** @} */
+}
@@ -0,0 +1,169 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    public partial class Camera
+    {
+        /// <summary>
+        /// Converts many points from world space to screen coordinates in a single call. Equivalent to calling
+        /// <see cref="WorldToScreenPoint"/> for each point, but considerably faster for large numbers of points.
+        /// </summary>
+        /// <param name="worldPoints">3D points in world space.</param>
+        /// <param name="screenPoints">Array to receive the 2D points on the render target attached to the camera's
+        ///                            viewport, in pixels.</param>
+        /// <param name="visible">Optional array to receive a flag for each point, signaling whether the point is
+        ///                       within the camera's frustum.</param>
+        /// <param name="numPoints">Number of points to convert. If negative, all provided points are converted. Limited
+        ///                         by the sizes of the provided arrays.</param>
+        /// <returns>Number of points within the camera's frustum.</returns>
+        public int WorldToScreenPoints(Vector3[] worldPoints, Vector2I[] screenPoints, bool[] visible = null,
+            int numPoints = -1)
+        {
+            numPoints = GetNumPoints(worldPoints, screenPoints, visible, numPoints);
+            if (numPoints == 0)
+                return 0;
+
+            return CameraConversions.Internal_WorldToScreenPoints(mCachedPtr, worldPoints, numPoints, screenPoints,
+                visible);
+        }
+
+        /// <summary>
+        /// Converts many points from world space to normalized device coordinates in a single call. Equivalent to
+        /// calling <see cref="WorldToNdcPoint"/> for each point, but considerably faster for large numbers of points.
+        /// </summary>
+        /// <param name="worldPoints">3D points in world space.</param>
+        /// <param name="ndcPoints">Array to receive the 2D points in normalized device coordinates ([-1, 1] range),
+        ///                         relative to the camera's viewport.</param>
+        /// <param name="visible">Optional array to receive a flag for each point, signaling whether the point is
+        ///                       within the camera's frustum.</param>
+        /// <param name="numPoints">Number of points to convert. If negative, all provided points are converted. Limited
+        ///                         by the sizes of the provided arrays.</param>
+        /// <returns>Number of points within the camera's frustum.</returns>
+        public int WorldToNdcPoints(Vector3[] worldPoints, Vector2[] ndcPoints, bool[] visible = null,
+            int numPoints = -1)
+        {
+            numPoints = GetNumPoints(worldPoints, ndcPoints, visible, numPoints);
+            if (numPoints == 0)
+                return 0;
+
+            return CameraConversions.Internal_WorldToNdcPoints(mCachedPtr, worldPoints, numPoints, ndcPoints, visible);
+        }
+
+        /// <summary>
+        /// Converts many points from world space to view space in a single call. Equivalent to calling
+        /// <see cref="WorldToViewPoint"/> for each point.
+        /// </summary>
+        /// <param name="worldPoints">3D points in world space.</param>
+        /// <param name="viewPoints">Array to receive the 3D points relative to the camera's coordinate system.</param>
+        /// <param name="numPoints">Number of points to convert. If negative, all provided points are converted. Limited
+        ///                         by the sizes of the provided arrays.</param>
+        public void WorldToViewPoints(Vector3[] worldPoints, Vector3[] viewPoints, int numPoints = -1)
+        {
+            numPoints = GetNumPoints(worldPoints, viewPoints, null, numPoints);
+            if (numPoints == 0)
+                return;
+
+            CameraConversions.Internal_WorldToViewPoints(mCachedPtr, worldPoints, numPoints, viewPoints);
+        }
+
+        /// <summary>
+        /// Converts many points from screen space to world space in a single call. Equivalent to calling
+        /// <see cref="ScreenToWorldPoint"/> for each point.
+        /// </summary>
+        /// <param name="screenPoints">2D points on the render target attached to the camera's viewport, in pixels.
+        ///                            </param>
+        /// <param name="worldPoints">Array to receive the 3D points in world space.</param>
+        /// <param name="depth">Depth to place the world points at, in world coordinates. The depth is applied to the
+        ///                     vector going from camera origin to the point on the near plane.</param>
+        /// <param name="numPoints">Number of points to convert. If negative, all provided points are converted. Limited
+        ///                         by the sizes of the provided arrays.</param>
+        public void ScreenToWorldPoints(Vector2I[] screenPoints, Vector3[] worldPoints, float depth = 0.5f,
+            int numPoints = -1)
+        {
+            numPoints = GetNumPoints(screenPoints, worldPoints, null, numPoints);
+            if (numPoints == 0)
+                return;
+
+            CameraConversions.Internal_ScreenToWorldPoints(mCachedPtr, screenPoints, depth, numPoints, worldPoints);
+        }
+
+        /// <summary>
+        /// Converts many points from screen space to rays in world space in a single call. Equivalent to calling
+        /// <see cref="ScreenPointToRay"/> for each point.
+        /// </summary>
+        /// <param name="screenPoints">2D points on the render target attached to the camera's viewport, in pixels.
+        ///                            </param>
+        /// <param name="rays">Array to receive the rays in world space, originating at the points on the near plane.
+        ///                    </param>
+        /// <param name="numPoints">Number of points to convert. If negative, all provided points are converted. Limited
+        ///                         by the sizes of the provided arrays.</param>
+        public void ScreenPointsToRays(Vector2I[] screenPoints, Ray[] rays, int numPoints = -1)
+        {
+            numPoints = GetNumPoints(screenPoints, rays, null, numPoints);
+            if (numPoints == 0)
+                return;
+
+            CameraConversions.Internal_ScreenPointsToRays(mCachedPtr, screenPoints, numPoints, rays);
+        }
+
+        /// <summary>
+        /// Limits the requested number of points to the sizes of the provided arrays.
+        /// </summary>
+        /// <param name="input">Array containing the points to convert.</param>
+        /// <param name="output">Array to receive the converted points.</param>
+        /// <param name="visible">Optional array to receive the visibility flags.</param>
+        /// <param name="numPoints">Requested number of points, or negative to convert all provided points.</param>
+        /// <returns>Number of points that can be converted.</returns>
+        private static int GetNumPoints(Array input, Array output, Array visible, int numPoints)
+        {
+            if (input == null || output == null)
+                return 0;
+
+            if (numPoints < 0)
+                numPoints = input.Length;
+
+            numPoints = MathEx.Min(numPoints, input.Length);
+            numPoints = MathEx.Min(numPoints, output.Length);
+
+            if (visible != null)
+                numPoints = MathEx.Min(numPoints, visible.Length);
+
+            return numPoints;
+        }
+    }
+
+    /// <summary>
+    /// Performs batched conversions between camera coordinate spaces, as used by <see cref="Camera"/>.
+    /// </summary>
+    internal static class CameraConversions
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_WorldToScreenPoints(IntPtr thisPtr, Vector3[] worldPoints, int numPoints,
+            Vector2I[] screenPoints, bool[] visible);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_WorldToNdcPoints(IntPtr thisPtr, Vector3[] worldPoints, int numPoints,
+            Vector2[] ndcPoints, bool[] visible);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_WorldToViewPoints(IntPtr thisPtr, Vector3[] worldPoints, int numPoints,
+            Vector3[] viewPoints);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_ScreenToWorldPoints(IntPtr thisPtr, Vector2I[] screenPoints, float depth,
+            int numPoints, Vector3[] worldPoints);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_ScreenPointsToRays(IntPtr thisPtr, Vector2I[] screenPoints, int numPoints,
+            Ray[] rays);
+    }
+
+    /** @} */
+}
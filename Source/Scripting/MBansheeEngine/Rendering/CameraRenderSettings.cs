@@ -0,0 +1,242 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    /// <summary>
+    /// Groups of <see cref="RenderSettings"/> that can be modified independently through the camera.
+    /// </summary>
+    [Flags]
+    public enum RenderSettingsGroup
+    {
+        /// <summary>Exposure scale, gamma and the feature toggles.</summary>
+        General = 1 << 0,
+        /// <summary><see cref="RenderSettings.AutoExposure"/>.</summary>
+        AutoExposure = 1 << 1,
+        /// <summary><see cref="RenderSettings.Tonemapping"/>.</summary>
+        Tonemapping = 1 << 2,
+        /// <summary><see cref="RenderSettings.WhiteBalance"/>.</summary>
+        WhiteBalance = 1 << 3,
+        /// <summary><see cref="RenderSettings.ColorGrading"/>.</summary>
+        ColorGrading = 1 << 4,
+        /// <summary><see cref="RenderSettings.DepthOfField"/>.</summary>
+        DepthOfField = 1 << 5,
+        /// <summary><see cref="RenderSettings.AmbientOcclusion"/>.</summary>
+        AmbientOcclusion = 1 << 6,
+        /// <summary><see cref="RenderSettings.ScreenSpaceReflections"/>.</summary>
+        ScreenSpaceReflections = 1 << 7,
+        /// <summary><see cref="RenderSettings.ShadowSettings"/>.</summary>
+        Shadows = 1 << 8
+    }
+
+    /// <summary>
+    /// Boolean toggles in <see cref="RenderSettings"/> that can be set through <see cref="Camera.SetRenderFeature"/>.
+    /// </summary>
+    public enum RenderFeature
+    {
+        /// <summary><see cref="RenderSettings.EnableAutoExposure"/>.</summary>
+        AutoExposure,
+        /// <summary><see cref="RenderSettings.EnableTonemapping"/>.</summary>
+        Tonemapping,
+        /// <summary><see cref="RenderSettings.EnableFXAA"/>.</summary>
+        FXAA,
+        /// <summary><see cref="RenderSettings.EnableHDR"/>.</summary>
+        HDR,
+        /// <summary><see cref="RenderSettings.EnableLighting"/>.</summary>
+        Lighting,
+        /// <summary><see cref="RenderSettings.EnableShadows"/>.</summary>
+        Shadows,
+        /// <summary><see cref="RenderSettings.EnableIndirectLighting"/>.</summary>
+        IndirectLighting,
+        /// <summary><see cref="RenderSettings.EnableSkybox"/>.</summary>
+        Skybox,
+        /// <summary><see cref="RenderSettings.OverlayOnly"/>.</summary>
+        OverlayOnly
+    }
+
+    public partial class Camera
+    {
+        /// <summary>
+        /// Sets <see cref="RenderSettings.ExposureScale"/> without converting the rest of the camera's render settings.
+        /// Changes made through this and the other <c>Set*</c> methods are applied to the camera once at the end of the
+        /// frame (or on <see cref="ApplyRenderSettings"/>), so they are not visible through
+        /// <see cref="RenderSettings"/> until then.
+        /// </summary>
+        /// <param name="value">Exposure scale to set.</param>
+        public void SetExposureScale(float value)
+        {
+            CameraRenderSettings.Internal_SetExposureScale(mCachedPtr, value);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.Gamma"/>. See <see cref="SetExposureScale"/> for when the change is applied.
+        /// </summary>
+        /// <param name="value">Gamma value to set.</param>
+        public void SetGamma(float value)
+        {
+            CameraRenderSettings.Internal_SetGamma(mCachedPtr, value);
+        }
+
+        /// <summary>
+        /// Enables or disables a rendering feature. See <see cref="SetExposureScale"/> for when the change is applied.
+        /// </summary>
+        /// <param name="feature">Feature to toggle.</param>
+        /// <param name="enabled">True to enable the feature, false to disable it.</param>
+        public void SetRenderFeature(RenderFeature feature, bool enabled)
+        {
+            CameraRenderSettings.Internal_SetFeatureEnabled(mCachedPtr, feature, enabled);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.AutoExposure"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetAutoExposure(AutoExposureSettings settings)
+        {
+            CameraRenderSettings.Internal_SetAutoExposure(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.Tonemapping"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetTonemapping(TonemappingSettings settings)
+        {
+            CameraRenderSettings.Internal_SetTonemapping(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.WhiteBalance"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetWhiteBalance(WhiteBalanceSettings settings)
+        {
+            CameraRenderSettings.Internal_SetWhiteBalance(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.ColorGrading"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetColorGrading(ColorGradingSettings settings)
+        {
+            CameraRenderSettings.Internal_SetColorGrading(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.DepthOfField"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetDepthOfField(DepthOfFieldSettings settings)
+        {
+            CameraRenderSettings.Internal_SetDepthOfField(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.AmbientOcclusion"/>. See <see cref="SetExposureScale"/> for when the change
+        /// is applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetAmbientOcclusion(AmbientOcclusionSettings settings)
+        {
+            CameraRenderSettings.Internal_SetAmbientOcclusion(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.ScreenSpaceReflections"/>. See <see cref="SetExposureScale"/> for when the
+        /// change is applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetScreenSpaceReflections(ScreenSpaceReflectionsSettings settings)
+        {
+            CameraRenderSettings.Internal_SetScreenSpaceReflections(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Sets <see cref="RenderSettings.ShadowSettings"/>. See <see cref="SetExposureScale"/> for when the change is
+        /// applied.
+        /// </summary>
+        /// <param name="settings">Settings to copy.</param>
+        public void SetShadowSettings(ShadowSettings settings)
+        {
+            CameraRenderSettings.Internal_SetShadowSettings(mCachedPtr, settings);
+        }
+
+        /// <summary>
+        /// Groups of render settings modified through the <c>Set*</c> methods that haven't been applied to the camera
+        /// yet.
+        /// </summary>
+        public RenderSettingsGroup DirtyRenderSettings
+        {
+            get { return (RenderSettingsGroup)CameraRenderSettings.Internal_GetDirtyGroups(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Immediately applies any render settings modified through the <c>Set*</c> methods, instead of waiting for
+        /// the end of the frame.
+        /// </summary>
+        public void ApplyRenderSettings()
+        {
+            CameraRenderSettings.Internal_Apply(mCachedPtr);
+        }
+    }
+
+    /// <summary>
+    /// Performs fine-grained modification of camera render settings, as used by <see cref="Camera"/>.
+    /// </summary>
+    internal static class CameraRenderSettings
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetExposureScale(IntPtr thisPtr, float value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetGamma(IntPtr thisPtr, float value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetFeatureEnabled(IntPtr thisPtr, RenderFeature feature, bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetAutoExposure(IntPtr thisPtr, AutoExposureSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetTonemapping(IntPtr thisPtr, TonemappingSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetWhiteBalance(IntPtr thisPtr, WhiteBalanceSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetColorGrading(IntPtr thisPtr, ColorGradingSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetDepthOfField(IntPtr thisPtr, DepthOfFieldSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetAmbientOcclusion(IntPtr thisPtr, AmbientOcclusionSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetScreenSpaceReflections(IntPtr thisPtr,
+            ScreenSpaceReflectionsSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetShadowSettings(IntPtr thisPtr, ShadowSettings value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetDirtyGroups(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_Apply(IntPtr thisPtr);
+    }
+
+    /** @} */
+}
@@ -0,0 +1,451 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    /// <summary>
+    /// Handle to a single parameter of a <see cref="Material"/>. The parameter is looked up once when the handle is
+    /// created, after which it can be read and written without any name lookups. This makes handles the preferred way
+    /// of accessing parameters that change often, such as those animated every frame.
+    ///
+    /// Handles become invalid if the shader of their material changes, in which case they need to be retrieved again.
+    /// </summary>
+    public abstract class MaterialParam : ScriptObject
+    {
+        /// <summary>
+        /// Creates the native parameter handle.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        /// <param name="type">Type of the parameter.</param>
+        internal MaterialParam(Material material, string name, MaterialParamType type)
+        {
+            Internal_Create(this, material.GetCachedPtr(), name, type);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple floating point parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamFloat[] parameters, float[] values)
+        {
+            Internal_SetFloats(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple color parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamColor[] parameters, Color[] values)
+        {
+            Internal_SetColors(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple 2D vector parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamVector2[] parameters, Vector2[] values)
+        {
+            Internal_SetVec2s(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple 3D vector parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamVector3[] parameters, Vector3[] values)
+        {
+            Internal_SetVec3s(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple 4D vector parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamVector4[] parameters, Vector4[] values)
+        {
+            Internal_SetVec4s(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple 3x3 matrix parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamMatrix3[] parameters, Matrix3[] values)
+        {
+            Internal_SetMat3s(parameters, values);
+        }
+
+        /// <summary>
+        /// Assigns values to multiple 4x4 matrix parameters at once. Parameters can belong to different materials.
+        /// </summary>
+        /// <param name="parameters">Parameters to assign the values to.</param>
+        /// <param name="values">Values to assign, one for each entry in <paramref name="parameters"/>.</param>
+        public static void SetValues(MaterialParamMatrix4[] parameters, Matrix4[] values)
+        {
+            Internal_SetMat4s(parameters, values);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Create(MaterialParam instance, IntPtr material, string name,
+            MaterialParamType type);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetFloat(IntPtr thisPtr, float value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern float Internal_GetFloat(IntPtr thisPtr, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetColor(IntPtr thisPtr, ref Color value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetColor(IntPtr thisPtr, uint arrayIdx, out Color output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetVec2(IntPtr thisPtr, ref Vector2 value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetVec2(IntPtr thisPtr, uint arrayIdx, out Vector2 output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetVec3(IntPtr thisPtr, ref Vector3 value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetVec3(IntPtr thisPtr, uint arrayIdx, out Vector3 output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetVec4(IntPtr thisPtr, ref Vector4 value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetVec4(IntPtr thisPtr, uint arrayIdx, out Vector4 output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetMat3(IntPtr thisPtr, ref Matrix3 value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetMat3(IntPtr thisPtr, uint arrayIdx, out Matrix3 output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetMat4(IntPtr thisPtr, ref Matrix4 value, uint arrayIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetMat4(IntPtr thisPtr, uint arrayIdx, out Matrix4 output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetTexture(IntPtr thisPtr, RRef<Texture> value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern RRef<Texture> Internal_GetTexture(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetFloats(MaterialParamFloat[] parameters, float[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetColors(MaterialParamColor[] parameters, Color[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVec2s(MaterialParamVector2[] parameters, Vector2[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVec3s(MaterialParamVector3[] parameters, Vector3[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVec4s(MaterialParamVector4[] parameters, Vector4[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMat3s(MaterialParamMatrix3[] parameters, Matrix3[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMat4s(MaterialParamMatrix4[] parameters, Matrix4[] values);
+    }
+
+    /// <summary>
+    /// Handle to a material parameter of a specific type. See <see cref="MaterialParam"/>.
+    /// </summary>
+    /// <typeparam name="T">Type of the value stored in the parameter.</typeparam>
+    public abstract class MaterialParam<T> : MaterialParam
+    {
+        /// <inheritdoc/>
+        internal MaterialParam(Material material, string name, MaterialParamType type)
+            : base(material, name, type)
+        { }
+
+        /// <summary>
+        /// Assigns a value to the parameter.
+        /// </summary>
+        /// <param name="value">Value to assign.</param>
+        /// <param name="arrayIdx">Index of the element to assign, if the parameter is an array.</param>
+        public abstract void Set(T value, int arrayIdx = 0);
+
+        /// <summary>
+        /// Returns the current value of the parameter.
+        /// </summary>
+        /// <param name="arrayIdx">Index of the element to return, if the parameter is an array.</param>
+        /// <returns>Value of the parameter.</returns>
+        public abstract T Get(int arrayIdx = 0);
+    }
+
+    /// <summary>
+    /// Handle to a floating point material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamFloat : MaterialParam<float>
+    {
+        /// <summary>
+        /// Retrieves a handle to a floating point parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamFloat(Material material, string name)
+            : base(material, name, MaterialParamType.Float)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(float value, int arrayIdx = 0)
+        {
+            Internal_SetFloat(mCachedPtr, value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override float Get(int arrayIdx = 0)
+        {
+            return Internal_GetFloat(mCachedPtr, (uint)arrayIdx);
+        }
+    }
+
+    /// <summary>
+    /// Handle to a color material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamColor : MaterialParam<Color>
+    {
+        /// <summary>
+        /// Retrieves a handle to a color parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamColor(Material material, string name)
+            : base(material, name, MaterialParamType.Color)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Color value, int arrayIdx = 0)
+        {
+            Internal_SetColor(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Color Get(int arrayIdx = 0)
+        {
+            Color output;
+            Internal_GetColor(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a 2D vector material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamVector2 : MaterialParam<Vector2>
+    {
+        /// <summary>
+        /// Retrieves a handle to a 2D vector parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamVector2(Material material, string name)
+            : base(material, name, MaterialParamType.Vec2)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Vector2 value, int arrayIdx = 0)
+        {
+            Internal_SetVec2(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Vector2 Get(int arrayIdx = 0)
+        {
+            Vector2 output;
+            Internal_GetVec2(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a 3D vector material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamVector3 : MaterialParam<Vector3>
+    {
+        /// <summary>
+        /// Retrieves a handle to a 3D vector parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamVector3(Material material, string name)
+            : base(material, name, MaterialParamType.Vec3)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Vector3 value, int arrayIdx = 0)
+        {
+            Internal_SetVec3(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Vector3 Get(int arrayIdx = 0)
+        {
+            Vector3 output;
+            Internal_GetVec3(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a 4D vector material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamVector4 : MaterialParam<Vector4>
+    {
+        /// <summary>
+        /// Retrieves a handle to a 4D vector parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamVector4(Material material, string name)
+            : base(material, name, MaterialParamType.Vec4)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Vector4 value, int arrayIdx = 0)
+        {
+            Internal_SetVec4(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Vector4 Get(int arrayIdx = 0)
+        {
+            Vector4 output;
+            Internal_GetVec4(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a 3x3 matrix material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamMatrix3 : MaterialParam<Matrix3>
+    {
+        /// <summary>
+        /// Retrieves a handle to a 3x3 matrix parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamMatrix3(Material material, string name)
+            : base(material, name, MaterialParamType.Mat3)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Matrix3 value, int arrayIdx = 0)
+        {
+            Internal_SetMat3(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Matrix3 Get(int arrayIdx = 0)
+        {
+            Matrix3 output;
+            Internal_GetMat3(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a 4x4 matrix material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamMatrix4 : MaterialParam<Matrix4>
+    {
+        /// <summary>
+        /// Retrieves a handle to a 4x4 matrix parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamMatrix4(Material material, string name)
+            : base(material, name, MaterialParamType.Mat4)
+        { }
+
+        /// <inheritdoc/>
+        public override void Set(Matrix4 value, int arrayIdx = 0)
+        {
+            Internal_SetMat4(mCachedPtr, ref value, (uint)arrayIdx);
+        }
+
+        /// <inheritdoc/>
+        public override Matrix4 Get(int arrayIdx = 0)
+        {
+            Matrix4 output;
+            Internal_GetMat4(mCachedPtr, (uint)arrayIdx, out output);
+            return output;
+        }
+    }
+
+    /// <summary>
+    /// Handle to a texture material parameter. See <see cref="MaterialParam"/>.
+    /// </summary>
+    public sealed class MaterialParamTexture : MaterialParam<RRef<Texture>>
+    {
+        /// <summary>
+        /// Retrieves a handle to a texture parameter of the provided material.
+        /// </summary>
+        /// <param name="material">Material whose parameter to retrieve.</param>
+        /// <param name="name">Name of the parameter.</param>
+        public MaterialParamTexture(Material material, string name)
+            : base(material, name, MaterialParamType.Texture)
+        { }
+
+        /// <summary>
+        /// Assigns a texture to the parameter.
+        /// </summary>
+        /// <param name="value">Texture to assign.</param>
+        /// <param name="arrayIdx">Ignored, texture parameters cannot be arrays.</param>
+        public override void Set(RRef<Texture> value, int arrayIdx = 0)
+        {
+            Internal_SetTexture(mCachedPtr, value);
+        }
+
+        /// <summary>
+        /// Returns the texture currently assigned to the parameter.
+        /// </summary>
+        /// <param name="arrayIdx">Ignored, texture parameters cannot be arrays.</param>
+        /// <returns>Assigned texture.</returns>
+        public override RRef<Texture> Get(int arrayIdx = 0)
+        {
+            return Internal_GetTexture(mCachedPtr);
+        }
+    }
+
+    /** @cond INTEROP */
+
+    /// <summary>
+    /// Types of parameters a <see cref="MaterialParam"/> can reference.
+    /// </summary>
+    internal enum MaterialParamType // Note: Must match C++ enum ScriptMaterialParamType
+    {
+        Float, Color, Vec2, Vec3, Vec4, Mat3, Mat4, Texture
+    }
+
+    /** @endcond */
+
+    /** @} */
+}
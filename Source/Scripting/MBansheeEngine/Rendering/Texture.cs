@@ -75,6 +75,54 @@ namespace BansheeEngine
 
             return texture;
         }
+
+        /// <summary>
+        /// Returns the size of a texture surface in bytes, in the texture's native pixel format.
+        /// </summary>
+        /// <param name="face">Face of the surface. Cubemap textures have six faces whose face indices are as
+        ///                    specified in the <see cref="CubeFace"/> enum. Array textures can have an arbitrary number
+        ///                    of faces.</param>
+        /// <param name="mipLevel">Mip level of the surface. Top level (0) is the highest quality.</param>
+        /// <returns>Size of the surface in bytes, or zero if the surface doesn't exist.</returns>
+        public int GetRawPixelsSize(uint face = 0, uint mipLevel = 0)
+        {
+            return TextureStagingBuffer.Internal_GetRawSize(mCachedPtr, face, mipLevel);
+        }
+
+        /// <summary>
+        /// Sets pixels of a texture surface in the texture's native pixel format, including compressed formats.
+        /// Unlike <see cref="SetPixels(Color[], uint, uint)"/> no pixel format conversion is performed. Use
+        /// <see cref="TextureStagingBuffer"/> for textures updated every frame, or updated one region at a time.
+        /// </summary>
+        /// <param name="data">Pixels of the surface, laid out row by row (by rows of 4x4 blocks for compressed
+        ///                    formats). Must contain at least <see cref="GetRawPixelsSize"/> bytes.</param>
+        /// <param name="face">Face of the surface. Cubemap textures have six faces whose face indices are as
+        ///                    specified in the <see cref="CubeFace"/> enum. Array textures can have an arbitrary number
+        ///                    of faces.</param>
+        /// <param name="mipLevel">Mip level of the surface. Top level (0) is the highest quality.</param>
+        /// <returns>True if the pixels were written, false if the surface doesn't exist or the data is too small.
+        ///          </returns>
+        public bool SetRawPixels(byte[] data, uint face = 0, uint mipLevel = 0)
+        {
+            return TextureStagingBuffer.Internal_SetRawPixels(mCachedPtr, data, face, mipLevel);
+        }
+
+        /// <summary>
+        /// Reads pixels of a texture surface in the texture's native pixel format into a caller provided buffer,
+        /// which can be reused between calls. Pixels are read from system memory, meaning the texture has to be
+        /// created with <see cref="TextureUsage.CPUCached"/>.
+        /// </summary>
+        /// <param name="output">Buffer to receive the pixels. Must contain at least <see cref="GetRawPixelsSize"/>
+        ///                      bytes.</param>
+        /// <param name="face">Face of the surface. Cubemap textures have six faces whose face indices are as
+        ///                    specified in the <see cref="CubeFace"/> enum. Array textures can have an arbitrary number
+        ///                    of faces.</param>
+        /// <param name="mipLevel">Mip level of the surface. Top level (0) is the highest quality.</param>
+        /// <returns>True if the pixels were read, false otherwise.</returns>
+        public bool GetRawPixels(byte[] output, uint face = 0, uint mipLevel = 0)
+        {
+            return TextureStagingBuffer.Internal_GetRawPixels(mCachedPtr, output, face, mipLevel);
+        }
     }
 
     /// <summary>
@@ -0,0 +1,109 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    /// <summary>
+    /// Reads a single texture surface from the GPU, in the texture's native pixel format. Reads are performed into a
+    /// ring of buffers that are allocated once and then reused, and multiple reads can be in flight at once. This
+    /// allows scripts that need the texture contents every frame (e.g. screenshots or results of GPU computations) to
+    /// issue a read each frame and retrieve the results a few frames later, without stalling the GPU or allocating any
+    /// memory.
+    ///
+    /// Typical use is to call <see cref="Request"/> once per frame, and <see cref="TryGetResult"/> to retrieve the most
+    /// recent completed read, if any.
+    /// </summary>
+    public sealed class TextureReadback : ScriptObject
+    {
+        /// <summary>
+        /// Creates a new readback ring for the specified texture surface.
+        /// </summary>
+        /// <param name="texture">Texture to read from.</param>
+        /// <param name="face">Face of the texture to read. Cubemap textures have six faces whose face indices are as
+        ///                    specified in the <see cref="CubeFace"/> enum. Array textures can have an arbitrary number
+        ///                    of faces.</param>
+        /// <param name="mipLevel">Mip level to read. Top level (0) is the highest quality.</param>
+        /// <param name="framesInFlight">Maximum number of reads that can be in progress at once. Each read requires its
+        ///                              own buffer. Higher values allow the results to arrive later without missing any
+        ///                              requests, at the cost of memory.</param>
+        public TextureReadback(Texture texture, uint face = 0, uint mipLevel = 0, int framesInFlight = 3)
+        {
+            Internal_Create(this, texture.GetCachedPtr(), face, mipLevel, (uint)MathEx.Max(framesInFlight, 1));
+        }
+
+        /// <summary>
+        /// Size of a single read result in bytes. Zero if the readback couldn't be created for the provided surface.
+        /// </summary>
+        public int ResultSize
+        {
+            get { return Internal_GetResultSize(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Number of requested reads that haven't completed yet.
+        /// </summary>
+        public int NumPending
+        {
+            get { return Internal_GetNumPending(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Checks if a completed read is available for retrieval through <see cref="TryGetResult"/>.
+        /// </summary>
+        public bool IsResultAvailable
+        {
+            get { return Internal_IsResultAvailable(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Queues a read of the current texture contents. The read completes at some point after the GPU finishes all
+        /// rendering queued before it, usually a frame or two later.
+        /// </summary>
+        /// <returns>True if the read was queued, or false if the maximum number of reads is already in flight.
+        ///          </returns>
+        public bool Request()
+        {
+            return Internal_Request(mCachedPtr);
+        }
+
+        /// <summary>
+        /// Copies the result of the most recent completed read into the provided array. Results of any older reads
+        /// that completed in the meantime are discarded.
+        /// </summary>
+        /// <param name="output">Array to receive the pixels. Must contain at least <see cref="ResultSize"/> bytes.
+        ///                      </param>
+        /// <returns>True if a result was copied, false if no read has completed yet or the array is too small.
+        ///          </returns>
+        public bool TryGetResult(byte[] output)
+        {
+            return Internal_TryGetResult(mCachedPtr, output);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Create(TextureReadback instance, IntPtr texture, uint face, uint mipLevel,
+            uint framesInFlight);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetResultSize(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetNumPending(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsResultAvailable(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_Request(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_TryGetResult(IntPtr thisPtr, byte[] output);
+    }
+
+    /** @} */
+}
@@ -0,0 +1,123 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    /// <summary>
+    /// Keeps a copy of a single texture surface in the texture's native pixel format, allowing the surface to be
+    /// updated as a whole or one region at a time, and then uploaded to the texture. Buffers used for uploading are
+    /// reused, so textures that change every frame (e.g. minimaps or video) can be updated without any allocations or
+    /// pixel format conversions.
+    ///
+    /// Data is expected in the texture's <see cref="Texture.PixelFormat"/>, laid out row by row. For compressed formats
+    /// each row is a row of 4x4 pixel blocks.
+    /// </summary>
+    public sealed class TextureStagingBuffer : ScriptObject
+    {
+        /// <summary>
+        /// Creates a new staging buffer for the specified texture surface. Initial contents of the buffer are zeroed.
+        /// </summary>
+        /// <param name="texture">Texture the buffer is uploaded to.</param>
+        /// <param name="face">Face of the texture to upload to. Cubemap textures have six faces whose face indices are
+        ///                    as specified in the <see cref="CubeFace"/> enum. Array textures can have an arbitrary
+        ///                    number of faces.</param>
+        /// <param name="mipLevel">Mip level to upload to. Top level (0) is the highest quality.</param>
+        public TextureStagingBuffer(Texture texture, uint face = 0, uint mipLevel = 0)
+        {
+            Internal_Create(this, texture.GetCachedPtr(), face, mipLevel);
+        }
+
+        /// <summary>
+        /// Size of the texture surface in bytes. Zero if the buffer couldn't be created for the provided surface.
+        /// </summary>
+        public int Size
+        {
+            get { return Internal_GetSize(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Number of bytes in a single row of the texture surface (a row of blocks for compressed formats).
+        /// </summary>
+        public int RowPitch
+        {
+            get { return Internal_GetRowPitch(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Replaces the contents of the entire surface.
+        /// </summary>
+        /// <param name="data">Pixels of the surface. Must contain at least <see cref="Size"/> bytes.</param>
+        /// <returns>True if the data was written, false if it was too small.</returns>
+        public bool Write(byte[] data)
+        {
+            return Internal_Write(mCachedPtr, data);
+        }
+
+        /// <summary>
+        /// Replaces the contents of a rectangular region of the surface. For compressed formats the region must be
+        /// aligned to 4x4 pixel blocks, except where it touches the right or bottom edge of the surface. Only supported
+        /// for 2D surfaces.
+        /// </summary>
+        /// <param name="data">Pixels of the region, laid out row by row.</param>
+        /// <param name="dataRowPitch">Number of bytes between the starts of two consecutive rows in
+        ///                            <paramref name="data"/>. Zero if rows are tightly packed.</param>
+        /// <param name="x">Horizontal position of the region, in pixels.</param>
+        /// <param name="y">Vertical position of the region, in pixels.</param>
+        /// <param name="width">Width of the region, in pixels.</param>
+        /// <param name="height">Height of the region, in pixels.</param>
+        /// <returns>True if the data was written, false if the region or the data is invalid.</returns>
+        public bool WriteRegion(byte[] data, int dataRowPitch, int x, int y, int width, int height)
+        {
+            if (dataRowPitch < 0 || x < 0 || y < 0 || width <= 0 || height <= 0)
+                return false;
+
+            return Internal_WriteRegion(mCachedPtr, data, dataRowPitch, x, y, width, height);
+        }
+
+        /// <summary>
+        /// Uploads the buffer to the texture. Does nothing if the buffer wasn't written to since the last upload.
+        /// Upload happens asynchronously, but the buffer can be written to immediately after the call.
+        /// </summary>
+        public void Upload()
+        {
+            Internal_Upload(mCachedPtr);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Create(TextureStagingBuffer instance, IntPtr texture, uint face,
+            uint mipLevel);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetSize(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetRowPitch(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_Write(IntPtr thisPtr, byte[] data);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_WriteRegion(IntPtr thisPtr, byte[] data, int dataRowPitch, int x, int y,
+            int width, int height);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Upload(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetRawSize(IntPtr texture, uint face, uint mipLevel);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_SetRawPixels(IntPtr texture, byte[] data, uint face, uint mipLevel);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_GetRawPixels(IntPtr texture, byte[] output, uint face, uint mipLevel);
+    }
+
+    /** @} */
+}
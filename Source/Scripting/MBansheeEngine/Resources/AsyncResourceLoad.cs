@@ -0,0 +1,160 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Resources
+     *  @{
+     */
+
+    /// <summary>
+    /// Represents a resource being loaded asynchronously, as started by <see cref="Resources.LoadAsync{T}"/>. You can
+    /// poll the object for completion, subscribe to <see cref="OnLoaded"/>, or await it from an async method.
+    /// Completion is always reported on the main thread.
+    /// </summary>
+    public class AsyncResourceLoad : INotifyCompletion
+    {
+        internal int id;
+        internal Resource resource;
+        private bool isCompleted;
+        private Action continuations;
+
+        /// <summary>
+        /// Triggered when the resource finishes loading, or if it fails to load.
+        /// </summary>
+        public event Action<AsyncResourceLoad> OnLoaded;
+
+        /// <summary>
+        /// Checks has the load finished. If true the <see cref="Resource"/> is available.
+        /// </summary>
+        public bool IsCompleted
+        {
+            get { return isCompleted; }
+        }
+
+        /// <summary>
+        /// Returns the load progress in range [0, 1], including the resource's dependencies.
+        /// </summary>
+        public float Progress
+        {
+            get
+            {
+                if (isCompleted)
+                    return 1.0f;
+
+                return Resources.GetAsyncLoadProgress(id);
+            }
+        }
+
+        /// <summary>
+        /// Returns the loaded resource. Null if the load hasn't completed, or if the resource couldn't be loaded.
+        /// </summary>
+        public Resource Resource
+        {
+            get { return resource; }
+        }
+
+        /// <summary>
+        /// Creates a new asynchronous load object.
+        /// </summary>
+        /// <param name="id">Identifier of the load, as returned by the runtime.</param>
+        internal AsyncResourceLoad(int id)
+        {
+            this.id = id;
+        }
+
+        /// <summary>
+        /// Allows the object to be used with the await operator.
+        /// </summary>
+        /// <returns>Awaiter object for the load.</returns>
+        public AsyncResourceLoad GetAwaiter()
+        {
+            return this;
+        }
+
+        /// <summary>
+        /// Returns the loaded resource once the load completes. Used by the await operator.
+        /// </summary>
+        /// <returns>Loaded resource, or null if the resource couldn't be loaded.</returns>
+        public Resource GetResult()
+        {
+            return resource;
+        }
+
+        /// <inheritdoc/>
+        void INotifyCompletion.OnCompleted(Action continuation)
+        {
+            if (isCompleted)
+                continuation();
+            else
+                continuations += continuation;
+        }
+
+        /// <summary>
+        /// Marks the load as completed and notifies any listeners.
+        /// </summary>
+        /// <param name="resource">Loaded resource, or null if the load failed.</param>
+        internal void Complete(Resource resource)
+        {
+            this.resource = resource;
+            isCompleted = true;
+
+            if (OnLoaded != null)
+                OnLoaded(this);
+
+            if (continuations != null)
+            {
+                Action toCall = continuations;
+                continuations = null;
+
+                toCall();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Represents a resource of a specific type being loaded asynchronously. See <see cref="AsyncResourceLoad"/>.
+    /// </summary>
+    /// <typeparam name="T">Type of the resource being loaded.</typeparam>
+    public sealed class AsyncResourceLoad<T> : AsyncResourceLoad where T : Resource
+    {
+        /// <summary>
+        /// Returns the loaded resource. Null if the load hasn't completed, or if the resource couldn't be loaded as
+        /// the requested type.
+        /// </summary>
+        public new T Resource
+        {
+            get { return resource as T; }
+        }
+
+        /// <summary>
+        /// Creates a new asynchronous load object.
+        /// </summary>
+        /// <param name="id">Identifier of the load, as returned by the runtime.</param>
+        internal AsyncResourceLoad(int id)
+            : base(id)
+        { }
+
+        /// <summary>
+        /// Allows the object to be used with the await operator.
+        /// </summary>
+        /// <returns>Awaiter object for the load.</returns>
+        public new AsyncResourceLoad<T> GetAwaiter()
+        {
+            return this;
+        }
+
+        /// <summary>
+        /// Returns the loaded resource once the load completes. Used by the await operator.
+        /// </summary>
+        /// <returns>Loaded resource, or null if the resource couldn't be loaded as the requested type.</returns>
+        public new T GetResult()
+        {
+            return resource as T;
+        }
+    }
+
+    /** @} */
+}
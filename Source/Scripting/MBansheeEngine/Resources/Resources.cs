@@ -1,6 +1,7 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
 using System.Runtime.CompilerServices;
 
 namespace BansheeEngine
@@ -14,6 +15,18 @@ namespace BansheeEngine
     /// </summary>
     public static class Resources
     {
+        private static Dictionary<int, AsyncResourceLoad> asyncLoads = new Dictionary<int, AsyncResourceLoad>();
+
+        /// <summary>
+        /// Maximum number of asynchronously loaded resources that will be finalized and reported as loaded in a single
+        /// frame. Loads that finish beyond the budget are reported in the following frames. Zero means no limit.
+        /// </summary>
+        public static int AsyncLoadBudget
+        {
+            get { return (int)Internal_GetAsyncLoadBudget(); }
+            set { Internal_SetAsyncLoadBudget((uint)Math.Max(value, 0)); }
+        }
+
         /// <summary>
         /// Loads a resource at the specified path. If running outside of the editor you must make sure to mark that 
         /// the resource gets included in the build. If running inside the editor this has similar functionality as
@@ -55,6 +68,29 @@ namespace BansheeEngine
             return (T)Internal_LoadFromUUID(ref uuid, keepLoaded);
         }
 
+        /// <summary>
+        /// Starts loading a resource with the specified UUID on a worker thread, without blocking the caller. Otherwise
+        /// behaves the same as <see cref="Load{T}(UUID, bool)"/>. If the same resource is already being loaded
+        /// asynchronously, the existing load is reused.
+        /// </summary>
+        /// <typeparam name="T">Type of the resource.</typeparam>
+        /// <param name="uuid">Unique identifier of the resource to load.</param>
+        /// <param name="keepLoaded">If true the system will keep the resource loaded even when it goes out of scope.
+        ///                          You must call <see cref="Release(Resource)"/> in order to allow the resource to be
+        ///                          unloaded (it must be called once for each corresponding load). </param>
+        /// <returns>Object that reports the progress of the load, and provides the resource once loaded. Completion is
+        ///          reported on the main thread, no more than <see cref="AsyncLoadBudget"/> resources per frame.
+        ///          </returns>
+        public static AsyncResourceLoad<T> LoadAsync<T>(UUID uuid, bool keepLoaded = true) where T : Resource
+        {
+            int id = (int)Internal_LoadAsync(ref uuid, keepLoaded);
+
+            AsyncResourceLoad<T> load = new AsyncResourceLoad<T>(id);
+            asyncLoads[id] = load;
+
+            return load;
+        }
+
         /// <summary>
         /// Releases an internal reference to the resource held by the resources system. This allows the resource
         ///	to be unloaded when it goes out of scope, if the resource was loaded with "keepLoaded" parameter.
@@ -98,6 +134,40 @@ namespace BansheeEngine
             Internal_UnloadUnused();
         }
 
+        /// <summary>
+        /// Returns the progress of an asynchronous load.
+        /// </summary>
+        /// <param name="id">Identifier of the load, as returned by the runtime.</param>
+        /// <returns>Load progress in range [0, 1].</returns>
+        internal static float GetAsyncLoadProgress(int id)
+        {
+            return Internal_GetAsyncLoadProgress((uint)id);
+        }
+
+        /// <summary>
+        /// Triggered by the runtime when an asynchronous load finishes.
+        /// </summary>
+        /// <param name="id">Identifier of the load, as returned by the runtime.</param>
+        /// <param name="resource">Loaded resource, or null if the resource couldn't be loaded.</param>
+        private static void Internal_OnAsyncLoadComplete(uint id, Resource resource)
+        {
+            AsyncResourceLoad load;
+            if (!asyncLoads.TryGetValue((int)id, out load))
+                return;
+
+            asyncLoads.Remove((int)id);
+            load.Complete(resource);
+        }
+
+        /// <summary>
+        /// Triggered by the runtime before the script assemblies are reloaded. In-progress asynchronous loads are
+        /// dropped by the runtime at that point, and will never be reported as complete.
+        /// </summary>
+        private static void ClearAsyncLoads()
+        {
+            asyncLoads.Clear();
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern Resource Internal_Load(string path, bool keepLoaded);
 
@@ -112,6 +182,18 @@ namespace BansheeEngine
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_UnloadUnused();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_LoadAsync(ref UUID uuid, bool keepLoaded);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetAsyncLoadProgress(uint id);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetAsyncLoadBudget();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetAsyncLoadBudget(uint budget);
     }
 
     /** @} */
@@ -128,6 +128,24 @@ namespace BansheeEngine
         protected ManagedComponent()
         { }
 
+        /// <summary>
+        /// Counter that is incremented whenever the component's state is modified by the native code (e.g. the
+        /// component is restored, deserialized, enabled or disabled), or one of its fields is written through a
+        /// <see cref="SerializableProperty"/>. Used for checking if a component needs to be refreshed.
+        /// </summary>
+        internal int ModificationCount
+        {
+            get { return (int)Internal_GetModificationCount(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Increments the <see cref="ModificationCount"/>.
+        /// </summary>
+        internal void NotifyModified()
+        {
+            Internal_NotifyModified(mCachedPtr);
+        }
+
         /// <inheritdoc/>
         protected internal override void Invoke(string name)
         {
@@ -136,6 +154,12 @@ namespace BansheeEngine
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_Invoke(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetModificationCount(IntPtr nativeInstance);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_NotifyModified(IntPtr nativeInstance);
     }
 
     /** @} */
@@ -0,0 +1,84 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Scene
+     *  @{
+     */
+
+    /// <summary>
+    /// Controls the lifetime of managed objects wrapping built-in components (e.g. <see cref="Renderable"/> or
+    /// <see cref="Camera"/>). Such objects are only created when a component is first accessed from managed code. If an
+    /// idle release time is set, objects that haven't been accessed from native code for that long are released
+    /// once no managed code references them anymore, and created again on the next access.
+    /// </summary>
+    public static class ComponentWrappers
+    {
+        /// <summary>
+        /// Time in seconds after which an unused managed object wrapping a built-in component may be released. Zero
+        /// means the objects are kept alive as long as their components exist.
+        /// </summary>
+        public static float IdleReleaseTime
+        {
+            get { return Internal_GetIdleReleaseTime(); }
+            set { Internal_SetIdleReleaseTime(value); }
+        }
+
+        /// <summary>
+        /// Returns the number of live managed objects wrapping built-in components, for each built-in component type.
+        /// </summary>
+        /// <returns>Statistics for every built-in component type that currently has live managed objects.</returns>
+        public static ComponentWrapperStats[] GetStats()
+        {
+            string[] typeNames;
+            uint[] numReferenced;
+            uint[] numIdle;
+            Internal_GetStats(out typeNames, out numReferenced, out numIdle);
+
+            ComponentWrapperStats[] stats = new ComponentWrapperStats[typeNames.Length];
+            for (int i = 0; i < stats.Length; i++)
+            {
+                stats[i].TypeName = typeNames[i];
+                stats[i].NumReferenced = (int)numReferenced[i];
+                stats[i].NumIdle = (int)numIdle[i];
+            }
+
+            return stats;
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetIdleReleaseTime();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetIdleReleaseTime(float seconds);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetStats(out string[] typeNames, out uint[] numReferenced,
+            out uint[] numIdle);
+    }
+
+    /// <summary>
+    /// Number of live managed objects wrapping built-in components of a single type.
+    /// </summary>
+    public struct ComponentWrapperStats
+    {
+        /// <summary>
+        /// Full name of the managed component type.
+        /// </summary>
+        public string TypeName;
+
+        /// <summary>
+        /// Number of objects strongly referenced by the native component.
+        /// </summary>
+        public int NumReferenced;
+
+        /// <summary>
+        /// Number of idle objects that will be released once no managed code references them.
+        /// </summary>
+        public int NumIdle;
+    }
+
+    /** @} */
+}
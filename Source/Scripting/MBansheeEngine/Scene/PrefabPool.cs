@@ -0,0 +1,196 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Scene
+     *  @{
+     */
+
+    /// <summary>
+    /// Recycles instances of a prefab. Released instances are deactivated and kept in the scene, and are handed out
+    /// again on the next spawn instead of instantiating the prefab. Their scene objects, components and managed
+    /// wrappers are reused, making this considerably faster than <see cref="Prefab.Instantiate"/> and
+    /// <see cref="SceneObject.Destroy"/> for objects that are spawned and despawned often (e.g. projectiles or
+    /// effects).
+    ///
+    /// Reused instances retain any state they had when released. Use <see cref="OnSpawn"/> and <see cref="OnRelease"/>
+    /// (or the OnEnable and OnDisable methods of their components) to reset it.
+    /// </summary>
+    public sealed class PrefabPool : ScriptObject
+    {
+        /// <summary>
+        /// Triggered when an instance is spawned, whether it was newly instantiated or reused.
+        /// </summary>
+        public event Action<SceneObject> OnSpawn;
+
+        /// <summary>
+        /// Triggered when an instance is released to the pool, before it is deactivated.
+        /// </summary>
+        public event Action<SceneObject> OnRelease;
+
+        /// <summary>
+        /// Creates a new pool for the specified prefab.
+        /// </summary>
+        /// <param name="prefab">Prefab to instantiate.</param>
+        /// <param name="maxFree">Maximum number of released instances kept for reuse. Instances released while the
+        ///                       pool is full are destroyed.</param>
+        public PrefabPool(Prefab prefab, int maxFree = 64)
+        {
+            Internal_Create(this, prefab.GetCachedPtr(), (uint)MathEx.Max(maxFree, 0));
+        }
+
+        /// <summary>
+        /// Statistics about the use of the pool.
+        /// </summary>
+        public PrefabPoolStats Stats
+        {
+            get
+            {
+                PrefabPoolStats stats;
+                Internal_GetStats(mCachedPtr, out stats);
+                return stats;
+            }
+        }
+
+        /// <summary>
+        /// Returns an active instance of the prefab, parented to the scene root. Reuses a released instance if one is
+        /// available, or instantiates a new one otherwise.
+        /// </summary>
+        /// <returns>Instance of the prefab, or null if the prefab isn't loaded.</returns>
+        public SceneObject Spawn()
+        {
+            SceneObject instance = Internal_Spawn(mCachedPtr);
+            if (instance != null && OnSpawn != null)
+                OnSpawn(instance);
+
+            return instance;
+        }
+
+        /// <summary>
+        /// Returns an active instance of the prefab, placed at the specified position and rotation. See
+        /// <see cref="Spawn()"/>.
+        /// </summary>
+        /// <param name="position">World position of the instance.</param>
+        /// <param name="rotation">World rotation of the instance.</param>
+        /// <returns>Instance of the prefab, or null if the prefab isn't loaded.</returns>
+        public SceneObject Spawn(Vector3 position, Quaternion rotation)
+        {
+            SceneObject instance = Internal_Spawn(mCachedPtr);
+            if (instance == null)
+                return null;
+
+            instance.Position = position;
+            instance.Rotation = rotation;
+
+            if (OnSpawn != null)
+                OnSpawn(instance);
+
+            return instance;
+        }
+
+        /// <summary>
+        /// Returns an instance spawned by this pool back to the pool. The instance is deactivated and moved to the
+        /// scene root, and must not be used by the caller afterwards.
+        /// </summary>
+        /// <param name="instance">Instance to release.</param>
+        /// <returns>True if the instance was released, false if it wasn't spawned by this pool or was already released.
+        ///          </returns>
+        public bool Release(SceneObject instance)
+        {
+            if (instance == null)
+                return false;
+
+            IntPtr instancePtr = instance.GetCachedPtr();
+            if (!Internal_CanRelease(mCachedPtr, instancePtr))
+                return false;
+
+            if (OnRelease != null)
+                OnRelease(instance);
+
+            return Internal_Release(mCachedPtr, instancePtr);
+        }
+
+        /// <summary>
+        /// Instantiates inactive instances up front so later spawns don't need to, up to the maximum number of free
+        /// instances.
+        /// </summary>
+        /// <param name="count">Number of free instances the pool should contain.</param>
+        public void Prewarm(int count)
+        {
+            if (count > 0)
+                Internal_Prewarm(mCachedPtr, (uint)count);
+        }
+
+        /// <summary>
+        /// Destroys all released instances waiting in the pool. Spawned instances are not affected.
+        /// </summary>
+        public void Clear()
+        {
+            Internal_Clear(mCachedPtr);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Create(PrefabPool instance, IntPtr prefab, uint maxFree);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern SceneObject Internal_Spawn(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_CanRelease(IntPtr thisPtr, IntPtr instance);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_Release(IntPtr thisPtr, IntPtr instance);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Prewarm(IntPtr thisPtr, uint count);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Clear(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetStats(IntPtr thisPtr, out PrefabPoolStats stats);
+    }
+
+    /// <summary>
+    /// Statistics about the use of a <see cref="PrefabPool"/>.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PrefabPoolStats
+    {
+        /// <summary>
+        /// Number of instances instantiated from the prefab.
+        /// </summary>
+        public int NumCreated;
+
+        /// <summary>
+        /// Number of spawns served by a previously released instance.
+        /// </summary>
+        public int NumReused;
+
+        /// <summary>
+        /// Number of instances returned to the pool.
+        /// </summary>
+        public int NumReleased;
+
+        /// <summary>
+        /// Number of released instances destroyed because the pool was full.
+        /// </summary>
+        public int NumDiscarded;
+
+        /// <summary>
+        /// Number of instances currently spawned and not yet released or destroyed.
+        /// </summary>
+        public int NumActive;
+
+        /// <summary>
+        /// Number of released instances currently waiting in the pool.
+        /// </summary>
+        public int NumFree;
+    }
+
+    /** @} */
+}
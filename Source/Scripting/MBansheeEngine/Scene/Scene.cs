@@ -58,6 +58,31 @@ namespace BansheeEngine
             }
         }
 
+        /// <summary>
+        /// Determines should scene object names be indexed. When enabled, recursive calls to 
+        /// <see cref="SceneObject.FindChild"/>, <see cref="SceneObject.FindChildren"/> and 
+        /// <see cref="SceneObject.FindChildrenWithPrefix"/> look up the index instead of searching the hierarchy, which
+        /// is significantly faster for large scenes. 
+        /// 
+        /// The index tracks scene objects created, renamed or instantiated through scripts, as well as loaded scenes. 
+        /// Call <see cref="RefreshNameIndex"/> if scene objects were added or renamed by other means (e.g. native
+        /// plugins).
+        /// </summary>
+        public static bool NameIndexEnabled
+        {
+            get { return Internal_GetNameIndexEnabled(); }
+            set { Internal_SetNameIndexEnabled(value); }
+        }
+
+        /// <summary>
+        /// Rebuilds the scene object name index on the next query. Only relevant if <see cref="NameIndexEnabled"/> is
+        /// true.
+        /// </summary>
+        public static void RefreshNameIndex()
+        {
+            Internal_RefreshNameIndex();
+        }
+
         /// <summary>
         /// Clears all scene objects from the current scene.
         /// </summary>
@@ -160,6 +185,15 @@ namespace BansheeEngine
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern SceneObject Internal_GetMainCameraSO();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetNameIndexEnabled(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetNameIndexEnabled();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_RefreshNameIndex();
     }
 
     /** @} */
@@ -371,12 +371,27 @@ namespace BansheeEngine
         /// <param name="name">Name of the objects to locate.</param>
         /// <param name="recursive">If true all descendants of the scene object will be searched, otherwise only immediate 
         ///                         children.</param>
-        /// <returns>All scene objects matching the specified name.</returns>
+        /// <returns>All scene objects matching the specified name. If <see cref="Scene.NameIndexEnabled"/> is true
+        ///          and the search is recursive, objects are returned in the order they were created, otherwise in
+        ///          hierarchy order.</returns>
         public SceneObject[] FindChildren(string name, bool recursive = true)
         {
             return Internal_FindChildren(mCachedPtr, name, recursive);
         }
 
+        /// <summary>
+        /// Searches the child objects for objects whose name starts with the specified prefix.
+        /// </summary>
+        /// <param name="prefix">Prefix of the names of the objects to locate.</param>
+        /// <param name="recursive">If true all descendants of the scene object will be searched, otherwise only immediate 
+        ///                         children.</param>
+        /// <returns>All scene objects whose name starts with the specified prefix. Ordered the same as 
+        ///          <see cref="FindChildren"/>.</returns>
+        public SceneObject[] FindChildrenWithPrefix(string prefix, bool recursive = true)
+        {
+            return Internal_FindChildrenWithPrefix(mCachedPtr, prefix, recursive);
+        }
+
         /// <summary>
         /// Orients the object so it is looking at the provided location.
         /// </summary>
@@ -454,6 +469,102 @@ namespace BansheeEngine
             Internal_Pitch(mCachedPtr, ref radianAngle);
         }
 
+        /// <summary>
+        /// Retrieves world (or local) positions of multiple scene objects in a single call. Prefer this over querying
+        /// <see cref="Position"/> of each object individually when dealing with a large number of objects.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose positions to retrieve.</param>
+        /// <param name="positions">Pre-allocated array that will receive the positions. Must be the same size as
+        ///                         <paramref name="sceneObjects"/>.</param>
+        /// <param name="local">If true the local positions (relative to the parent) will be retrieved, otherwise world
+        ///                     positions.</param>
+        public static void GetPositions(SceneObject[] sceneObjects, Vector3[] positions, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, positions);
+            Internal_GetPositions(sceneObjects, positions, local);
+        }
+
+        /// <summary>
+        /// Assigns world (or local) positions of multiple scene objects in a single call. When setting world positions
+        /// parents are always updated before their children, regardless of the order in the array.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose positions to set.</param>
+        /// <param name="positions">New positions, one for each scene object.</param>
+        /// <param name="local">If true the positions are relative to the parent, otherwise they are in world space.
+        ///                     </param>
+        public static void SetPositions(SceneObject[] sceneObjects, Vector3[] positions, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, positions);
+            Internal_SetPositions(sceneObjects, positions, local);
+        }
+
+        /// <summary>
+        /// Retrieves world (or local) rotations of multiple scene objects in a single call.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose rotations to retrieve.</param>
+        /// <param name="rotations">Pre-allocated array that will receive the rotations. Must be the same size as
+        ///                         <paramref name="sceneObjects"/>.</param>
+        /// <param name="local">If true the local rotations (relative to the parent) will be retrieved, otherwise world
+        ///                     rotations.</param>
+        public static void GetRotations(SceneObject[] sceneObjects, Quaternion[] rotations, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, rotations);
+            Internal_GetRotations(sceneObjects, rotations, local);
+        }
+
+        /// <summary>
+        /// Assigns world (or local) rotations of multiple scene objects in a single call. When setting world rotations
+        /// parents are always updated before their children, regardless of the order in the array.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose rotations to set.</param>
+        /// <param name="rotations">New rotations, one for each scene object.</param>
+        /// <param name="local">If true the rotations are relative to the parent, otherwise they are in world space.
+        ///                     </param>
+        public static void SetRotations(SceneObject[] sceneObjects, Quaternion[] rotations, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, rotations);
+            Internal_SetRotations(sceneObjects, rotations, local);
+        }
+
+        /// <summary>
+        /// Retrieves world (or local) scales of multiple scene objects in a single call.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose scales to retrieve.</param>
+        /// <param name="scales">Pre-allocated array that will receive the scales. Must be the same size as
+        ///                      <paramref name="sceneObjects"/>.</param>
+        /// <param name="local">If true the local scales (relative to the parent) will be retrieved, otherwise world
+        ///                     scales.</param>
+        public static void GetScales(SceneObject[] sceneObjects, Vector3[] scales, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, scales);
+            Internal_GetScales(sceneObjects, scales, local);
+        }
+
+        /// <summary>
+        /// Assigns local scales of multiple scene objects in a single call.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose scales to set.</param>
+        /// <param name="scales">New scales relative to the parent, one for each scene object.</param>
+        public static void SetLocalScales(SceneObject[] sceneObjects, Vector3[] scales)
+        {
+            CheckBatchSize(sceneObjects, scales);
+            Internal_SetLocalScales(sceneObjects, scales);
+        }
+
+        /// <summary>
+        /// Retrieves world (or local) transform matrices of multiple scene objects in a single call.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects whose transforms to retrieve.</param>
+        /// <param name="transforms">Pre-allocated array that will receive the transforms. Must be the same size as
+        ///                          <paramref name="sceneObjects"/>.</param>
+        /// <param name="local">If true the local transforms (relative to the parent) will be retrieved, otherwise world
+        ///                     transforms.</param>
+        public static void GetTransforms(SceneObject[] sceneObjects, Matrix4[] transforms, bool local = false)
+        {
+            CheckBatchSize(sceneObjects, transforms);
+            Internal_GetTransforms(sceneObjects, transforms, local);
+        }
+
         /// <summary>
         /// Destroys the scene object, removing it from scene and stopping component updates.
         /// </summary>
@@ -465,6 +576,24 @@ namespace BansheeEngine
             Internal_Destroy(mCachedPtr, immediate);
         }
 
+        /// <summary>
+        /// Checks that the scene object and value arrays provided to a batched transform method are valid.
+        /// </summary>
+        /// <param name="sceneObjects">Scene objects to operate on.</param>
+        /// <param name="values">Values to read or write, one for each scene object.</param>
+        private static void CheckBatchSize(SceneObject[] sceneObjects, Array values)
+        {
+            if (sceneObjects == null)
+                throw new ArgumentNullException("sceneObjects");
+
+            if (values == null)
+                throw new ArgumentNullException("values");
+
+            if (sceneObjects.Length != values.Length)
+                throw new ArgumentException("Number of values (" + values.Length + ") doesn't match the number of " +
+                    "scene objects (" + sceneObjects.Length + ").");
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CreateInstance(SceneObject instance, string name, int flags);
 
@@ -504,6 +633,10 @@ namespace BansheeEngine
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern SceneObject[] Internal_FindChildren(IntPtr nativeInstance, string name, bool recursive);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern SceneObject[] Internal_FindChildrenWithPrefix(IntPtr nativeInstance, string prefix, 
+            bool recursive);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetPosition(IntPtr nativeInstance, out Vector3 value);
 
@@ -576,6 +709,27 @@ namespace BansheeEngine
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetRight(IntPtr nativeInstance, out Vector3 value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetPositions(SceneObject[] sceneObjects, Vector3[] values, bool local);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetPositions(SceneObject[] sceneObjects, Vector3[] values, bool local);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetRotations(SceneObject[] sceneObjects, Quaternion[] values, bool local);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetRotations(SceneObject[] sceneObjects, Quaternion[] values, bool local);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetScales(SceneObject[] sceneObjects, Vector3[] values, bool local);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetLocalScales(SceneObject[] sceneObjects, Vector3[] values);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetTransforms(SceneObject[] sceneObjects, Matrix4[] values, bool local);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_Destroy(IntPtr nativeInstance, bool immediate);
     }
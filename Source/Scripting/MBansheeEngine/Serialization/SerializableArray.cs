@@ -75,6 +75,7 @@ namespace BansheeEngine
 
             SerializableProperty property = Internal_CreateProperty(mCachedPtr);
             property.Construct(ElementPropertyType, elementType, getter, setter);
+            property.owner = parentProperty.owner;
 
             return property;
         }
@@ -115,6 +115,7 @@ namespace BansheeEngine
 
                 valueProperty = Internal_CreateValueProperty(mCachedPtr);
                 valueProperty.Construct(ValuePropertyType, valueType, getter, setter);
+                valueProperty.owner = parentProperty.owner;
             }
 
             return new KeyValuePair<SerializableProperty, SerializableProperty>(keyProperty, valueProperty);
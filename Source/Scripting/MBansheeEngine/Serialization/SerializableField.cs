@@ -142,6 +142,7 @@ namespace BansheeEngine
 
             SerializableProperty newProperty = Internal_CreateProperty(mCachedPtr);
             newProperty.Construct(type, internalType, getter, setter);
+            newProperty.owner = parent.Owner;
 
             return newProperty;
         }
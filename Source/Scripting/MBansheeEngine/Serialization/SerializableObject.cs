@@ -32,6 +32,20 @@ namespace BansheeEngine
         /// </summary>
         public object Object { get { return parentObject; } }
 
+        /// <summary>
+        /// Top level object whose contents this object is part of (e.g. a component), if known.
+        /// </summary>
+        internal object Owner
+        {
+            get
+            {
+                if (parentProperty != null)
+                    return parentProperty.owner;
+                else
+                    return parentObject;
+            }
+        }
+
         /// <summary>
         /// Creates a new serializable object for the specified object type.
         /// </summary>
@@ -47,6 +47,11 @@ namespace BansheeEngine
         private Getter getter;
         private Setter setter;
 
+        /// <summary>
+        /// Top level object whose contents the property modifies (e.g. a component), if known.
+        /// </summary>
+        internal object owner;
+
         /// <summary>
         /// Constructor for internal use by the native code.
         /// </summary>
@@ -133,6 +138,10 @@ namespace BansheeEngine
                 throw new Exception("Attempted to set a serializable value using an invalid type. Provided type: " + typeof(T) + ". Needed type: " + internalType);
 
             setter(value);
+
+            ManagedComponent component = owner as ManagedComponent;
+            if (component != null)
+                component.NotifyModified();
         }
 
         /// <summary>
@@ -51,6 +51,7 @@ namespace BansheeEngine
     {
         public DebugMessageType type;
         public string message;
+        public ulong sequence;
     }
 
     /// <summary>
@@ -59,12 +60,20 @@ namespace BansheeEngine
     public sealed class Debug
     {
         /// <summary>
-        /// Triggered when a new message is added to the debug log.
+        /// Triggered when a new message is added to the debug log. Messages logged during a frame are reported together
+        /// at the end of the frame, on the main thread.
         /// </summary>
         public static Action<DebugMessageType, string> OnAdded;
 
         /// <summary>
-        /// Returns a list of all messages in the debug log.
+        /// Triggered once per frame if new messages were added to the debug log during that frame. Unlike
+        /// <see cref="OnAdded"/> no message strings are created, use <see cref="GetEntries"/> to retrieve the new entries.
+        /// </summary>
+        internal static Action OnEntriesAdded;
+
+        /// <summary>
+        /// Returns a list of messages in the debug log. Only the most recent messages are available to scripts, older
+        /// ones can only be found in the engine log.
         /// </summary>
         public static LogEntry[] Messages
         {
@@ -123,6 +132,39 @@ namespace BansheeEngine
             Internal_LogMessage(sb.ToString(), type);
         }
 
+        /// <summary>
+        /// Returns all entries in the debug log, starting with the entry with the provided sequence number.
+        /// </summary>
+        /// <param name="fromSequence">Sequence number of the first entry to return. Entries are numbered in the order they
+        ///                            were logged, and sequence numbers are never reused.</param>
+        /// <param name="includeMessages">If false the message strings of the returned entries are left null, and can be
+        ///                               retrieved individually through <see cref="GetMessage"/>.</param>
+        /// <returns>Log entries, ordered by sequence number.</returns>
+        internal static LogEntry[] GetEntries(ulong fromSequence, bool includeMessages)
+        {
+            return Internal_GetEntries(fromSequence, ulong.MaxValue, includeMessages);
+        }
+
+        /// <summary>
+        /// Returns the message of the log entry with the specified sequence number.
+        /// </summary>
+        /// <param name="sequence">Sequence number of the entry, as reported by <see cref="GetEntries"/>.</param>
+        /// <returns>Message string, or null if the entry is no longer in the debug log.</returns>
+        internal static string GetMessage(ulong sequence)
+        {
+            return Internal_GetMessage(sequence);
+        }
+
+        /// <summary>
+        /// Returns the sequence number of the oldest entry still in the debug log. Only the most recent entries are
+        /// kept, so entries with lower sequence numbers can no longer be retrieved.
+        /// </summary>
+        /// <returns>Sequence number of the oldest entry, or <see cref="ulong.MaxValue"/> if the log is empty.</returns>
+        internal static ulong GetFirstSequence()
+        {
+            return Internal_GetFirstSequence();
+        }
+
         /// <summary>
         /// Clears all messages from the debug log.
         /// </summary>
@@ -272,14 +314,22 @@ namespace BansheeEngine
         }
 
         /// <summary>
-        /// Triggered by the runtime when a new message is added to the debug log.
+        /// Triggered by the runtime once per frame, if new messages were added to the debug log since the last call.
         /// </summary>
-        /// <param name="type">Type of the message that was added.</param>
-        /// <param name="message">Text of the message.</param>
-        private static void Internal_OnAdded(DebugMessageType type, string message)
+        /// <param name="firstSequence">Sequence number of the first newly added message.</param>
+        /// <param name="endSequence">Sequence number one past the last newly added message. Messages logged by the
+        ///                           <see cref="OnAdded"/> handlers are reported on the next call.</param>
+        private static void Internal_OnEntriesAdded(ulong firstSequence, ulong endSequence)
         {
             if (OnAdded != null)
-                OnAdded(type, message);
+            {
+                LogEntry[] entries = Internal_GetEntries(firstSequence, endSequence, true);
+                for (int i = 0; i < entries.Length; i++)
+                    OnAdded(entries[i].type, entries[i].message);
+            }
+
+            if (OnEntriesAdded != null)
+                OnEntriesAdded();
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -302,6 +352,16 @@ namespace BansheeEngine
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern LogEntry[] Internal_GetMessages();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern LogEntry[] Internal_GetEntries(ulong fromSequence, ulong toSequence,
+            bool includeMessages);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern string Internal_GetMessage(ulong sequence);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern ulong Internal_GetFirstSequence();
     }
 
     /** @} */
@@ -16,7 +16,7 @@ namespace bs
 			return HResource();
 
 		ProjectLibrary::FileEntry* resEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
-		if (resEntry->meta == nullptr)
+		if (resEntry->getMeta() == nullptr)
 		{
 			LOGWRN("Missing .meta file for resource at path: \"" + path.toString() + "\".");
 			return HResource();
@@ -30,7 +30,7 @@ namespace bs
 
 		UUID resUUID = meta->getUUID();
 
-		if (resEntry->meta->getIncludeInBuild())
+		if (resEntry->getMeta()->getIncludeInBuild())
 		{
 			LOGWRN("Dynamically loading a resource at path: \"" + path.toString() + "\" but the resource \
 					isn't flagged to be included in the build. It may not be available outside of the editor.");
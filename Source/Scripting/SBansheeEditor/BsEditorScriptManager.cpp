@@ -18,18 +18,22 @@
 #include "Utility/BsTime.h"
 #include "Math/BsMath.h"
 #include "BsEditorApplication.h"
+#include "Utility/BsEditorProfiler.h"
 #include "Wrappers/BsScriptSelection.h"
 #include "BsEditorResourceLoader.h"
 #include "Script/BsScriptManager.h"
 #include "Wrappers/BsScriptEditorApplication.h"
 #include "Wrappers/BsScriptInspectorUtility.h"
+#include "Wrappers/BsScriptPrefabUtility.h"
 #include "Wrappers/BsScriptEditorInput.h"
 #include "Wrappers/BsScriptEditorVirtualInput.h"
 #include "Wrappers/BsScriptUndoRedo.h"
+#include "BsScriptGameObjectManager.h"
 
 namespace bs
 {
 	const float EditorScriptManager::EDITOR_UPDATE_RATE = 1.0f/60.0f; // Seconds
+	const float EditorScriptManager::COMPONENT_WRAPPER_IDLE_TIME = 30.0f; // Seconds
 
 	EditorScriptManager::EditorScriptManager()
 		:mEditorAssembly(nullptr), mProgramEdClass(nullptr), mUpdateMethod(nullptr)
@@ -54,6 +58,10 @@ namespace bs
 		ScriptFolderMonitorManager::startUp();
 		ScriptSelection::startUp();
 		ScriptInspectorUtility::startUp();
+		ScriptPrefabUtility::startUp();
+
+		// Editor touches script objects of every component it inspects, allow them to be released once unused
+		ScriptGameObjectManager::instance().setBuiltinComponentIdleTime(COMPONENT_WRAPPER_IDLE_TIME);
 
 		mOnDomainLoadConn = ScriptObjectManager::instance().onRefreshDomainLoaded.connect(std::bind(&EditorScriptManager::loadMonoTypes, this));
 		mOnAssemblyRefreshDoneConn = ScriptObjectManager::instance().onRefreshComplete.connect(std::bind(&EditorScriptManager::onAssemblyRefreshDone, this));
@@ -73,6 +81,7 @@ namespace bs
 		mOnDomainLoadConn.disconnect();
 		mOnAssemblyRefreshDoneConn.disconnect();
 
+		ScriptPrefabUtility::shutDown();
 		ScriptInspectorUtility::shutDown();
 		ScriptSelection::shutDown();
 		ScriptFolderMonitorManager::shutDown();
@@ -91,12 +100,17 @@ namespace bs
 
 	void EditorScriptManager::update()
 	{
+		EditorProfilerSample sample("EditorScriptManager::update");
+
 		float curTime = gTime().getTime();
 		float diff = curTime - mLastUpdateTime;
 
 		if (diff > EDITOR_UPDATE_RATE)
 		{
-			mUpdateMethod->invoke(nullptr, nullptr);
+			{
+				EditorProfilerSample updateSample("EditorApplication.OnEditorUpdate");
+				mUpdateMethod->invoke(nullptr, nullptr);
+			}
 
 			INT32 numUpdates = Math::floorToInt(diff / EDITOR_UPDATE_RATE);
 			mLastUpdateTime += numUpdates * EDITOR_UPDATE_RATE;
@@ -43,6 +43,7 @@ namespace bs
 		void loadMonoTypes();
 
 		static const float EDITOR_UPDATE_RATE;
+		static const float COMPONENT_WRAPPER_IDLE_TIME;
 
 		MonoAssembly* mEditorAssembly;
 		float mLastUpdateTime;
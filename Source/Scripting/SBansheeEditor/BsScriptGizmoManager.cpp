@@ -77,18 +77,13 @@ namespace bs
 				}
 				else
 				{
-					ScriptGameObjectManager& sgoManager = ScriptGameObjectManager::instance();
-					ScriptComponentBase* scriptComponent = sgoManager.getBuiltinScriptComponent(component, false);
+					// Look up the type through RTTI so we don't need to create (or keep alive) script objects for
+					// components that have no gizmos
+					UINT32 rttiId = component->getRTTI()->getRTTIId();
+					BuiltinComponentInfo* info = ScriptAssemblyManager::instance().getBuiltinComponentInfo(rttiId);
 
-					if (scriptComponent)
-					{
-						managedInstance = scriptComponent->getManagedInstance();
-
-						String ns, typeName;
-						MonoUtil::getClassName(managedInstance, ns, typeName);
-
-						componentName = ns + "." + typeName;
-					}
+					if (info != nullptr)
+						componentName = info->monoClass->getFullName();
 				}
 
 				if (componentName.empty())
@@ -109,6 +104,17 @@ namespace bs
 					if (((flags & (UINT32)DrawGizmoFlags::NotSelected) != 0) && !isSelected && !isParentSelected)
 						drawGizmo = true;
 
+					if (drawGizmo && managedInstance == nullptr)
+					{
+						ScriptGameObjectManager& sgoManager = ScriptGameObjectManager::instance();
+						ScriptComponentBase* scriptComponent = sgoManager.getBuiltinScriptComponent(component);
+
+						if (scriptComponent != nullptr)
+							managedInstance = scriptComponent->getManagedInstance();
+
+						drawGizmo = managedInstance != nullptr;
+					}
+
 					if (drawGizmo)
 					{
 						bool pickable = (flags & (UINT32)DrawGizmoFlags::Pickable) != 0;
@@ -44,6 +44,7 @@ set(BS_SBANSHEEEDITOR_SRC_WRAPPERS
 	"Wrappers/BsScriptEditorSettings.cpp"
 	"Wrappers/BsScriptEditorTestSuite.cpp"
 	"Wrappers/BsScriptEditorUtility.cpp"
+	"Wrappers/BsScriptEditorProfiler.cpp"
 	"Wrappers/BsScriptEditorVirtualInput.cpp"
 	"Wrappers/BsScriptEditorWindow.cpp"
 	"Wrappers/BsScriptFolderMonitor.cpp"
@@ -102,6 +103,7 @@ set(BS_SBANSHEEEDITOR_INC_WRAPPERS
 	"Wrappers/BsScriptEditorSettings.h"
 	"Wrappers/BsScriptEditorTestSuite.h"
 	"Wrappers/BsScriptEditorUtility.h"
+	"Wrappers/BsScriptEditorProfiler.h"
 	"Wrappers/BsScriptEditorVirtualInput.h"
 	"Wrappers/BsScriptEditorWindow.h"
 	"Wrappers/BsScriptFolderMonitor.h"
@@ -232,13 +232,13 @@ namespace bs
 		Vector<ProjectLibrary::FileEntry*> buildResources = gProjectLibrary().getResourcesForBuild();
 		for (auto& entry : buildResources)
 		{
-			if (entry->meta == nullptr)
+			if (entry->getMeta() == nullptr)
 			{
 				LOGWRN("Cannot include resource in build, missing meta file for: " + entry->path.toString());
 				continue;
 			}
 
-			auto& resourceMetas = entry->meta->getResourceMetaData();
+			auto& resourceMetas = entry->getMeta()->getResourceMetaData();
 			for(auto& resMeta : resourceMetas)
 			{
 				Path resourcePath;
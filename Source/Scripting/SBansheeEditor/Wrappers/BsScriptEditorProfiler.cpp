@@ -0,0 +1,104 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptEditorProfiler.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+#include "Utility/BsEditorProfiler.h"
+
+namespace bs
+{
+	ScriptEditorProfiler::ScriptEditorProfiler(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptEditorProfiler::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_SetEnabled", (void*)&ScriptEditorProfiler::internal_SetEnabled);
+		metaData.scriptClass->addInternalCall("Internal_IsEnabled", (void*)&ScriptEditorProfiler::internal_IsEnabled);
+		metaData.scriptClass->addInternalCall("Internal_BeginSample", (void*)&ScriptEditorProfiler::internal_BeginSample);
+		metaData.scriptClass->addInternalCall("Internal_EndSample", (void*)&ScriptEditorProfiler::internal_EndSample);
+		metaData.scriptClass->addInternalCall("Internal_GetNumFrames", (void*)&ScriptEditorProfiler::internal_GetNumFrames);
+		metaData.scriptClass->addInternalCall("Internal_GetFrame", (void*)&ScriptEditorProfiler::internal_GetFrame);
+		metaData.scriptClass->addInternalCall("Internal_SaveTrace", (void*)&ScriptEditorProfiler::internal_SaveTrace);
+		metaData.scriptClass->addInternalCall("Internal_CaptureFrames", (void*)&ScriptEditorProfiler::internal_CaptureFrames);
+	}
+
+	void ScriptEditorProfiler::internal_SetEnabled(bool enabled)
+	{
+		EditorProfiler::instance().setEnabled(enabled);
+	}
+
+	bool ScriptEditorProfiler::internal_IsEnabled()
+	{
+		return EditorProfiler::instance().isEnabled();
+	}
+
+	void ScriptEditorProfiler::internal_BeginSample(MonoString* name)
+	{
+		EditorProfiler& profiler = EditorProfiler::instance();
+
+		// Avoid the string conversion when not recording
+		if (!profiler.isEnabled())
+			return;
+
+		profiler.beginSample(MonoUtil::monoToString(name));
+	}
+
+	void ScriptEditorProfiler::internal_EndSample()
+	{
+		EditorProfiler::instance().endSample();
+	}
+
+	UINT32 ScriptEditorProfiler::internal_GetNumFrames()
+	{
+		return EditorProfiler::instance().getNumFrames();
+	}
+
+	UINT64 ScriptEditorProfiler::internal_GetFrame(UINT32 idx, MonoArray** names, MonoArray** durations,
+		MonoArray** depths)
+	{
+		EditorProfiler& profiler = EditorProfiler::instance();
+		if (idx >= profiler.getNumFrames())
+		{
+			MonoUtil::referenceCopy(names, (MonoObject*)ScriptArray::create<String>(0).getInternal());
+			MonoUtil::referenceCopy(durations, (MonoObject*)ScriptArray::create<UINT64>(0).getInternal());
+			MonoUtil::referenceCopy(depths, (MonoObject*)ScriptArray::create<UINT32>(0).getInternal());
+
+			return 0;
+		}
+
+		const EditorProfiler::Frame& frame = profiler.getFrame(idx);
+		UINT32 numSamples = (UINT32)frame.samples.size();
+
+		ScriptArray outputNames = ScriptArray::create<String>(numSamples);
+		ScriptArray outputDurations = ScriptArray::create<UINT64>(numSamples);
+		ScriptArray outputDepths = ScriptArray::create<UINT32>(numSamples);
+
+		for (UINT32 i = 0; i < numSamples; i++)
+		{
+			const EditorProfiler::Sample& sample = frame.samples[i];
+
+			outputNames.set(i, MonoUtil::stringToMono(sample.name));
+			outputDurations.set(i, sample.duration);
+			outputDepths.set(i, sample.depth);
+		}
+
+		MonoUtil::referenceCopy(names, (MonoObject*)outputNames.getInternal());
+		MonoUtil::referenceCopy(durations, (MonoObject*)outputDurations.getInternal());
+		MonoUtil::referenceCopy(depths, (MonoObject*)outputDepths.getInternal());
+
+		return frame.duration;
+	}
+
+	void ScriptEditorProfiler::internal_SaveTrace(MonoString* path, UINT32 numFrames)
+	{
+		EditorProfiler::instance().saveTrace(MonoUtil::monoToString(path), numFrames);
+	}
+
+	void ScriptEditorProfiler::internal_CaptureFrames(MonoString* path, UINT32 numFrames)
+	{
+		EditorProfiler::instance().captureFrames(MonoUtil::monoToString(path), numFrames);
+	}
+}
\ No newline at end of file
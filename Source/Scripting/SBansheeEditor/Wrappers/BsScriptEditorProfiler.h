@@ -0,0 +1,37 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEditor
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for EditorProfiler. */
+	class BS_SCR_BED_EXPORT ScriptEditorProfiler : public ScriptObject <ScriptEditorProfiler>
+	{
+	public:
+		SCRIPT_OBJ(EDITOR_ASSEMBLY, "BansheeEditor", "EditorProfiler")
+
+	private:
+		ScriptEditorProfiler(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_SetEnabled(bool enabled);
+		static bool internal_IsEnabled();
+		static void internal_BeginSample(MonoString* name);
+		static void internal_EndSample();
+		static UINT32 internal_GetNumFrames();
+		static UINT64 internal_GetFrame(UINT32 idx, MonoArray** names, MonoArray** durations, MonoArray** depths);
+		static void internal_SaveTrace(MonoString* path, UINT32 numFrames);
+		static void internal_CaptureFrames(MonoString* path, UINT32 numFrames);
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "BsMonoManager.h"
 #include "BsMonoMethod.h"
 #include "BsMonoUtil.h"
+#include "BsScriptGCHandleTable.h"
 
 using namespace std::placeholders;
 
@@ -20,7 +21,7 @@ namespace bs
 	ScriptFolderMonitor::ScriptFolderMonitor(MonoObject* instance, FolderMonitor* monitor)
 		:ScriptObject(instance), mMonitor(monitor)
 	{
-		mGCHandle = MonoUtil::newWeakGCHandle(instance);
+		mGCHandle = ScriptGCHandleTable::instance().newWeakHandle(instance, ScriptGCHandleCategory::Editor);
 
 		if (mMonitor != nullptr)
 		{
@@ -75,28 +76,28 @@ namespace bs
 
 	void ScriptFolderMonitor::onMonitorFileModified(const Path& path)
 	{
-		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* instance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnModifiedThunk, instance, monoPath);
 	}
 
 	void ScriptFolderMonitor::onMonitorFileAdded(const Path& path)
 	{
-		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* instance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnAddedThunk, instance, monoPath);
 	}
 
 	void ScriptFolderMonitor::onMonitorFileRemoved(const Path& path)
 	{
-		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* instance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnRemovedThunk, instance, monoPath);
 	}
 
 	void ScriptFolderMonitor::onMonitorFileRenamed(const Path& from, const Path& to)
 	{
-		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* instance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoString* monoPathFrom = MonoUtil::stringToMono(from.toString());
 		MonoString* monoPathTo = MonoUtil::stringToMono(to.toString());
 
@@ -119,7 +120,11 @@ namespace bs
 			ScriptFolderMonitorManager::instance()._unregisterMonitor(this);
 		}
 
-		mGCHandle = 0;
+		if (mGCHandle != 0 && ScriptGCHandleTable::isStarted())
+		{
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
+			mGCHandle = 0;
+		}
 	}
 
 	void ScriptFolderMonitorManager::update()
@@ -7,13 +7,21 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
 #include "Resources/BsResources.h"
 #include "BsMonoUtil.h"
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptPrefab.h"
+#include "BsMonoArray.h"
+#include "BsMonoMethod.h"
+#include "BsScriptObjectManager.h"
 
 namespace bs
 {
+	HSceneObject ScriptPrefabUtility::sPrefabSnapshot;
+	UUID ScriptPrefabUtility::sPrefabSnapshotUUID;
+	HEvent ScriptPrefabUtility::sRefreshStartedConn;
+
 	ScriptPrefabUtility::ScriptPrefabUtility(MonoObject* instance)
 		:ScriptObject(instance)
 	{ }
@@ -28,6 +36,36 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetPrefabUUID", (void*)&ScriptPrefabUtility::internal_GetPrefabUUID);
 		metaData.scriptClass->addInternalCall("Internal_UpdateFromPrefab", (void*)&ScriptPrefabUtility::internal_UpdateFromPrefab);
 		metaData.scriptClass->addInternalCall("Internal_RecordPrefabDiff", (void*)&ScriptPrefabUtility::internal_RecordPrefabDiff);
+		metaData.scriptClass->addInternalCall("Internal_FindPrefabInstances",
+			(void*)&ScriptPrefabUtility::internal_FindPrefabInstances);
+		metaData.scriptClass->addInternalCall("Internal_UpdateFromPrefabs", (void*)&ScriptPrefabUtility::internal_UpdateFromPrefabs);
+		metaData.scriptClass->addInternalCall("Internal_CreatePrefabSnapshot",
+			(void*)&ScriptPrefabUtility::internal_CreatePrefabSnapshot);
+		metaData.scriptClass->addInternalCall("Internal_ReleasePrefabSnapshot",
+			(void*)&ScriptPrefabUtility::internal_ReleasePrefabSnapshot);
+	}
+
+	void ScriptPrefabUtility::startUp()
+	{
+		sRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(&onRefreshStarted);
+	}
+
+	void ScriptPrefabUtility::shutDown()
+	{
+		sRefreshStartedConn.disconnect();
+
+		releasePrefabSnapshot();
+	}
+
+	void ScriptPrefabUtility::onRefreshStarted()
+	{
+		// Queue of instances waiting to be updated lives in the domain being unloaded, so finish the updates while
+		// the snapshot they were last in sync with is still available
+		MonoMethod* finishMethod = metaData.scriptClass->getMethod("FinishUpdatingInstances");
+		if (finishMethod != nullptr)
+			finishMethod->invoke(nullptr, nullptr);
+
+		releasePrefabSnapshot();
 	}
 
 	void ScriptPrefabUtility::internal_breakPrefab(ScriptSceneObject* soPtr)
@@ -110,4 +148,112 @@ namespace bs
 		HSceneObject so = soPtr->getNativeSceneObject();
 		PrefabUtility::recordPrefabDiff(so);
 	}
+
+	MonoArray* ScriptPrefabUtility::internal_FindPrefabInstances(ScriptSceneObject* soPtr, UUID* prefabUUID)
+	{
+		Vector<HSceneObject> instances;
+		if (!ScriptSceneObject::checkIfDestroyed(soPtr))
+		{
+			Stack<HSceneObject> todo;
+			todo.push(soPtr->getNativeSceneObject());
+
+			while (!todo.empty())
+			{
+				HSceneObject current = todo.top();
+				todo.pop();
+
+				// Instances can't contain other instances of the same prefab, so there is no need to look further
+				if (current->getPrefabLink(true) == *prefabUUID)
+				{
+					instances.push_back(current);
+					continue;
+				}
+
+				UINT32 numChildren = current->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+					todo.push(current->getChild(i));
+			}
+		}
+
+		UINT32 numInstances = (UINT32)instances.size();
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>(numInstances);
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			ScriptSceneObject* scriptSO = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(instances[i]);
+			output.set(i, scriptSO->getManagedInstance());
+		}
+
+		return output.getInternal();
+	}
+
+	void ScriptPrefabUtility::internal_UpdateFromPrefabs(MonoArray* sceneObjects)
+	{
+		for (auto& so : getSceneObjects(sceneObjects))
+		{
+			HSceneObject prefabParent = so->getPrefabParent();
+			if (prefabParent == nullptr)
+				continue;
+
+			// Diff is recorded right before the update, so changes made to the instance while its update was pending
+			// are preserved. The instance itself was last in sync with the snapshot, not the current prefab.
+			if (!sPrefabSnapshot.isDestroyed() && prefabParent->getPrefabLink() == sPrefabSnapshotUUID)
+				prefabParent->_setPrefabDiff(PrefabDiff::create(sPrefabSnapshot, prefabParent));
+			else
+				PrefabUtility::recordPrefabDiff(prefabParent);
+
+			// Instances already in sync with their prefab are skipped by updateFromPrefab
+			PrefabUtility::updateFromPrefab(prefabParent);
+		}
+	}
+
+	void ScriptPrefabUtility::internal_CreatePrefabSnapshot(ScriptPrefab* prefabPtr)
+	{
+		releasePrefabSnapshot();
+
+		HPrefab prefab = prefabPtr->getHandle();
+		if (!prefab.isLoaded())
+			return;
+
+		sPrefabSnapshot = prefab->_getRoot()->clone(false);
+		sPrefabSnapshotUUID = prefab.getUUID();
+	}
+
+	void ScriptPrefabUtility::internal_ReleasePrefabSnapshot()
+	{
+		releasePrefabSnapshot();
+	}
+
+	void ScriptPrefabUtility::releasePrefabSnapshot()
+	{
+		if (!sPrefabSnapshot.isDestroyed())
+			sPrefabSnapshot->destroy(true);
+
+		sPrefabSnapshot = nullptr;
+		sPrefabSnapshotUUID = UUID::EMPTY;
+	}
+
+	Vector<HSceneObject> ScriptPrefabUtility::getSceneObjects(MonoArray* sceneObjects)
+	{
+		Vector<HSceneObject> output;
+		if (sceneObjects == nullptr)
+			return output;
+
+		ScriptArray sceneObjectsArray(sceneObjects);
+		UINT32 numSceneObjects = sceneObjectsArray.size();
+		output.reserve(numSceneObjects);
+
+		for (UINT32 i = 0; i < numSceneObjects; i++)
+		{
+			MonoObject* managedInstance = sceneObjectsArray.get<MonoObject*>(i);
+			if (managedInstance == nullptr)
+				continue;
+
+			// Instances can be destroyed while their update is pending, so this is expected and not reported
+			HSceneObject so = ScriptSceneObject::toNative(managedInstance)->getNativeSceneObject();
+			if (!so.isDestroyed())
+				output.push_back(so);
+		}
+
+		return output;
+	}
 }
\ No newline at end of file
@@ -17,9 +17,35 @@ namespace bs
 	public:
 		SCRIPT_OBJ(EDITOR_ASSEMBLY, "BansheeEditor", "PrefabUtility")
 
+		/** Registers callbacks for assembly refresh. Must be called on library load. */
+		static void startUp();
+
+		/** Unregisters assembly refresh callbacks and releases the prefab snapshot. Must be called on library unload. */
+		static void shutDown();
+
 	private:
 		ScriptPrefabUtility(MonoObject* instance);
 
+		/** Converts an array of managed scene objects into native handles, skipping null or destroyed objects. */
+		static Vector<HSceneObject> getSceneObjects(MonoArray* sceneObjects);
+
+		/** Destroys the prefab snapshot created by internal_CreatePrefabSnapshot(), if any. */
+		static void releasePrefabSnapshot();
+
+		/**
+		 * Triggered when assembly refresh starts. Finishes updating any pending prefab instances and releases the
+		 * prefab snapshot.
+		 */
+		static void onRefreshStarted();
+
+		/**
+		 * Copy of the applied prefab's hierarchy from before the prefab was applied. Instances waiting to be updated have
+		 * their diffs recorded against it, as they were last in sync with that version of the prefab.
+		 */
+		static HSceneObject sPrefabSnapshot;
+		static UUID sPrefabSnapshotUUID;
+		static HEvent sRefreshStartedConn;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -31,6 +57,10 @@ namespace bs
 		static void internal_GetPrefabUUID(ScriptSceneObject* soPtr, UUID* uuid);
 		static void internal_UpdateFromPrefab(ScriptSceneObject* soPtr);
 		static void internal_RecordPrefabDiff(ScriptSceneObject* soPtr);
+		static MonoArray* internal_FindPrefabInstances(ScriptSceneObject* soPtr, UUID* prefabUUID);
+		static void internal_UpdateFromPrefabs(MonoArray* sceneObjects);
+		static void internal_CreatePrefabSnapshot(ScriptPrefab* prefabPtr);
+		static void internal_ReleasePrefabSnapshot();
 	};
 
 	/** @} */
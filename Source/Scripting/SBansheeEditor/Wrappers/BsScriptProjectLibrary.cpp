@@ -38,6 +38,8 @@ namespace bs
 	{
 		metaData.scriptClass->addInternalCall("Internal_Refresh", (void*)&ScriptProjectLibrary::internal_Refresh);
 		metaData.scriptClass->addInternalCall("Internal_FinalizeImports", (void*)&ScriptProjectLibrary::internal_FinalizeImports);
+		metaData.scriptClass->addInternalCall("Internal_QueueRefresh", (void*)&ScriptProjectLibrary::internal_QueueRefresh);
+		metaData.scriptClass->addInternalCall("Internal_ProcessQueuedRefreshes", (void*)&ScriptProjectLibrary::internal_ProcessQueuedRefreshes);
 		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptProjectLibrary::internal_Create);
 		metaData.scriptClass->addInternalCall("Internal_Load", (void*)&ScriptProjectLibrary::internal_Load);
 		metaData.scriptClass->addInternalCall("Internal_Save", (void*)&ScriptProjectLibrary::internal_Save);
@@ -83,6 +85,21 @@ namespace bs
 	{
 		gProjectLibrary()._finishQueuedImports();
 	}
+
+	void ScriptProjectLibrary::internal_QueueRefresh(MonoString* path)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+
+		if (!nativePath.isAbsolute())
+			nativePath.makeAbsolute(gProjectLibrary().getResourcesFolder());
+
+		gProjectLibrary().queueModification(nativePath);
+	}
+
+	UINT32 ScriptProjectLibrary::internal_ProcessQueuedRefreshes()
+	{
+		return gProjectLibrary()._processQueuedModifications();
+	}
 		
 	UINT32 ScriptProjectLibrary::internal_GetInProgressImportCount()
 	{
@@ -465,8 +482,8 @@ namespace bs
 
 		ProjectLibrary::FileEntry* fileEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
 
-		if (fileEntry->meta != nullptr)
-			return ScriptImportOptions::create(fileEntry->meta->getImportOptions());
+		if (fileEntry->getMeta() != nullptr)
+			return ScriptImportOptions::create(fileEntry->getMeta()->getImportOptions());
 		else
 			return nullptr;
 	}
@@ -478,9 +495,9 @@ namespace bs
 		{
 			ProjectLibrary::FileEntry* fileEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
 
-			if (fileEntry->meta != nullptr)
+			if (fileEntry->getMeta() != nullptr)
 			{
-				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				auto& resourceMetas = fileEntry->getMeta()->getResourceMetaData();
 				UINT32 numElements = (UINT32)resourceMetas.size();
 
 				ScriptArray output = ScriptArray::create<ScriptResourceMeta>(numElements);
@@ -502,8 +519,8 @@ namespace bs
 
 		ProjectLibrary::FileEntry* fileEntry = static_cast<ProjectLibrary::FileEntry*>(entry);
 
-		if (fileEntry->meta != nullptr)
-			return fileEntry->meta->getIncludeInBuild();
+		if (fileEntry->getMeta() != nullptr)
+			return fileEntry->getMeta()->getIncludeInBuild();
 
 		return false;
 	}
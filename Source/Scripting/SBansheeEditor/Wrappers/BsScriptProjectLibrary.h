@@ -66,6 +66,8 @@ namespace bs
 
 		static UINT32 internal_Refresh(MonoString* path, bool synchronous);
 		static void internal_FinalizeImports();
+		static void internal_QueueRefresh(MonoString* path);
+		static UINT32 internal_ProcessQueuedRefreshes();
 		static void internal_Create(MonoObject* resource, MonoString* path);
 		static MonoObject* internal_Load(MonoString* path);
 		static void internal_Save(MonoObject* resource);
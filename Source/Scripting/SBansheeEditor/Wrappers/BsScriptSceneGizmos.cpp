@@ -4,6 +4,7 @@
 #include "Scene/BsGizmoManager.h"
 #include "BsScriptGizmoManager.h"
 #include "Components/BsCCamera.h"
+#include "Utility/BsEditorProfiler.h"
 
 #include "BsScriptCCamera.generated.h"
 
@@ -34,12 +35,16 @@ namespace bs
 
 	void ScriptSceneGizmos::internal_Draw(ScriptSceneGizmos* thisPtr)
 	{
-		ScriptGizmoManager::instance().update();
+		{
+			EditorProfilerSample sample("ScriptGizmoManager::update");
+			ScriptGizmoManager::instance().update();
+		}
 
 		// Make sure camera's transform is up-to-date
 		const SPtr<Camera>& cameraPtr = thisPtr->mCamera->_getCamera();
 		cameraPtr->_updateState(*thisPtr->mCamera->SO());
 
+		EditorProfilerSample sample("GizmoManager::update");
 		GizmoManager::instance().update(cameraPtr);
 	}
 }
@@ -9,6 +9,7 @@
 #include "BsMonoPrerequisites.h"
 #include "BsMonoArray.h"
 #include "Components/BsCCamera.h"
+#include "Utility/BsEditorProfiler.h"
 
 #include "BsScriptCCamera.generated.h"
 
@@ -18,10 +19,15 @@ namespace bs
 		:ScriptObject(object), mCamera(camera), mSelectionRenderer(nullptr)
 	{
 		mSelectionRenderer = bs_new<SelectionRenderer>();
+
+		// Scripts can add renderables or children to selected objects without going through undo/redo
+		mHierarchyModifiedConn = ScriptGameObjectManager::instance().onHierarchyModified.connect(
+			std::bind(&SelectionRenderer::notifyHierarchyModified, mSelectionRenderer));
 	}
 
 	ScriptSceneSelection::~ScriptSceneSelection()
 	{
+		mHierarchyModifiedConn.disconnect();
 		bs_delete(mSelectionRenderer);
 	}
 
@@ -41,6 +47,7 @@ namespace bs
 
 	void ScriptSceneSelection::internal_Draw(ScriptSceneSelection* thisPtr)
 	{
+		EditorProfilerSample sample("SelectionRenderer::update");
 		thisPtr->mSelectionRenderer->update(thisPtr->mCamera);
 	}
 
@@ -26,6 +26,7 @@ namespace bs
 
 		SPtr<Camera> mCamera;
 		SelectionRenderer* mSelectionRenderer;
+		HEvent mHierarchyModifiedConn;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
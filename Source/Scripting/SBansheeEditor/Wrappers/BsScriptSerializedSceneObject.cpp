@@ -6,6 +6,7 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Scene/BsSceneObject.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "BsSceneObjectNameIndex.h"
 
 namespace bs
 {
@@ -114,5 +115,8 @@ namespace bs
 		}
 
 		restored->_instantiate();
+
+		// Restored objects keep their original IDs, which were removed from the index when the originals got destroyed
+		SceneObjectNameIndex::instance().markDirty();
 	}
 }
\ No newline at end of file
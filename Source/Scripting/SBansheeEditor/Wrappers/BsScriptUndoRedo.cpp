@@ -19,6 +19,7 @@
 #include "BsManagedEditorCommand.h"
 #include "Scene/BsPrefab.h"
 #include "BsScriptObjectManager.h"
+#include "BsSceneObjectNameIndex.h"
 
 namespace bs
 {
@@ -101,12 +102,16 @@ namespace bs
 	{
 		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
 		undoRedo->undo();
+
+		// Commands can restore scene objects without going through the scripting API
+		SceneObjectNameIndex::instance().markDirty();
 	}
 
 	void ScriptUndoRedo::internal_Redo(ScriptUndoRedo* thisPtr)
 	{
 		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
 		undoRedo->redo();
+		SceneObjectNameIndex::instance().markDirty();
 	}
 
 	void ScriptUndoRedo::internal_RegisterCommand(ScriptUndoRedo* thisPtr, ScriptCmdManaged* command)
@@ -159,6 +164,7 @@ namespace bs
 	{
 		String nativeDescription = MonoUtil::monoToString(description);
 		HSceneObject clone = CmdCloneSO::execute(soPtr->getNativeSceneObject(), nativeDescription);
+		SceneObjectNameIndex::instance().notifyCreated(clone);
 
 		ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clone);
 		return cloneSoPtr->getManagedInstance();
@@ -169,12 +175,33 @@ namespace bs
 		String nativeDescription = MonoUtil::monoToString(description);
 
 		ScriptArray input(soPtrs);
-		ScriptArray output = ScriptArray::create<ScriptSceneObject>(input.size());
+		UINT32 numInput = input.size();
 
-		for (UINT32 i = 0; i < input.size(); i++)
+		Vector<HSceneObject> originals;
+		originals.reserve(numInput);
+		for (UINT32 i = 0; i < numInput; i++)
 		{
 			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
-			HSceneObject clone = CmdCloneSO::execute(soPtr->getNativeSceneObject(), nativeDescription);
+			if (soPtr != nullptr)
+				originals.push_back(soPtr->getNativeSceneObject());
+			else
+				originals.push_back(HSceneObject());
+		}
+
+		// All objects are cloned by a single command, so they are undone in a single step
+		Vector<HSceneObject> clones = CmdCloneSO::execute(originals, nativeDescription);
+
+		// The command skips destroyed originals. Keep the output aligned with the input and leave null entries for
+		// objects that weren't cloned.
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>(numInput);
+		UINT32 cloneIdx = 0;
+		for (UINT32 i = 0; i < numInput; i++)
+		{
+			if (originals[i].isDestroyed() || cloneIdx >= (UINT32)clones.size())
+				continue;
+
+			const HSceneObject& clone = clones[cloneIdx++];
+			SceneObjectNameIndex::instance().notifyCreated(clone);
 
 			ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clone);
 			output.set(i, cloneSoPtr->getManagedInstance());
@@ -191,6 +218,7 @@ namespace bs
 
 		String nativeDescription = MonoUtil::monoToString(description);
 		HSceneObject clone = CmdInstantiateSO::execute(prefab, nativeDescription);
+		SceneObjectNameIndex::instance().notifyCreated(clone);
 
 		ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clone);
 		return cloneSoPtr->getManagedInstance();
@@ -201,6 +229,7 @@ namespace bs
 		String nativeName = MonoUtil::monoToString(name);
 		String nativeDescription = MonoUtil::monoToString(description);
 		HSceneObject newObj = CmdCreateSO::execute(nativeName, 0, nativeDescription);
+		SceneObjectNameIndex::instance().notifyCreated(newObj);
 
 		return ScriptGameObjectManager::instance().createScriptSceneObject(newObj)->getManagedInstance();
 	}
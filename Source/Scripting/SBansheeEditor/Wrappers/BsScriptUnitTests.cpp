@@ -8,6 +8,8 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Serialization/BsManagedSerializableObject.h"
 #include "Serialization/BsManagedSerializableDiff.h"
+#include "BsScriptGameObjectManager.h"
+#include "CoreThread/BsCoreThread.h"
 
 namespace bs
 {
@@ -23,6 +25,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_UT1_GameObjectClone", (void*)&ScriptUnitTests::internal_UT1_GameObjectClone);
 		metaData.scriptClass->addInternalCall("Internal_UT3_GenerateDiff", (void*)&ScriptUnitTests::internal_UT3_GenerateDiff);
 		metaData.scriptClass->addInternalCall("Internal_UT3_ApplyDiff", (void*)&ScriptUnitTests::internal_UT3_ApplyDiff);
+		metaData.scriptClass->addInternalCall("Internal_UT9_SubmitCoreThread",
+			(void*)&ScriptUnitTests::internal_UT9_SubmitCoreThread);
+		metaData.scriptClass->addInternalCall("Internal_UT11_ReleaseComponentWrappers",
+			(void*)&ScriptUnitTests::internal_UT11_ReleaseComponentWrappers);
 
 		RunTestsMethod = metaData.scriptClass->getMethod("RunTests");
 	}
@@ -57,4 +63,15 @@ namespace bs
 
 		tempDiff = nullptr;
 	}
+
+	void ScriptUnitTests::internal_UT9_SubmitCoreThread()
+	{
+		// Executes all queued texture writes and reads, as would happen once the frame ends
+		gCoreThread().submit(true);
+	}
+
+	void ScriptUnitTests::internal_UT11_ReleaseComponentWrappers()
+	{
+		ScriptGameObjectManager::instance().releaseIdleBuiltinComponents(0.0f);
+	}
 }
\ No newline at end of file
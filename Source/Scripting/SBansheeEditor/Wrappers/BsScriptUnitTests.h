@@ -32,6 +32,8 @@ namespace bs
 		static void internal_UT1_GameObjectClone(MonoObject* instance);
 		static void internal_UT3_GenerateDiff(MonoObject* oldObj, MonoObject* newObj);
 		static void internal_UT3_ApplyDiff(MonoObject* obj);
+		static void internal_UT9_SubmitCoreThread();
+		static void internal_UT11_ReleaseComponentWrappers();
 	};
 
 	/** @} */
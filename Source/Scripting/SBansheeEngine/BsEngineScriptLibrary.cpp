@@ -6,15 +6,19 @@
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "BsScriptResourceManager.h"
 #include "BsScriptGameObjectManager.h"
+#include "BsSceneObjectNameIndex.h"
 #include "BsManagedResourceManager.h"
 #include "Script/BsScriptManager.h"
 #include "Wrappers/BsScriptInput.h"
 #include "Wrappers/BsScriptVirtualInput.h"
 #include "BsScriptObjectManager.h"
+#include "BsScriptGCHandleTable.h"
 #include "Resources/BsGameResourceManager.h"
 #include "BsApplication.h"
 #include "FileSystem/BsFileSystem.h"
 #include "Wrappers/BsScriptDebug.h"
+#include "Wrappers/BsScriptResources.h"
+#include "Wrappers/BsScriptCameraRenderSettings.h"
 #include "Wrappers/GUI/BsScriptGUI.h"
 #include "BsPlayInEditorManager.h"
 #include "Wrappers/BsScriptScene.h"
@@ -38,11 +42,15 @@ namespace bs
 		ScriptDebug::startUp();
 		GameResourceManager::startUp();
 		ScriptObjectManager::startUp();
+		ScriptGCHandleTable::startUp();
 		ManagedResourceManager::startUp();
 		ScriptAssemblyManager::startUp();
 		ScriptResourceManager::startUp();
 		ScriptGameObjectManager::startUp();
+		SceneObjectNameIndex::startUp();
 		ScriptScene::startUp();
+		ScriptResources::startUp();
+		ScriptCameraRenderSettings::startUp();
 		ScriptInput::startUp();
 		ScriptVirtualInput::startUp();
 		ScriptGUI::startUp();
@@ -99,6 +107,7 @@ namespace bs
 	void EngineScriptLibrary::unloadAssemblies()
 	{
 		ManagedResourceManager::instance().clear();
+		ScriptGCHandleTable::instance().releaseAll();
 		MonoManager::instance().unloadScriptDomain();
 		ScriptObjectManager::instance().processFinalizedObjects();
 	}
@@ -111,9 +120,13 @@ namespace bs
 		ScriptScene::shutDown();
 		ManagedResourceManager::shutDown();
 		MonoManager::shutDown();
+		SceneObjectNameIndex::shutDown();
 		ScriptGameObjectManager::shutDown();
+		ScriptCameraRenderSettings::shutDown();
+		ScriptResources::shutDown();
 		ScriptResourceManager::shutDown();
 		ScriptAssemblyManager::shutDown();
+		ScriptGCHandleTable::shutDown();
 		ScriptObjectManager::shutDown();
 		GameResourceManager::shutDown();
 		ScriptDebug::shutDown();
@@ -124,6 +124,7 @@ namespace bs
 
 		mMissingType = missingType;
 		mRequiresReset = true;
+		mModificationCount++;
 	}
 
 	void ManagedComponent::initialize(ScriptManagedComponent* owner)
@@ -346,6 +347,7 @@ namespace bs
 		{
 			mSerializedObjectData->deserialize(instance, mObjInfo);
 			mSerializedObjectData = nullptr;
+			mModificationCount++;
 		}
 
 		if (mOnCreatedThunk != nullptr)
@@ -386,6 +388,8 @@ namespace bs
 
 	void ManagedComponent::onEnabled()
 	{
+		mModificationCount++;
+
 		if (mOnEnabledThunk != nullptr)
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
@@ -398,6 +402,8 @@ namespace bs
 
 	void ManagedComponent::onDisabled()
 	{
+		mModificationCount++;
+
 		if (mOnDisabledThunk != nullptr)
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
@@ -64,6 +64,17 @@ namespace bs
 		/**	Triggers the managed OnReset callback. */
 		void triggerOnReset();
 
+		/**
+		 * Returns a counter that is incremented whenever the state of the managed component instance changes in a way
+		 * that isn't visible to the managed code that is observing it (e.g. the instance is restored, deserialized or
+		 * the component gets enabled/disabled), or when one of its fields is written through the serializable wrappers.
+		 * Allows observers like the inspector to skip components that haven't changed.
+		 */
+		UINT32 getModificationCount() const { return mModificationCount; }
+
+		/** Increments the modification count returned by getModificationCount(). */
+		void _markModified() { mModificationCount++; }
+
 	private:
 		friend class ScriptManagedComponent;
 
@@ -92,6 +103,7 @@ namespace bs
 		String mTypeName;
 		String mFullTypeName;
 		bool mRequiresReset = true;
+		UINT32 mModificationCount = 0;
 
 		bool mMissingType = false;
 		SPtr<ManagedSerializableObject> mSerializedObjectData;
@@ -0,0 +1,345 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSceneObjectNameIndex.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Utility/BsTime.h"
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	SceneObjectNameIndex::SceneObjectNameIndex()
+	{
+		mOnGameObjectDestroyedConn = GameObjectManager::instance().onDestroyed.connect(
+			std::bind(&SceneObjectNameIndex::onGameObjectDestroyed, this, _1));
+	}
+
+	SceneObjectNameIndex::~SceneObjectNameIndex()
+	{
+		mOnGameObjectDestroyedConn.disconnect();
+	}
+
+	void SceneObjectNameIndex::setEnabled(bool enabled)
+	{
+		if (mEnabled == enabled)
+			return;
+
+		mEnabled = enabled;
+		mEntries.clear();
+		mIndexedNames.clear();
+		mRoot = nullptr;
+		mIsDirty = true;
+	}
+
+	void SceneObjectNameIndex::notifyCreated(const HSceneObject& sceneObject)
+	{
+		// Dirty index will pick up the object when it is rebuilt
+		if (!mEnabled || mIsDirty || sceneObject.isDestroyed(true))
+			return;
+
+		add(sceneObject, true);
+	}
+
+	void SceneObjectNameIndex::notifyRenamed(const HSceneObject& sceneObject)
+	{
+		if (!mEnabled || mIsDirty || sceneObject.isDestroyed(true))
+			return;
+
+		add(sceneObject, false);
+	}
+
+	bool SceneObjectNameIndex::findChild(const HSceneObject& parent, const String& name, HSceneObject& output)
+	{
+		output = nullptr;
+		if (!mEnabled)
+			return false;
+
+		updateIfDirty();
+
+		// Scene objects created from native code might not be indexed, so let the hierarchy search handle misses
+		auto iterFind = mEntries.find(name);
+		if (iterFind == mEntries.end())
+			return false;
+
+		Vector<HSceneObject> found;
+		appendDescendants(parent, name, iterFind->second, found);
+
+		if (found.empty())
+			return false;
+
+		sortInHierarchyOrder(parent, found);
+		output = found[0];
+
+		return true;
+	}
+
+	bool SceneObjectNameIndex::findChildren(const HSceneObject& parent, const String& name, Vector<HSceneObject>& output)
+	{
+		if (!mEnabled)
+			return false;
+
+		updateIfDirty();
+
+		auto iterFind = mEntries.find(name);
+		if (iterFind == mEntries.end())
+			return false;
+
+		appendDescendants(parent, name, iterFind->second, output);
+		sortInHierarchyOrder(parent, output);
+
+		return true;
+	}
+
+	bool SceneObjectNameIndex::findChildrenWithPrefix(const HSceneObject& parent, const String& prefix,
+		Vector<HSceneObject>& output)
+	{
+		if (!mEnabled)
+			return false;
+
+		updateIfDirty();
+
+		// Names are sorted, so all names starting with the prefix are stored sequentially starting at the prefix itself
+		bool anyIndexed = false;
+		for (auto iter = mEntries.lower_bound(prefix); iter != mEntries.end(); ++iter)
+		{
+			if (iter->first.compare(0, prefix.size(), prefix) != 0)
+				break;
+
+			appendDescendants(parent, iter->first, iter->second, output);
+			anyIndexed = true;
+		}
+
+		if (!anyIndexed)
+			return false;
+
+		sortInHierarchyOrder(parent, output);
+		return true;
+	}
+
+	void SceneObjectNameIndex::sortInHierarchyOrder(const HSceneObject& parent, Vector<HSceneObject>& sceneObjects)
+	{
+		if (sceneObjects.size() < 2)
+			return;
+
+		// Find the path of child indices leading from the parent to each of the scene objects
+		UINT64 parentId = parent.getInstanceId();
+		Vector<std::pair<Vector<UINT32>, HSceneObject>> paths;
+		paths.reserve(sceneObjects.size());
+
+		for (auto& sceneObject : sceneObjects)
+		{
+			Vector<UINT32> path;
+
+			HSceneObject current = sceneObject;
+			while (current.getInstanceId() != parentId)
+			{
+				HSceneObject currentParent = current->getParent();
+
+				UINT32 numChildren = currentParent->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+				{
+					if (currentParent->getChild(i).getInstanceId() == current.getInstanceId())
+					{
+						path.push_back(i);
+						break;
+					}
+				}
+
+				current = currentParent;
+			}
+
+			std::reverse(path.begin(), path.end());
+			paths.push_back(std::make_pair(path, sceneObject));
+		}
+
+		// Hierarchy search checks all children of a scene object before descending into any of them
+		auto isBefore = [](const std::pair<Vector<UINT32>, HSceneObject>& lhs,
+			const std::pair<Vector<UINT32>, HSceneObject>& rhs)
+		{
+			const Vector<UINT32>& a = lhs.first;
+			const Vector<UINT32>& b = rhs.first;
+
+			UINT32 common = 0;
+			while (common < a.size() && common < b.size() && a[common] == b[common])
+				common++;
+
+			// Ancestors are found before their descendants
+			if (common == a.size())
+				return common != b.size();
+
+			if (common == b.size())
+				return false;
+
+			bool aIsChild = a.size() == (common + 1);
+			bool bIsChild = b.size() == (common + 1);
+			if (aIsChild != bIsChild)
+				return aIsChild;
+
+			return a[common] < b[common];
+		};
+
+		std::sort(paths.begin(), paths.end(), isBefore);
+
+		for (UINT32 i = 0; i < (UINT32)paths.size(); i++)
+			sceneObjects[i] = paths[i].second;
+	}
+
+	void SceneObjectNameIndex::updateIfDirty()
+	{
+		HSceneObject root = gSceneManager().getRootNode();
+		bool rootChanged = mRoot.isDestroyed(true) || root.isDestroyed(true) ||
+			mRoot.getInstanceId() != root.getInstanceId();
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+		if (!mIsDirty && !rootChanged)
+		{
+			if (mCheckedFrameIdx != frameIdx)
+			{
+				addUntracked();
+				mCheckedFrameIdx = frameIdx;
+			}
+
+			return;
+		}
+
+		mEntries.clear();
+		mIndexedNames.clear();
+		mRoot = root;
+		mIsDirty = false;
+		mCheckedFrameIdx = frameIdx;
+
+		if (mRoot.isDestroyed(true))
+			return;
+
+		// Root itself is never a descendant of anything, so only its children need to be indexed
+		UINT32 numChildren = mRoot->getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+			add(mRoot->getChild(i), true);
+	}
+
+	void SceneObjectNameIndex::addUntracked()
+	{
+		if (mRoot.isDestroyed(true))
+			return;
+
+		Vector<HSceneObject> todo;
+		UINT32 numRootChildren = mRoot->getNumChildren();
+		for (UINT32 i = 0; i < numRootChildren; i++)
+			todo.push_back(mRoot->getChild(i));
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.back();
+			todo.pop_back();
+
+			// Checks the name as well, in order to pick up objects renamed from native code
+			auto iterFind = mIndexedNames.find(current.getInstanceId());
+			if (iterFind == mIndexedNames.end() || iterFind->second != current->getName())
+				add(current, false);
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push_back(current->getChild(i));
+		}
+	}
+
+	void SceneObjectNameIndex::add(const HSceneObject& sceneObject, bool recursive)
+	{
+		Vector<HSceneObject> todo;
+		todo.push_back(sceneObject);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.back();
+			todo.pop_back();
+
+			UINT64 instanceId = current.getInstanceId();
+			const String& name = current->getName();
+
+			auto iterFind = mIndexedNames.find(instanceId);
+			if (iterFind != mIndexedNames.end())
+			{
+				if (iterFind->second == name)
+					continue;
+
+				remove(instanceId);
+			}
+
+			mEntries[name].push_back(current);
+			mIndexedNames[instanceId] = name;
+
+			if (!recursive)
+				continue;
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push_back(current->getChild(i));
+		}
+	}
+
+	void SceneObjectNameIndex::remove(UINT64 instanceId)
+	{
+		auto iterFindName = mIndexedNames.find(instanceId);
+		if (iterFindName == mIndexedNames.end())
+			return;
+
+		auto iterFindEntries = mEntries.find(iterFindName->second);
+		if (iterFindEntries != mEntries.end())
+		{
+			Vector<HSceneObject>& entries = iterFindEntries->second;
+			for (UINT32 i = 0; i < (UINT32)entries.size(); i++)
+			{
+				if (entries[i].getInstanceId() != instanceId)
+					continue;
+
+				std::swap(entries[i], entries.back());
+				entries.pop_back();
+				break;
+			}
+
+			if (entries.empty())
+				mEntries.erase(iterFindEntries);
+		}
+
+		mIndexedNames.erase(iterFindName);
+	}
+
+	void SceneObjectNameIndex::appendDescendants(const HSceneObject& parent, const String& name,
+		const Vector<HSceneObject>& entries, Vector<HSceneObject>& output)
+	{
+		for (auto& entry : entries)
+		{
+			if (entry.isDestroyed(true) || entry->getName() != name)
+				continue;
+
+			if (isDescendant(entry, parent))
+				output.push_back(entry);
+		}
+	}
+
+	bool SceneObjectNameIndex::isDescendant(const HSceneObject& sceneObject, const HSceneObject& parent)
+	{
+		UINT64 parentId = parent.getInstanceId();
+
+		HSceneObject current = sceneObject->getParent();
+		while (current != nullptr)
+		{
+			if (current.getInstanceId() == parentId)
+				return true;
+
+			current = current->getParent();
+		}
+
+		return false;
+	}
+
+	void SceneObjectNameIndex::onGameObjectDestroyed(const HGameObject& go)
+	{
+		if (!mEnabled || mIsDirty)
+			return;
+
+		remove(go.getInstanceId());
+	}
+}
@@ -0,0 +1,131 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/**
+	 * Optional index that maps names of scene objects in the active scene to the scene objects themselves, allowing
+	 * recursive name lookups without traversing the hierarchy. When enabled it is used by the scripting
+	 * SceneObject.FindChild and SceneObject.FindChildren methods.
+	 *
+	 * The index is built on first query and is rebuilt whenever the scene root changes. Scene objects created, renamed,
+	 * cloned or instantiated from prefabs through the scripting API, as well as destroyed scene objects, are tracked
+	 * incrementally. Scene objects created or renamed directly from native code are not reported to the index, so on
+	 * the first query of each frame the scene is checked for objects that aren't indexed under their current name, and
+	 * such objects are added. Query results are always validated against the current name and hierarchy, meaning the
+	 * index never returns an object that doesn't match the query. Queries that find no matches fall back to a hierarchy
+	 * search, so objects created natively during the current frame can still be found.
+	 *
+	 * Results are returned in the same order as the hierarchy search would return them.
+	 */
+	class BS_SCR_BE_EXPORT SceneObjectNameIndex : public Module<SceneObjectNameIndex>
+	{
+	public:
+		SceneObjectNameIndex();
+		~SceneObjectNameIndex();
+
+		/** Enables or disables the index. Index contents are released when disabled. */
+		void setEnabled(bool enabled);
+
+		/** Checks should the index be used for scene object lookups. */
+		bool isEnabled() const { return mEnabled; }
+
+		/** Marks the index as out of date, causing it to be rebuilt on next query. */
+		void markDirty() { mIsDirty = true; }
+
+		/** Registers a newly created scene object, and all of its descendants, with the index. */
+		void notifyCreated(const HSceneObject& sceneObject);
+
+		/** Updates the index entry of a scene object whose name has changed. */
+		void notifyRenamed(const HSceneObject& sceneObject);
+
+		/**
+		 * Attempts to find a descendant of @p parent with the specified name.
+		 *
+		 * @param[in]	parent	Scene object whose descendants to search.
+		 * @param[in]	name	Name of the scene object to find.
+		 * @param[out]	output	Found scene object. If there are multiple descendants with the specified name, the one
+		 *						that comes first in hierarchy order is returned.
+		 * @return				False if the index cannot provide the result, in which case the caller should fall back to
+		 *						a hierarchy search. This happens if the index is disabled, or if no indexed descendant
+		 *						has the specified name.
+		 */
+		bool findChild(const HSceneObject& parent, const String& name, HSceneObject& output);
+
+		/**
+		 * Finds all descendants of @p parent with the specified name, in hierarchy order.
+		 *
+		 * @param[in]	parent	Scene object whose descendants to search.
+		 * @param[in]	name	Name of the scene objects to find.
+		 * @param[out]	output	Found scene objects.
+		 * @return				False if the index is disabled, or if no indexed scene object has the specified name, in
+		 *						which case the caller should fall back to a hierarchy search.
+		 */
+		bool findChildren(const HSceneObject& parent, const String& name, Vector<HSceneObject>& output);
+
+		/**
+		 * Finds all descendants of @p parent whose name starts with the specified prefix, in hierarchy order.
+		 *
+		 * @param[in]	parent	Scene object whose descendants to search.
+		 * @param[in]	prefix	Prefix the names of returned scene objects start with.
+		 * @param[out]	output	Found scene objects.
+		 * @return				False if the index is disabled, or if no indexed scene object name starts with the
+		 *						prefix, in which case the caller should fall back to a hierarchy search.
+		 */
+		bool findChildrenWithPrefix(const HSceneObject& parent, const String& prefix, Vector<HSceneObject>& output);
+
+		/**
+		 * Sorts descendants of @p parent in the order SceneObject::findChildren() visits them: all direct children of a
+		 * scene object come before any of their own descendants.
+		 */
+		static void sortInHierarchyOrder(const HSceneObject& parent, Vector<HSceneObject>& sceneObjects);
+
+	private:
+		/**
+		 * Rebuilds the index if it was marked dirty or the scene root changed since it was built. Otherwise, if this is
+		 * the first query this frame, indexes any scene objects created or renamed without notifying the index.
+		 */
+		void updateIfDirty();
+
+		/** Adds scene objects that aren't indexed under their current name to the index. */
+		void addUntracked();
+
+		/** Adds a scene object, and optionally all of its descendants, to the index. */
+		void add(const HSceneObject& sceneObject, bool recursive);
+
+		/** Removes a scene object with the specified instance ID from the index. */
+		void remove(UINT64 instanceId);
+
+		/**
+		 * Appends entries indexed under @p name to @p output, if they are descendants of @p parent. Entries that were
+		 * destroyed, or renamed without notifying the index, are skipped.
+		 */
+		static void appendDescendants(const HSceneObject& parent, const String& name, const Vector<HSceneObject>& entries,
+			Vector<HSceneObject>& output);
+
+		/** Checks is @p sceneObject a direct or indirect child of @p parent. */
+		static bool isDescendant(const HSceneObject& sceneObject, const HSceneObject& parent);
+
+		/** Triggered when a game object is destroyed. */
+		void onGameObjectDestroyed(const HGameObject& go);
+
+		Map<String, Vector<HSceneObject>> mEntries;
+		UnorderedMap<UINT64, String> mIndexedNames;
+		HSceneObject mRoot;
+		bool mEnabled = false;
+		bool mIsDirty = true;
+		UINT64 mCheckedFrameIdx = 0;
+
+		HEvent mOnGameObjectDestroyedConn;
+	};
+
+	/** @} */
+}
@@ -5,6 +5,10 @@
 #include "BsEngineScriptLibrary.h"
 #include "Script/BsScriptManager.h"
 #include "Wrappers/GUI/BsScriptGUI.h"
+#include "Wrappers/BsScriptDebug.h"
+#include "Wrappers/BsScriptResources.h"
+#include "Wrappers/BsScriptCameraRenderSettings.h"
+#include "BsScriptGameObjectManager.h"
 #include "BsPlayInEditorManager.h"
 
 namespace bs
@@ -28,5 +32,9 @@ namespace bs
 		PlayInEditorManager::instance().update();
 		ScriptObjectManager::instance().update();
 		ScriptGUI::update();
+		ScriptDebug::update();
+		ScriptResources::update();
+		ScriptCameraRenderSettings::update();
+		ScriptGameObjectManager::instance().update();
 	}
 }
\ No newline at end of file
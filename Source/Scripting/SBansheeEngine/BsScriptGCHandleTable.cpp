@@ -0,0 +1,245 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsScriptGCHandleTable.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+
+namespace bs
+{
+	ScriptGCHandleTable::ScriptGCHandleTable()
+	{
+		for (UINT32 i = 0; i < (UINT32)ScriptGCHandleCategory::Count; i++)
+			mNumLiveHandles[i] = 0;
+
+		for (UINT32 i = 0; i < MAX_CHUNKS; i++)
+			mChunks[i].store(nullptr, std::memory_order_relaxed);
+	}
+
+	ScriptGCHandleTable::~ScriptGCHandleTable()
+	{
+		releaseAll();
+
+		for (UINT32 i = 0; i < MAX_CHUNKS; i++)
+		{
+			Chunk* chunk = mChunks[i].load(std::memory_order_relaxed);
+			if (chunk != nullptr)
+				bs_delete(chunk);
+		}
+	}
+
+	UINT32 ScriptGCHandleTable::newHandle(MonoObject* object, ScriptGCHandleCategory category)
+	{
+		if (object == nullptr)
+			return 0;
+
+		Lock lock(mMutex);
+
+		UINT32 slotIdx = allocateSlot(category, false);
+
+		ScriptArray chunkArray(getChunkArray(slotIdx));
+		chunkArray.set(slotIdx % SLOTS_PER_CHUNK, object);
+
+		return (mGeneration.load(std::memory_order_relaxed) << SLOT_BITS) | (slotIdx + 1);
+	}
+
+	UINT32 ScriptGCHandleTable::newWeakHandle(MonoObject* object, ScriptGCHandleCategory category)
+	{
+		if (object == nullptr)
+			return 0;
+
+		Lock lock(mMutex);
+
+		UINT32 slotIdx = allocateSlot(category, true);
+		getSlot(slotIdx).weakHandle = MonoUtil::newWeakGCHandle(object);
+
+		return (mGeneration.load(std::memory_order_relaxed) << SLOT_BITS) | (slotIdx + 1);
+	}
+
+	void ScriptGCHandleTable::freeHandle(UINT32 handle)
+	{
+		Lock lock(mMutex);
+
+		UINT32 slotIdx = getSlotIdx(handle);
+		if (slotIdx == (UINT32)-1)
+			return;
+
+		Slot& slot = getSlot(slotIdx);
+		if (slot.weak)
+		{
+			MonoUtil::freeGCHandle(slot.weakHandle);
+			slot.weakHandle = 0;
+		}
+		else
+		{
+			ScriptArray chunkArray(getChunkArray(slotIdx));
+			chunkArray.set(slotIdx % SLOTS_PER_CHUNK, (MonoObject*)nullptr);
+		}
+
+		mNumLiveHandles[(UINT32)slot.category]--;
+
+		slot.used = false;
+		slot.nextFree = mFirstFreeSlot;
+		mFirstFreeSlot = slotIdx;
+	}
+
+	MonoObject* ScriptGCHandleTable::getObject(UINT32 handle) const
+	{
+#if BS_DEBUG_MODE
+		mNumActiveReaders.fetch_add(1, std::memory_order_acquire);
+#endif
+
+		MonoObject* object = nullptr;
+
+		UINT32 slotIdx = getSlotIdx(handle);
+		if (slotIdx != (UINT32)-1)
+		{
+			const Slot& slot = getSlot(slotIdx);
+			if (slot.weak)
+				object = MonoUtil::getObjectFromGCHandle(slot.weakHandle);
+			else
+			{
+				ScriptArray chunkArray(getChunkArray(slotIdx));
+				object = chunkArray.get<MonoObject*>(slotIdx % SLOTS_PER_CHUNK);
+			}
+		}
+
+#if BS_DEBUG_MODE
+		mNumActiveReaders.fetch_sub(1, std::memory_order_release);
+#endif
+
+		return object;
+	}
+
+	void ScriptGCHandleTable::releaseAll()
+	{
+		Lock lock(mMutex);
+
+#if BS_DEBUG_MODE
+		// Slots below are reset non-atomically, readers could see a slot as used and then read a freed handle
+		assert(mNumActiveReaders.load(std::memory_order_acquire) == 0 &&
+			"ScriptGCHandleTable::releaseAll() called concurrently with getObject().");
+#endif
+
+		// Invalidate any outstanding handles first. Generation is never zero so a valid handle can never be zero.
+		UINT32 generation = mGeneration.load(std::memory_order_relaxed);
+		mGeneration.store((generation % 0xFF) + 1, std::memory_order_release);
+
+		// Chunks themselves are kept (and reused), as lock-free readers might still be referencing them
+		for (UINT32 i = 0; i < MAX_CHUNKS; i++)
+		{
+			Chunk* chunk = mChunks[i].load(std::memory_order_relaxed);
+			if (chunk == nullptr)
+				break;
+
+			for (auto& slot : chunk->slots)
+			{
+				if (slot.used && slot.weak)
+					MonoUtil::freeGCHandle(slot.weakHandle);
+
+				slot = Slot();
+			}
+
+			if (chunk->arrayHandle != 0)
+			{
+				MonoUtil::freeGCHandle(chunk->arrayHandle);
+				chunk->arrayHandle = 0;
+			}
+		}
+
+		mNumSlots = 0;
+		mFirstFreeSlot = (UINT32)-1;
+
+		for (UINT32 i = 0; i < (UINT32)ScriptGCHandleCategory::Count; i++)
+			mNumLiveHandles[i] = 0;
+
+#if BS_DEBUG_MODE
+		assert(mNumActiveReaders.load(std::memory_order_acquire) == 0 &&
+			"ScriptGCHandleTable::releaseAll() called concurrently with getObject().");
+#endif
+	}
+
+	UINT32 ScriptGCHandleTable::getNumLiveHandles(ScriptGCHandleCategory category) const
+	{
+		Lock lock(mMutex);
+		return mNumLiveHandles[(UINT32)category];
+	}
+
+	UINT32 ScriptGCHandleTable::getNumLiveHandles() const
+	{
+		Lock lock(mMutex);
+
+		UINT32 total = 0;
+		for (UINT32 i = 0; i < (UINT32)ScriptGCHandleCategory::Count; i++)
+			total += mNumLiveHandles[i];
+
+		return total;
+	}
+
+	UINT32 ScriptGCHandleTable::allocateSlot(ScriptGCHandleCategory category, bool weak)
+	{
+		UINT32 slotIdx;
+		if (mFirstFreeSlot != (UINT32)-1)
+		{
+			slotIdx = mFirstFreeSlot;
+			mFirstFreeSlot = getSlot(slotIdx).nextFree;
+		}
+		else
+		{
+			slotIdx = mNumSlots++;
+
+			UINT32 chunkIdx = slotIdx / SLOTS_PER_CHUNK;
+			assert(chunkIdx < MAX_CHUNKS && "GC handle table full.");
+
+			Chunk* chunk = mChunks[chunkIdx].load(std::memory_order_relaxed);
+			if (chunk == nullptr)
+			{
+				chunk = bs_new<Chunk>();
+				mChunks[chunkIdx].store(chunk, std::memory_order_release);
+			}
+
+			if (chunk->arrayHandle == 0)
+			{
+				ScriptArray chunkArray(MonoUtil::getObjectClass(), SLOTS_PER_CHUNK);
+				chunk->arrayHandle = MonoUtil::newGCHandle((MonoObject*)chunkArray.getInternal(), false);
+			}
+		}
+
+		Slot& slot = getSlot(slotIdx);
+		slot.used = true;
+		slot.weak = weak;
+		slot.category = category;
+		slot.nextFree = (UINT32)-1;
+
+		mNumLiveHandles[(UINT32)category]++;
+		return slotIdx;
+	}
+
+	UINT32 ScriptGCHandleTable::getSlotIdx(UINT32 handle) const
+	{
+		if (handle == 0 || (handle >> SLOT_BITS) != mGeneration.load(std::memory_order_acquire))
+			return (UINT32)-1;
+
+		UINT32 slotIdx = (handle & SLOT_MASK) - 1;
+		UINT32 chunkIdx = slotIdx / SLOTS_PER_CHUNK;
+		if (chunkIdx >= MAX_CHUNKS)
+			return (UINT32)-1;
+
+		Chunk* chunk = mChunks[chunkIdx].load(std::memory_order_acquire);
+		if (chunk == nullptr || !chunk->slots[slotIdx % SLOTS_PER_CHUNK].used)
+			return (UINT32)-1;
+
+		return slotIdx;
+	}
+
+	ScriptGCHandleTable::Slot& ScriptGCHandleTable::getSlot(UINT32 slotIdx) const
+	{
+		Chunk* chunk = mChunks[slotIdx / SLOTS_PER_CHUNK].load(std::memory_order_acquire);
+		return chunk->slots[slotIdx % SLOTS_PER_CHUNK];
+	}
+
+	MonoArray* ScriptGCHandleTable::getChunkArray(UINT32 slotIdx) const
+	{
+		Chunk* chunk = mChunks[slotIdx / SLOTS_PER_CHUNK].load(std::memory_order_acquire);
+		return (MonoArray*)MonoUtil::getObjectFromGCHandle(chunk->arrayHandle);
+	}
+}
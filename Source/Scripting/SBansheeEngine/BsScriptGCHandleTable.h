@@ -0,0 +1,144 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "Utility/BsModule.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/** Subsystems that own handles allocated through ScriptGCHandleTable. Used for keeping track of live handle counts. */
+	enum class ScriptGCHandleCategory
+	{
+		Serialization,
+		Editor,
+		GUI,
+		Other,
+		Count // Keep at end
+	};
+
+	/**
+	 * Keeps managed objects alive (or tracks them weakly) on behalf of native code, without allocating a new Mono GC
+	 * handle for every object.
+	 *
+	 * Strong handles are backed by slots in a small number of managed object arrays, each of which is kept alive by a
+	 * single GC handle. Allocating or freeing a strong handle therefore only writes an array element and recycles the
+	 * slot. Weak handles still require a Mono weak GC handle per object, but their slots are pooled and counted the same
+	 * way.
+	 *
+	 * All handles are released in bulk when the script domain is unloaded. Handles allocated before the release are
+	 * detected as stale and resolve to null.
+	 *
+	 * @note	Thread safe, except for releaseAll(). getObject() doesn't lock, since slot storage never moves once
+	 *			allocated.
+	 */
+	class BS_SCR_BE_EXPORT ScriptGCHandleTable : public Module<ScriptGCHandleTable>
+	{
+		static constexpr UINT32 SLOTS_PER_CHUNK = 256;
+		static constexpr UINT32 MAX_CHUNKS = 4096;
+		static constexpr UINT32 SLOT_BITS = 24;
+		static constexpr UINT32 SLOT_MASK = (1 << SLOT_BITS) - 1;
+
+		/** Information about a single entry in the handle table. */
+		struct Slot
+		{
+			UINT32 weakHandle = 0;
+			UINT32 nextFree = (UINT32)-1;
+			ScriptGCHandleCategory category = ScriptGCHandleCategory::Other;
+			bool used = false;
+			bool weak = false;
+		};
+
+		/** A fixed-size block of slots, along with the managed array that stores their strong references. */
+		struct Chunk
+		{
+			Slot slots[SLOTS_PER_CHUNK];
+			UINT32 arrayHandle = 0;
+		};
+
+	public:
+		ScriptGCHandleTable();
+		~ScriptGCHandleTable();
+
+		/**
+		 * Allocates a new strong handle that keeps the provided object alive until freeHandle() is called.
+		 *
+		 * @param[in]	object		Object to keep alive.
+		 * @param[in]	category	Subsystem owning the handle, used for statistics.
+		 * @return					Handle to the object. Never zero unless @p object is null.
+		 */
+		UINT32 newHandle(MonoObject* object, ScriptGCHandleCategory category = ScriptGCHandleCategory::Other);
+
+		/**
+		 * Allocates a new weak handle that references the provided object, but doesn't prevent it from being collected.
+		 *
+		 * @param[in]	object		Object to reference.
+		 * @param[in]	category	Subsystem owning the handle, used for statistics.
+		 * @return					Handle to the object. Never zero unless @p object is null.
+		 */
+		UINT32 newWeakHandle(MonoObject* object, ScriptGCHandleCategory category = ScriptGCHandleCategory::Other);
+
+		/** Frees a handle allocated with newHandle() or newWeakHandle(). Stale or zero handles are ignored. */
+		void freeHandle(UINT32 handle);
+
+		/**
+		 * Returns the object referenced by the handle. Returns null if the handle is stale, or if it is a weak handle and
+		 * the object has been collected. Doesn't lock, but must not be called for a handle that is concurrently being
+		 * freed.
+		 */
+		MonoObject* getObject(UINT32 handle) const;
+
+		/**
+		 * Releases all currently allocated handles and the managed arrays backing them. Must be called before the script
+		 * domain is unloaded. Any outstanding handles become stale and are ignored by the other methods.
+		 *
+		 * @note	Slots are reset without synchronizing with getObject(), so this must never run concurrently with any
+		 *			readers. This holds during domain unload and shutdown, where it is called, as no scripting code runs
+		 *			at that point. Checked by an assert in debug builds.
+		 */
+		void releaseAll();
+
+		/** Returns the number of currently allocated handles owned by the specified subsystem. */
+		UINT32 getNumLiveHandles(ScriptGCHandleCategory category) const;
+
+		/** Returns the total number of currently allocated handles. */
+		UINT32 getNumLiveHandles() const;
+
+	private:
+		/** Finds a free slot, or creates a new one (and a new backing array if needed). Returns the slot index. */
+		UINT32 allocateSlot(ScriptGCHandleCategory category, bool weak);
+
+		/** Converts a handle into a slot index. Returns -1 if the handle is stale. */
+		UINT32 getSlotIdx(UINT32 handle) const;
+
+		/** Returns the slot with the specified index. Slot's chunk must have been allocated. */
+		Slot& getSlot(UINT32 slotIdx) const;
+
+		/** Returns the managed array that contains the slot with the specified index. */
+		MonoArray* getChunkArray(UINT32 slotIdx) const;
+
+		/**
+		 * Chunks are allocated on demand and only freed on destruction, so a pointer published here remains valid for
+		 * lock-free reads. Chunks are reused after releaseAll().
+		 */
+		std::atomic<Chunk*> mChunks[MAX_CHUNKS];
+		UINT32 mNumSlots = 0;
+		UINT32 mFirstFreeSlot = (UINT32)-1;
+		std::atomic<UINT32> mGeneration { 1 };
+		UINT32 mNumLiveHandles[(UINT32)ScriptGCHandleCategory::Count];
+
+#if BS_DEBUG_MODE
+		/** Number of getObject() calls in progress, used for detecting calls concurrent with releaseAll(). */
+		mutable std::atomic<UINT32> mNumActiveReaders { 0 };
+#endif
+
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}
@@ -15,6 +15,7 @@
 #include "BsMonoClass.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "BsScriptObjectManager.h"
+#include "Utility/BsTime.h"
 
 using namespace std::placeholders;
 
@@ -68,7 +69,7 @@ namespace bs
 			BS_EXCEPT(InvalidStateException, "Script object for this SceneObject already exists.");
 
 		ScriptSceneObject* nativeInstance = new (bs_alloc<ScriptSceneObject>()) ScriptSceneObject(existingInstance, sceneObject);
-		mScriptSceneObjects[sceneObject.getInstanceId()] = nativeInstance;
+		mScriptSceneObjects.insert(sceneObject.getInstanceId(), nativeInstance);
 
 		return nativeInstance;
 	}
@@ -80,7 +81,7 @@ namespace bs
 			ScriptManagedComponent(existingInstance, component);
 
 		UINT64 instanceId = component->getInstanceId();
-		mScriptComponents[instanceId] = nativeInstance;
+		mScriptComponents.insert(instanceId, nativeInstance);
 
 		return nativeInstance;
 	}
@@ -95,72 +96,64 @@ namespace bs
 
 		ScriptComponentBase* nativeInstance = info->createCallback(component);
 		nativeInstance->setNativeHandle(static_object_cast<GameObject>(component));
+		nativeInstance->mLastAccessTime = gTime().getTime();
 
 		UINT64 instanceId = component->getInstanceId();
-		mScriptComponents[instanceId] = nativeInstance;
+		mScriptComponents.insert(instanceId, nativeInstance);
 
 		return nativeInstance;
 	}
 
 	ScriptComponentBase* ScriptGameObjectManager::getBuiltinScriptComponent(const HComponent& component, bool createNonExisting)
 	{
+		if (!createNonExisting)
+		{
+			// Only a lookup, don't mark the interop object as accessed so it can still become idle
+			ScriptComponentBase* scriptComponent = mScriptComponents.find(component.getInstanceId());
+			if (scriptComponent != nullptr && scriptComponent->getManagedInstance() != nullptr)
+				return scriptComponent;
+
+			return nullptr;
+		}
+
 		ScriptComponentBase* scriptComponent = getScriptComponent(component.getInstanceId());
 		if (scriptComponent != nullptr)
 			return scriptComponent;
 
-		if(createNonExisting)
-			return createBuiltinScriptComponent(component);
-
-		return nullptr;
+		return createBuiltinScriptComponent(component);
 	}
 
 	ScriptManagedComponent* ScriptGameObjectManager::getManagedScriptComponent(const HManagedComponent& component) const
 	{
-		auto findIter = mScriptComponents.find(component.getInstanceId());
-		if (findIter != mScriptComponents.end())
-			return static_cast<ScriptManagedComponent*>(findIter->second);
-
-		return nullptr;
+		return static_cast<ScriptManagedComponent*>(mScriptComponents.find(component.getInstanceId()));
 	}
 
-	ScriptComponentBase* ScriptGameObjectManager::getScriptComponent(UINT64 instanceId) const
+	ScriptComponentBase* ScriptGameObjectManager::getScriptComponent(UINT64 instanceId)
 	{
-		auto findIter = mScriptComponents.find(instanceId);
-		if (findIter != mScriptComponents.end())
-			return findIter->second;
+		ScriptComponentBase* component = mScriptComponents.find(instanceId);
+		if (component == nullptr || !acquireScriptComponent(instanceId, component))
+			return nullptr;
 
-		return nullptr;
+		return component;
 	}
 
 	ScriptSceneObject* ScriptGameObjectManager::getScriptSceneObject(const HSceneObject& sceneObject) const
 	{
-		auto findIter = mScriptSceneObjects.find(sceneObject.getInstanceId());
-		if (findIter != mScriptSceneObjects.end())
-			return findIter->second;
-
-		return nullptr;
+		return mScriptSceneObjects.find(sceneObject.getInstanceId());
 	}
 
 	ScriptSceneObject* ScriptGameObjectManager::getScriptSceneObject(UINT64 instanceId) const
 	{
-		auto findIter = mScriptSceneObjects.find(instanceId);
-		if (findIter != mScriptSceneObjects.end())
-			return findIter->second;
-
-		return nullptr;
+		return mScriptSceneObjects.find(instanceId);
 	}
 
-	ScriptGameObjectBase* ScriptGameObjectManager::getScriptGameObject(UINT64 instanceId) const
+	ScriptGameObjectBase* ScriptGameObjectManager::getScriptGameObject(UINT64 instanceId)
 	{
-		auto findIter = mScriptSceneObjects.find(instanceId);
-		if (findIter != mScriptSceneObjects.end())
-			return findIter->second;
-
-		auto findIter2 = mScriptComponents.find(instanceId);
-		if (findIter2 != mScriptComponents.end())
-			return findIter2->second;
+		ScriptSceneObject* so = mScriptSceneObjects.find(instanceId);
+		if (so != nullptr)
+			return so;
 
-		return nullptr;
+		return getScriptComponent(instanceId);
 	}
 
 	void ScriptGameObjectManager::destroyScriptSceneObject(ScriptSceneObject* sceneObject)
@@ -173,17 +166,92 @@ namespace bs
 
 	void ScriptGameObjectManager::destroyScriptComponent(ScriptComponentBase* component)
 	{
+		// Interop objects whose managed instance was collected while idle are replaced before they get destroyed, in
+		// which case the registered object is the replacement
 		UINT64 instanceId = component->getNativeHandle().getInstanceId();
-		mScriptComponents.erase(instanceId);
+		if (mScriptComponents.find(instanceId) == component)
+			mScriptComponents.erase(instanceId);
 
 		bs_delete(component);
 	}
 
+	Vector<ScriptGameObjectManager::BuiltinComponentWrapperStats>
+		ScriptGameObjectManager::getBuiltinComponentWrapperStats() const
+	{
+		Vector<BuiltinComponentWrapperStats> output;
+		mScriptComponents.forEach([&output](ScriptComponentBase* scriptComponent)
+		{
+			HComponent component = scriptComponent->getComponent();
+			if (component.isDestroyed())
+				return;
+
+			UINT32 typeId = component->getRTTI()->getRTTIId();
+			if (typeId == TID_ManagedComponent)
+				return;
+
+			auto iterFind = std::find_if(output.begin(), output.end(),
+				[typeId](const BuiltinComponentWrapperStats& entry) { return entry.typeId == typeId; });
+
+			if (iterFind == output.end())
+			{
+				output.push_back({ typeId, 0, 0 });
+				iterFind = output.end() - 1;
+			}
+
+			if (scriptComponent->_isManagedReferenceWeak())
+				iterFind->numIdle++;
+			else
+				iterFind->numReferenced++;
+		});
+
+		return output;
+	}
+
+	void ScriptGameObjectManager::update()
+	{
+		if (mBuiltinComponentIdleTime <= 0.0f)
+			return;
+
+		float time = gTime().getTime();
+		if ((time - mLastIdleCheckTime) < IDLE_CHECK_INTERVAL)
+			return;
+
+		mLastIdleCheckTime = time;
+		releaseIdleBuiltinComponents(mBuiltinComponentIdleTime);
+	}
+
+	void ScriptGameObjectManager::releaseIdleBuiltinComponents(float idleTime)
+	{
+		float time = gTime().getTime();
+		mScriptComponents.forEach([time, idleTime](ScriptComponentBase* scriptComponent)
+		{
+			if (scriptComponent->_isManagedReferenceWeak() || (time - scriptComponent->mLastAccessTime) < idleTime)
+				return;
+
+			// Managed components are the components themselves, only built-in component wrappers can be recreated
+			HComponent component = scriptComponent->getComponent();
+			if (component.isDestroyed() || component->getRTTI()->getRTTIId() == TID_ManagedComponent)
+				return;
+
+			scriptComponent->_weakenManagedReference();
+		});
+	}
+
+	bool ScriptGameObjectManager::acquireScriptComponent(UINT64 instanceId, ScriptComponentBase* component)
+	{
+		component->mLastAccessTime = gTime().getTime();
+		if (!component->_isManagedReferenceWeak() || component->_strengthenManagedReference())
+			return true;
+
+		// Managed instance was collected, its finalizer will destroy the interop object once it runs
+		mScriptComponents.erase(instanceId);
+		return false;
+	}
+
 	void ScriptGameObjectManager::sendComponentResetEvents()
 	{
-		for (auto& scriptObjectEntry : mScriptComponents)
+		mScriptComponents.forEach([](ScriptComponentBase* scriptComponent)
 		{
-			ScriptComponentBase* scriptComponent = scriptObjectEntry.second;
 			HComponent component = scriptComponent->getComponent();
 
 			if (component->getRTTI()->getRTTIId() == TID_ManagedComponent)
@@ -192,7 +260,7 @@ namespace bs
 				if (!managedComponent.isDestroyed())
 					managedComponent->triggerOnReset();
 			}
-		}
+		});
 	}
 
 	void ScriptGameObjectManager::onGameObjectDestroyed(const HGameObject& go)
@@ -206,7 +274,7 @@ namespace bs
 			mScriptSceneObjects.erase(instanceId);
 		}
 
-		ScriptComponentBase* component = getScriptComponent(instanceId);
+		ScriptComponentBase* component = mScriptComponents.find(instanceId);
 		if(component != nullptr)
 		{
 			component->_notifyDestroyed();
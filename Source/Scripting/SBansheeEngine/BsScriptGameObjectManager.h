@@ -4,6 +4,7 @@
 
 #include "BsScriptEnginePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "BsScriptGameObjectTable.h"
 
 namespace bs
 {
@@ -19,6 +20,16 @@ namespace bs
 	 */
 	class BS_SCR_BE_EXPORT ScriptGameObjectManager : public Module<ScriptGameObjectManager>
 	{
+	public:
+		/** Number of interop objects that exist for a single type of built-in component. */
+		struct BuiltinComponentWrapperStats
+		{
+			UINT32 typeId; /**< RTTI type ID of the component. */
+			UINT32 numReferenced; /**< Number of interop objects keeping their managed instance alive. */
+			UINT32 numIdle; /**< Number of idle interop objects whose managed instance can be collected. */
+		};
+
+	private:
 		/**	Contains information about a single interop object containing a game object. */
 		struct ScriptGameObjectEntry
 		{
@@ -61,7 +72,9 @@ namespace bs
 
 		/**
 		 * Attempts to find the interop object for the specified built-in component. If one cannot be found a new
-		 * script interop object is created if @p createNonExisting is enabled, or returns null otherwise.
+		 * script interop object is created if @p createNonExisting is enabled, or returns null otherwise. When
+		 * @p createNonExisting is disabled the interop object isn't marked as accessed, and null is also returned if its
+		 * managed instance was released while idle.
 		 */
 		ScriptComponentBase* getBuiltinScriptComponent(const HComponent& component, bool createNonExisting = true);
 
@@ -74,7 +87,7 @@ namespace bs
 		 * Attempts to find the interop object for a component with the specified instance ID. If one cannot be
 		 * found null is returned.
 		 */
-		ScriptComponentBase* getScriptComponent(UINT64 instanceId) const;
+		ScriptComponentBase* getScriptComponent(UINT64 instanceId);
 
 		/** Attempts to find the interop object for the specified SceneObject. If one cannot be found null is returned. */
 		ScriptSceneObject* getScriptSceneObject(const HSceneObject& sceneObject) const;
@@ -89,7 +102,7 @@ namespace bs
 		 * Attempts to find the interop object for a GameObject with the specified instance ID. If one cannot be found null
 		 * is returned.
 		 */
-		ScriptGameObjectBase* getScriptGameObject(UINT64 instanceId) const;
+		ScriptGameObjectBase* getScriptGameObject(UINT64 instanceId);
 
 		/**	Destroys and unregisters the specified SceneObject interop object. */
 		void destroyScriptSceneObject(ScriptSceneObject* sceneObject);
@@ -97,7 +110,43 @@ namespace bs
 		/**	Destroys and unregisters the specified ManagedComponent interop object. */
 		void destroyScriptComponent(ScriptComponentBase* component);
 
+		/**
+		 * Sets the time after which interop objects for built-in components stop keeping their managed instances alive,
+		 * if they haven't been requested through this manager in the meantime. Once no managed code references such an
+		 * instance it is collected along with its interop object, and a new one is created on next request. Zero
+		 * (default) keeps the interop objects alive for as long as their components.
+		 */
+		void setBuiltinComponentIdleTime(float seconds) { mBuiltinComponentIdleTime = seconds; }
+
+		/** @copydoc setBuiltinComponentIdleTime */
+		float getBuiltinComponentIdleTime() const { return mBuiltinComponentIdleTime; }
+
+		/** Returns the number of interop objects for each type of built-in component that has any. */
+		Vector<BuiltinComponentWrapperStats> getBuiltinComponentWrapperStats() const;
+
+		/**
+		 * Releases managed instances of built-in component interop objects that haven't been requested through this
+		 * manager for at least @p idleTime seconds.
+		 */
+		void releaseIdleBuiltinComponents(float idleTime);
+
+		/** Releases managed instances of idle built-in component interop objects. Must be called once per frame. */
+		void update();
+
+		/** Triggered when a built-in component is added, or a scene object is reparented, through the scripting API. */
+		Event<void()> onHierarchyModified;
+
 	private:
+		/** Interval at which built-in component interop objects are checked for idleness, in seconds. */
+		static constexpr float IDLE_CHECK_INTERVAL = 1.0f;
+
+		/**
+		 * Marks the component interop object as accessed and makes sure it holds onto its managed instance. Returns
+		 * false if the managed instance was already collected, in which case the interop object is unregistered so a new
+		 * one can be created in its place.
+		 */
+		bool acquireScriptComponent(UINT64 instanceId, ScriptComponentBase* component);
+
 		/**
 		 * Triggers OnReset methods on all registered managed components.
 		 *
@@ -108,8 +157,11 @@ namespace bs
 		/**	Triggered when the any game object is destroyed. */
 		void onGameObjectDestroyed(const HGameObject& go);
 
-		UnorderedMap<UINT64, ScriptComponentBase*> mScriptComponents;
-		UnorderedMap<UINT64, ScriptSceneObject*> mScriptSceneObjects;
+		ScriptGameObjectTable<ScriptComponentBase> mScriptComponents;
+		ScriptGameObjectTable<ScriptSceneObject> mScriptSceneObjects;
+
+		float mBuiltinComponentIdleTime = 0.0f;
+		float mLastIdleCheckTime = 0.0f;
 
 		HEvent mOnAssemblyReloadDoneConn;
 		HEvent onGameObjectDestroyedConn;
@@ -0,0 +1,141 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/**
+	 * Maps game object instance IDs to their interop objects. Instance IDs are assigned sequentially and are never
+	 * reused, so instead of hashing them they are used as direct indices into fixed size pages of entries. Pages are
+	 * allocated when the first entry in their range is inserted, and released once they become empty, so memory use is
+	 * proportional to the number of live objects (plus a single pointer for every PAGE_SIZE IDs ever assigned).
+	 *
+	 * An ID is only ever mapped to the object it was assigned to, so a stale ID (one belonging to a destroyed object)
+	 * simply finds an empty entry.
+	 */
+	template<class T>
+	class ScriptGameObjectTable
+	{
+	public:
+		ScriptGameObjectTable() = default;
+		ScriptGameObjectTable(const ScriptGameObjectTable&) = delete;
+		ScriptGameObjectTable& operator=(const ScriptGameObjectTable&) = delete;
+
+		~ScriptGameObjectTable()
+		{
+			for (auto& page : mPages)
+			{
+				if (page != nullptr)
+					bs_delete(page);
+			}
+		}
+
+		/** Returns the object mapped to the specified instance ID, or null if none. */
+		T* find(UINT64 instanceId) const
+		{
+			UINT64 pageIdx = instanceId >> PAGE_SHIFT;
+			if (pageIdx >= (UINT64)mPages.size())
+				return nullptr;
+
+			const Page* page = mPages[(size_t)pageIdx];
+			if (page == nullptr)
+				return nullptr;
+
+			return page->entries[instanceId & PAGE_MASK];
+		}
+
+		/** Maps an object to the specified instance ID, replacing any existing mapping. */
+		void insert(UINT64 instanceId, T* object)
+		{
+			size_t pageIdx = (size_t)(instanceId >> PAGE_SHIFT);
+			if (pageIdx >= mPages.size())
+				mPages.resize(pageIdx + 1, nullptr);
+
+			Page*& page = mPages[pageIdx];
+			if (page == nullptr)
+				page = bs_new<Page>();
+
+			T*& entry = page->entries[instanceId & PAGE_MASK];
+			if (entry == nullptr)
+			{
+				page->numEntries++;
+				mNumEntries++;
+			}
+
+			entry = object;
+		}
+
+		/** Removes the mapping for the specified instance ID, if one exists. */
+		void erase(UINT64 instanceId)
+		{
+			size_t pageIdx = (size_t)(instanceId >> PAGE_SHIFT);
+			if (pageIdx >= mPages.size())
+				return;
+
+			Page*& page = mPages[pageIdx];
+			if (page == nullptr)
+				return;
+
+			T*& entry = page->entries[instanceId & PAGE_MASK];
+			if (entry == nullptr)
+				return;
+
+			entry = nullptr;
+			mNumEntries--;
+
+			if (--page->numEntries == 0)
+			{
+				bs_delete(page);
+				page = nullptr;
+			}
+		}
+
+		/**
+		 * Calls @p func for every mapped object, in order of instance IDs. Objects can be inserted or removed from
+		 * within the callback, although objects inserted at higher IDs than the current one will also be visited.
+		 */
+		template<class Func>
+		void forEach(Func func) const
+		{
+			for (size_t i = 0; i < mPages.size(); i++)
+			{
+				for (UINT32 j = 0; j < PAGE_SIZE; j++)
+				{
+					// Re-read the page on every step, as the callback could have released it
+					const Page* page = mPages[i];
+					if (page == nullptr)
+						break;
+
+					if (page->entries[j] != nullptr)
+						func(page->entries[j]);
+				}
+			}
+		}
+
+		/** Returns the number of mapped objects. */
+		UINT32 size() const { return mNumEntries; }
+
+	private:
+		static constexpr UINT32 PAGE_SHIFT = 10;
+		static constexpr UINT32 PAGE_SIZE = 1 << PAGE_SHIFT;
+		static constexpr UINT64 PAGE_MASK = PAGE_SIZE - 1;
+
+		/** Entries for a contiguous range of PAGE_SIZE instance IDs. */
+		struct Page
+		{
+			T* entries[PAGE_SIZE] = {};
+			UINT32 numEntries = 0;
+		};
+
+		Vector<Page*> mPages;
+		UINT32 mNumEntries = 0;
+	};
+
+	/** @} */
+}
\ No newline at end of file
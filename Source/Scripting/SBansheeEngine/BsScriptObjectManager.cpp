@@ -6,6 +6,7 @@
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Scene/BsGameObjectManager.h"
 #include "BsMonoAssembly.h"
+#include "BsScriptGCHandleTable.h"
 
 namespace bs
 {
@@ -48,6 +49,7 @@ namespace bs
 		for (auto& scriptObject : mScriptObjects)
 			scriptObject->_clearManagedInstance();
 
+		ScriptGCHandleTable::instance().releaseAll();
 		MonoManager::instance().unloadScriptDomain();
 
 		// Unload script domain should trigger finalizers on everything, but since we usually delay
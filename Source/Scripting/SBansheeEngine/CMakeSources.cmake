@@ -9,8 +9,11 @@ set(BS_SBANSHEEENGINE_INC_NOFILTER
 	"BsManagedResourceMetaData.h"
 	"BsManagedResourceManager.h"
 	"BsScriptObjectManager.h"
+	"BsScriptGCHandleTable.h"
 	"BsEngineScriptLibrary.h"
 	"BsPlayInEditorManager.h"
+	"BsSceneObjectNameIndex.h"
+	"BsScriptGameObjectTable.h"
 )
 
 set(BS_SBANSHEEENGINE_SRC_WRAPPERS_GUI
@@ -63,8 +66,17 @@ set(BS_SBANSHEEENGINE_INC_WRAPPERS
 	"Wrappers/BsScriptInputConfiguration.h"
 	"Wrappers/BsScriptLogEntry.h"
 	"Wrappers/BsScriptManagedResource.h"
+	"Wrappers/BsScriptMaterialParam.h"
 	"Wrappers/BsScriptPixelUtility.h"
 	"Wrappers/BsScriptPlainText.h"
+	"Wrappers/BsScriptPhysicsQueryBatch.h"
+	"Wrappers/BsScriptCameraConversions.h"
+	"Wrappers/BsScriptAnimationCurvesKeyFrames.h"
+	"Wrappers/BsScriptTextureStagingBuffer.h"
+	"Wrappers/BsScriptTextureReadback.h"
+	"Wrappers/BsScriptCameraRenderSettings.h"
+	"Wrappers/BsScriptPrefabPool.h"
+	"Wrappers/BsScriptComponentWrappers.h"
 	"Wrappers/BsScriptPrefab.h"
 	"Wrappers/BsScriptResource.h"
 	"Wrappers/BsScriptVirtualInput.h"
@@ -127,6 +139,7 @@ set(BS_SBANSHEEENGINE_SRC_SERIALIZATION
 	"Serialization/BsScriptAssemblyManager.cpp"
 	"Serialization/BsManagedSerializableDiff.cpp"
 	"Serialization/BsManagedDiff.cpp"
+	"Serialization/BsManagedSerializableCloner.cpp"
 )
 
 set(BS_SBANSHEEENGINE_SRC_WRAPPERS
@@ -141,8 +154,17 @@ set(BS_SBANSHEEENGINE_SRC_WRAPPERS
 	"Wrappers/BsScriptInputConfiguration.cpp"
 	"Wrappers/BsScriptLogEntry.cpp"
 	"Wrappers/BsScriptManagedResource.cpp"
+	"Wrappers/BsScriptMaterialParam.cpp"
 	"Wrappers/BsScriptPixelUtility.cpp"
 	"Wrappers/BsScriptPlainText.cpp"
+	"Wrappers/BsScriptPhysicsQueryBatch.cpp"
+	"Wrappers/BsScriptCameraConversions.cpp"
+	"Wrappers/BsScriptAnimationCurvesKeyFrames.cpp"
+	"Wrappers/BsScriptTextureStagingBuffer.cpp"
+	"Wrappers/BsScriptTextureReadback.cpp"
+	"Wrappers/BsScriptCameraRenderSettings.cpp"
+	"Wrappers/BsScriptPrefabPool.cpp"
+	"Wrappers/BsScriptComponentWrappers.cpp"
 	"Wrappers/BsScriptPrefab.cpp"
 	"Wrappers/BsScriptVirtualInput.cpp"
 	"Wrappers/BsScriptVirtualButton.cpp"
@@ -177,6 +199,7 @@ set(BS_SBANSHEEENGINE_INC_SERIALIZATION
 	"Serialization/BsScriptAssemblyManager.h"
 	"Serialization/BsManagedSerializableDiff.h"
 	"Serialization/BsManagedDiff.h"
+	"Serialization/BsManagedSerializableCloner.h"
 	"Serialization/BsBuiltinComponentLookup.h"
 	"Serialization/BsBuiltinResourceLookup.h"
 )
@@ -192,8 +215,10 @@ set(BS_SBANSHEEENGINE_SRC_NOFILTER
 	"BsManagedResourceMetaData.cpp"
 	"BsManagedResourceManager.cpp"
 	"BsScriptObjectManager.cpp"
+	"BsScriptGCHandleTable.cpp"
 	"BsEngineScriptLibrary.cpp"
 	"BsPlayInEditorManager.cpp"
+	"BsSceneObjectNameIndex.cpp"
 )
 
 set(BS_SBANSHEEENGINE_INC_RTTI
@@ -6,6 +6,121 @@ using namespace std::placeholders;
 
 namespace bs
 {
+	/** Maps keyframe value types to the curve sets that store them. */
+	template<class T>
+	struct AnimationCurveSetAccessor
+	{ };
+
+	template<>
+	struct AnimationCurveSetAccessor<Vector3>
+	{
+		static Vector<TNamedAnimationCurve<Vector3>>* get(AnimationCurves& curves, AnimationCurveSet set)
+		{
+			if (set == AnimationCurveSet::Position)
+				return &curves.position;
+
+			if (set == AnimationCurveSet::Scale)
+				return &curves.scale;
+
+			return nullptr;
+		}
+	};
+
+	template<>
+	struct AnimationCurveSetAccessor<Quaternion>
+	{
+		static Vector<TNamedAnimationCurve<Quaternion>>* get(AnimationCurves& curves, AnimationCurveSet set)
+		{
+			return set == AnimationCurveSet::Rotation ? &curves.rotation : nullptr;
+		}
+	};
+
+	template<>
+	struct AnimationCurveSetAccessor<float>
+	{
+		static Vector<TNamedAnimationCurve<float>>* get(AnimationCurves& curves, AnimationCurveSet set)
+		{
+			return set == AnimationCurveSet::Generic ? &curves.generic : nullptr;
+		}
+	};
+
+	/** Returns the curve at the specified index in a curve set of type @p T, or null if it doesn't exist. */
+	template<class T>
+	static TAnimationCurve<T>* getCurve(AnimationCurves& curves, AnimationCurveSet set, UINT32 curveIdx)
+	{
+		Vector<TNamedAnimationCurve<T>>* curveSet = AnimationCurveSetAccessor<T>::get(curves, set);
+		if (curveSet == nullptr || curveIdx >= (UINT32)curveSet->size())
+			return nullptr;
+
+		return &(*curveSet)[curveIdx].curve;
+	}
+
+	/** Returns the index at which a keyframe at the specified time should be inserted, keeping keyframes sorted. */
+	template<class T>
+	static UINT32 findInsertIdx(const Vector<TKeyframe<T>>& keyframes, float time)
+	{
+		auto iterFind = std::upper_bound(keyframes.begin(), keyframes.end(), time,
+			[](float time, const TKeyframe<T>& keyframe) { return time < keyframe.time; });
+
+		return (UINT32)(iterFind - keyframes.begin());
+	}
+
+	/** Returns the index of the curve with the specified name in the curve set, or -1 if not found. */
+	template<class T>
+	static INT32 findCurveIdx(const Vector<TNamedAnimationCurve<T>>& curves, const String& name)
+	{
+		for (UINT32 i = 0; i < (UINT32)curves.size(); i++)
+		{
+			if (curves[i].name == name)
+				return (INT32)i;
+		}
+
+		return -1;
+	}
+
+	/**
+	 * Rebuilds a curve with the keyframe at @p removeIdx removed, and @p keyframe inserted at @p insertIdx. Either
+	 * operation is skipped if its index is -1. @p insertIdx refers to the keyframe order after the removal. Keyframes
+	 * are copied in a single pass, without shifting the remaining keyframes around.
+	 */
+	template<class T>
+	static void rebuildCurve(TAnimationCurve<T>& curve, INT32 removeIdx, INT32 insertIdx, const TKeyframe<T>& keyframe)
+	{
+		const Vector<TKeyframe<T>>& oldKeyframes = curve.getKeyFrames();
+		UINT32 numOldKeyframes = (UINT32)oldKeyframes.size();
+
+		Vector<TKeyframe<T>> keyframes;
+		keyframes.reserve(numOldKeyframes + 1);
+
+		for (UINT32 i = 0; i < numOldKeyframes; i++)
+		{
+			if ((INT32)i == removeIdx)
+				continue;
+
+			if ((INT32)keyframes.size() == insertIdx)
+				keyframes.push_back(keyframe);
+
+			keyframes.push_back(oldKeyframes[i]);
+		}
+
+		if ((INT32)keyframes.size() == insertIdx)
+			keyframes.push_back(keyframe);
+
+		curve = TAnimationCurve<T>(keyframes);
+	}
+
+	/** Removes a keyframe from a curve in a curve set of type @p T, rebuilding only that curve. */
+	template<class T>
+	static bool removeKeyframeFromCurve(AnimationCurves& curves, AnimationCurveSet set, UINT32 curveIdx, UINT32 keyIdx)
+	{
+		TAnimationCurve<T>* curve = getCurve<T>(curves, set, curveIdx);
+		if (curve == nullptr || keyIdx >= curve->getNumKeyFrames())
+			return false;
+
+		rebuildCurve(*curve, (INT32)keyIdx, -1, TKeyframe<T>());
+		return true;
+	}
+
 	Vector<TNamedAnimationCurve<Vector3>> AnimationCurvesEx::getPositionCurves(const SPtr<AnimationCurves>& thisPtr)
 	{
 		return thisPtr->position;
@@ -46,6 +161,182 @@ namespace bs
 		thisPtr->generic = value;
 	}
 
+	INT32 AnimationCurvesEx::findCurve(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, const String& name)
+	{
+		switch (set)
+		{
+		case AnimationCurveSet::Position:
+			return findCurveIdx(thisPtr->position, name);
+		case AnimationCurveSet::Rotation:
+			return findCurveIdx(thisPtr->rotation, name);
+		case AnimationCurveSet::Scale:
+			return findCurveIdx(thisPtr->scale, name);
+		case AnimationCurveSet::Generic:
+			return findCurveIdx(thisPtr->generic, name);
+		}
+
+		return -1;
+	}
+
+	UINT32 AnimationCurvesEx::getNumKeyframes(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set,
+		UINT32 curveIdx)
+	{
+		switch (set)
+		{
+		case AnimationCurveSet::Position:
+		case AnimationCurveSet::Scale:
+		{
+			const Vector<TKeyframe<Vector3>>* keyframes = getKeyframes<Vector3>(thisPtr, set, curveIdx);
+			return keyframes != nullptr ? (UINT32)keyframes->size() : 0;
+		}
+		case AnimationCurveSet::Rotation:
+		{
+			const Vector<TKeyframe<Quaternion>>* keyframes = getKeyframes<Quaternion>(thisPtr, set, curveIdx);
+			return keyframes != nullptr ? (UINT32)keyframes->size() : 0;
+		}
+		case AnimationCurveSet::Generic:
+		{
+			const Vector<TKeyframe<float>>* keyframes = getKeyframes<float>(thisPtr, set, curveIdx);
+			return keyframes != nullptr ? (UINT32)keyframes->size() : 0;
+		}
+		}
+
+		return 0;
+	}
+
+	template<class T>
+	const Vector<TKeyframe<T>>* AnimationCurvesEx::getKeyframes(const SPtr<AnimationCurves>& thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx)
+	{
+		TAnimationCurve<T>* curve = getCurve<T>(*thisPtr, set, curveIdx);
+		if (curve == nullptr)
+			return nullptr;
+
+		return &curve->getKeyFrames();
+	}
+
+	template<class T>
+	INT32 AnimationCurvesEx::setKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+		UINT32 keyIdx, const TKeyframe<T>& keyframe)
+	{
+		TAnimationCurve<T>* curve = getCurve<T>(*thisPtr, set, curveIdx);
+		if (curve == nullptr || keyIdx >= curve->getNumKeyFrames())
+			return -1;
+
+		// Insert position is determined as if the replaced keyframe was already removed
+		UINT32 newIdx = findInsertIdx(curve->getKeyFrames(), keyframe.time);
+		if (keyIdx < newIdx)
+			newIdx--;
+
+		rebuildCurve(*curve, (INT32)keyIdx, (INT32)newIdx, keyframe);
+		return (INT32)newIdx;
+	}
+
+	template<class T>
+	INT32 AnimationCurvesEx::addKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+		const TKeyframe<T>& keyframe)
+	{
+		TAnimationCurve<T>* curve = getCurve<T>(*thisPtr, set, curveIdx);
+		if (curve == nullptr)
+			return -1;
+
+		UINT32 newIdx = findInsertIdx(curve->getKeyFrames(), keyframe.time);
+
+		rebuildCurve(*curve, -1, (INT32)newIdx, keyframe);
+		return (INT32)newIdx;
+	}
+
+	bool AnimationCurvesEx::removeKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+		UINT32 keyIdx)
+	{
+		switch (set)
+		{
+		case AnimationCurveSet::Position:
+		case AnimationCurveSet::Scale:
+			return removeKeyframeFromCurve<Vector3>(*thisPtr, set, curveIdx, keyIdx);
+		case AnimationCurveSet::Rotation:
+			return removeKeyframeFromCurve<Quaternion>(*thisPtr, set, curveIdx, keyIdx);
+		case AnimationCurveSet::Generic:
+			return removeKeyframeFromCurve<float>(*thisPtr, set, curveIdx, keyIdx);
+		}
+
+		return false;
+	}
+
+	template const Vector<TKeyframe<Vector3>>* AnimationCurvesEx::getKeyframes<Vector3>(const SPtr<AnimationCurves>&,
+		AnimationCurveSet, UINT32);
+	template const Vector<TKeyframe<Quaternion>>* AnimationCurvesEx::getKeyframes<Quaternion>(
+		const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32);
+	template const Vector<TKeyframe<float>>* AnimationCurvesEx::getKeyframes<float>(const SPtr<AnimationCurves>&,
+		AnimationCurveSet, UINT32);
+
+	template INT32 AnimationCurvesEx::setKeyframe<Vector3>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		UINT32, const TKeyframe<Vector3>&);
+	template INT32 AnimationCurvesEx::setKeyframe<Quaternion>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		UINT32, const TKeyframe<Quaternion>&);
+	template INT32 AnimationCurvesEx::setKeyframe<float>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		UINT32, const TKeyframe<float>&);
+
+	template INT32 AnimationCurvesEx::addKeyframe<Vector3>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		const TKeyframe<Vector3>&);
+	template INT32 AnimationCurvesEx::addKeyframe<Quaternion>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		const TKeyframe<Quaternion>&);
+	template INT32 AnimationCurvesEx::addKeyframe<float>(const SPtr<AnimationCurves>&, AnimationCurveSet, UINT32,
+		const TKeyframe<float>&);
+
+	UnorderedMap<const AnimationCurves*, std::weak_ptr<AnimationCurves>> AnimationCurvesEx::sClipOwnedCurves;
+
+	void AnimationCurvesEx::markClipOwned(const SPtr<AnimationCurves>& curves)
+	{
+		if (curves == nullptr)
+			return;
+
+		// Prune entries of destroyed curves once in a while, so the map doesn't grow with every clip ever created
+		if (sClipOwnedCurves.size() >= 256 && (sClipOwnedCurves.size() & (sClipOwnedCurves.size() - 1)) == 0)
+		{
+			for (auto iter = sClipOwnedCurves.begin(); iter != sClipOwnedCurves.end();)
+			{
+				if (iter->second.expired())
+					iter = sClipOwnedCurves.erase(iter);
+				else
+					++iter;
+			}
+		}
+
+		sClipOwnedCurves[curves.get()] = curves;
+	}
+
+	bool AnimationCurvesEx::isClipOwned(const SPtr<AnimationCurves>& curves)
+	{
+		auto iterFind = sClipOwnedCurves.find(curves.get());
+		if (iterFind == sClipOwnedCurves.end())
+			return false;
+
+		// Address might have been reused by a different curves object after the clip-owned one was destroyed
+		if (iterFind->second.lock() != curves)
+		{
+			sClipOwnedCurves.erase(iterFind);
+			return false;
+		}
+
+		return true;
+	}
+
+	HAnimationClip AnimationClipEx::create(const SPtr<AnimationCurves>& curves, bool isAdditive, UINT32 sampleRate,
+		const SPtr<RootMotion>& rootMotion)
+	{
+		AnimationCurvesEx::markClipOwned(curves);
+		return AnimationClip::create(curves, isAdditive, sampleRate, rootMotion);
+	}
+
+	SPtr<AnimationCurves> AnimationClipEx::getCurves(const HAnimationClip& thisPtr)
+	{
+		SPtr<AnimationCurves> curves = thisPtr->getCurves();
+		AnimationCurvesEx::markClipOwned(curves);
+
+		return curves;
+	}
+
 	TAnimationCurve<Vector3> RootMotionEx::getPositionCurves(const SPtr<RootMotion>& thisPtr)
 	{
 		return thisPtr->position;
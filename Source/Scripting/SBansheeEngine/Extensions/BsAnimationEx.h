@@ -13,6 +13,15 @@ namespace bs
 	 */
 	/** @cond SCRIPT_EXTENSIONS */
 
+	/** Types of curves stored in AnimationCurves. */
+	enum class AnimationCurveSet
+	{
+		Position, /**< AnimationCurves::position curves, with Vector3 keyframes. */
+		Rotation, /**< AnimationCurves::rotation curves, with Quaternion keyframes. */
+		Scale, /**< AnimationCurves::scale curves, with Vector3 keyframes. */
+		Generic /**< AnimationCurves::generic curves, with float keyframes. */
+	};
+
 	/** Extension class for AnimationCurves, for adding additional functionality for the script version of the class. */
 	class BS_SCRIPT_EXPORT(e:AnimationCurves) AnimationCurvesEx
 	{
@@ -44,6 +53,87 @@ namespace bs
 		/** Curves for animating generic component properties. */
 		BS_SCRIPT_EXPORT(e:AnimationCurves,n:Generic,pr:setter)
 		static void setGenericCurves(const SPtr<AnimationCurves>& thisPtr, const Vector<TNamedAnimationCurve<float>>& value);
+
+		/** Returns the index of the curve with the specified name in the provided set, or -1 if it doesn't exist. */
+		static INT32 findCurve(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, const String& name);
+
+		/** Returns the number of keyframes in the specified curve, or zero if the curve doesn't exist. */
+		static UINT32 getNumKeyframes(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx);
+
+		/**
+		 * Returns the keyframes of the specified curve without copying them, or null if the curve doesn't exist or its
+		 * keyframes aren't of type @p T. Returned array is invalidated by any modification of the curve.
+		 */
+		template<class T>
+		static const Vector<TKeyframe<T>>* getKeyframes(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set,
+			UINT32 curveIdx);
+
+		/**
+		 * Replaces a keyframe in the specified curve. Only the modified curve is rebuilt, all other curves remain
+		 * untouched.
+		 *
+		 * @return	Index of the keyframe after the update (keyframes remain sorted by time, so the index changes if the
+		 *			time of the keyframe moved it past its neighbors), or -1 if the curve or keyframe doesn't exist.
+		 */
+		template<class T>
+		static INT32 setKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx, const TKeyframe<T>& keyframe);
+
+		/**
+		 * Inserts a new keyframe into the specified curve, at the position determined by the keyframe's time. Only the
+		 * modified curve is rebuilt.
+		 *
+		 * @return	Index of the inserted keyframe, or -1 if the curve doesn't exist.
+		 */
+		template<class T>
+		static INT32 addKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			const TKeyframe<T>& keyframe);
+
+		/**
+		 * Removes a keyframe from the specified curve. Only the modified curve is rebuilt. Returns false if the curve
+		 * or keyframe doesn't exist.
+		 */
+		static bool removeKeyframe(const SPtr<AnimationCurves>& thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx);
+
+		/**
+		 * Marks the curves as owned by an animation clip. Such curves are shared with the clip and the animation thread
+		 * and must not be modified in place. Must only be called from the main thread.
+		 */
+		static void markClipOwned(const SPtr<AnimationCurves>& curves);
+
+		/** Checks has the provided curves object been marked with markClipOwned(). */
+		static bool isClipOwned(const SPtr<AnimationCurves>& curves);
+
+	private:
+		static UnorderedMap<const AnimationCurves*, std::weak_ptr<AnimationCurves>> sClipOwnedCurves;
+	};
+
+	/** Extension class for AnimationClip, for adding additional functionality for the script version of the class. */
+	class BS_SCRIPT_EXPORT(e:AnimationClip) AnimationClipEx
+	{
+	public:
+		/**
+		 * Creates an animation clip with specified curves.
+		 *
+		 * @param[in]	curves		Curves to initialize the animation with.
+		 * @param[in]	isAdditive	Determines does the clip contain additive curve data. This will change the behaviour
+		 *							how is the clip blended with other animations.
+		 * @param[in]	sampleRate	If animation uses evenly spaced keyframes, number of samples per second. Not relevant
+		 *							if keyframes are unevenly spaced.
+		 * @param[in]	rootMotion	Optional set of curves that can be used for animating the root bone. Not used by the
+		 *							animation system directly but is instead provided to the user for manual evaluation.
+		 */
+		BS_SCRIPT_EXPORT(ec:AnimationClip)
+		static HAnimationClip create(const SPtr<AnimationCurves>& curves, bool isAdditive = false, UINT32 sampleRate = 1,
+			const SPtr<RootMotion>& rootMotion = nullptr);
+
+		/**
+		 * A set of all curves stored in the animation. Returned value will not be updated if the animation clip curves are
+		 * added or removed, as it is a copy of clip's internal values.
+		 */
+		BS_SCRIPT_EXPORT(e:AnimationClip,n:Curves,pr:getter)
+		static SPtr<AnimationCurves> getCurves(const HAnimationClip& thisPtr);
 	};
 
 	/** Extension class for RootMotion, for adding additional functionality for the script version of the class. */
@@ -93,8 +93,9 @@ namespace bs
 		SPtr<PixelData> readData = thisPtr->getProperties().allocBuffer(face, mipLevel);
 		AsyncOp asyncOp = thisPtr->readData(readData, face, mipLevel);
 
+		// Buffer is captured by value, as the callback is invoked long after this method returns
 		std::function<MonoObject*(const AsyncOp&)> asyncOpToMono =
-			[&readData](const AsyncOp& op)
+			[readData](const AsyncOp& op)
 		{
 			return ScriptPixelData::create(readData);
 		};
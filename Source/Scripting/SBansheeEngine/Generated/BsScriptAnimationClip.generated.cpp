@@ -9,6 +9,7 @@
 #include "BsScriptRootMotion.generated.h"
 #include "BsScriptAnimationEvent.generated.h"
 #include "../../../bsf/Source/Foundation/bsfCore/Animation/BsAnimationClip.h"
+#include "../../SBansheeEngine/Extensions/BsAnimationEx.h"
 
 namespace bs
 {
@@ -50,7 +51,7 @@ namespace bs
 	MonoObject* ScriptAnimationClip::Internal_getCurves(ScriptAnimationClip* thisPtr)
 	{
 		SPtr<AnimationCurves> tmp__output;
-		tmp__output = thisPtr->getHandle()->getCurves();
+		tmp__output = AnimationClipEx::getCurves(thisPtr->getHandle());
 
 		MonoObject* __output;
 		__output = ScriptAnimationCurves::create(tmp__output);
@@ -175,7 +176,7 @@ namespace bs
 		ScriptRootMotion* scriptrootMotion;
 		scriptrootMotion = ScriptRootMotion::toNative(rootMotion);
 		tmprootMotion = scriptrootMotion->getInternal();
-		ResourceHandle<AnimationClip> instance = AnimationClip::create(tmpcurves, isAdditive, sampleRate, tmprootMotion);
+		ResourceHandle<AnimationClip> instance = AnimationClipEx::create(tmpcurves, isAdditive, sampleRate, tmprootMotion);
 		ScriptResourceManager::instance().createBuiltinScriptResource(instance, managedInstance);
 	}
 }
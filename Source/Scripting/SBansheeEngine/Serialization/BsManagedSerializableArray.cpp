@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Serialization/BsManagedSerializableArray.h"
 #include "RTTI/BsManagedSerializableArrayRTTI.h"
+#include "BsScriptGCHandleTable.h"
 #include "BsMonoManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Serialization/BsManagedSerializableField.h"
@@ -21,7 +22,7 @@ namespace bs
 		: mArrayTypeInfo(typeInfo)
 		
 	{
-		mGCHandle = MonoUtil::newGCHandle(managedInstance, false);
+		mGCHandle = ScriptGCHandleTable::instance().newHandle(managedInstance, ScriptGCHandleCategory::Serialization);
 
 		ScriptArray scriptArray((MonoArray*)managedInstance);
 		mElemSize = scriptArray.elementSize();
@@ -35,9 +36,9 @@ namespace bs
 
 	ManagedSerializableArray::~ManagedSerializableArray()
 	{
-		if(mGCHandle != 0)
+		if(mGCHandle != 0 && ScriptGCHandleTable::isStarted())
 		{
-			MonoUtil::freeGCHandle(mGCHandle);
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 			mGCHandle = 0;
 		}
 	}
@@ -84,7 +85,7 @@ namespace bs
 	MonoObject* ManagedSerializableArray::getManagedInstance() const
 	{
 		if(mGCHandle != 0)
-			return MonoUtil::getObjectFromGCHandle(mGCHandle);
+			return ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		return nullptr;
 	}
@@ -93,7 +94,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoArray* array = (MonoArray*)MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoArray* array = (MonoArray*)ScriptGCHandleTable::instance().getObject(mGCHandle);
 			setFieldData(array, arrayIdx, val);
 		}
 		else
@@ -117,7 +118,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoArray* array = (MonoArray*)MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoArray* array = (MonoArray*)ScriptGCHandleTable::instance().getObject(mGCHandle);
 			ScriptArray scriptArray(array);
 
 			UINT32 numElems = scriptArray.size();
@@ -160,7 +161,7 @@ namespace bs
 		for (auto& fieldEntry : mCachedEntries)
 			fieldEntry->serialize();
 
-		MonoUtil::freeGCHandle(mGCHandle);
+		ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 		mGCHandle = 0;
 	}
 
@@ -255,8 +256,8 @@ namespace bs
 
 			mCopyMethod->invoke(nullptr, params);
 
-			MonoUtil::freeGCHandle(mGCHandle);
-			mGCHandle = MonoUtil::newGCHandle(newArray, false);
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
+			mGCHandle = ScriptGCHandleTable::instance().newHandle(newArray, ScriptGCHandleCategory::Serialization);
 
 			mNumElements = newSizes;
 		}
@@ -269,7 +270,7 @@ namespace bs
 
 	UINT32 ManagedSerializableArray::getLengthInternal(UINT32 dimension) const
 	{
-		MonoObject* managedInstace = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* managedInstace = ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		MonoClass* systemArray = ScriptAssemblyManager::instance().getBuiltinClasses().systemArrayClass;
 		MonoMethod* getLength = systemArray->getMethod("GetLength", 1);
@@ -0,0 +1,268 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Serialization/BsManagedSerializableCloner.h"
+#include "Serialization/BsManagedSerializableObjectInfo.h"
+#include "Serialization/BsManagedSerializableField.h"
+#include "Serialization/BsManagedSerializableObject.h"
+#include "Serialization/BsManagedSerializableArray.h"
+#include "Serialization/BsManagedSerializableList.h"
+#include "Serialization/BsManagedSerializableDictionary.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "BsMonoProperty.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+
+namespace bs
+{
+	MonoObject* ManagedSerializableCloner::clone(const SPtr<ManagedSerializableTypeInfo>& typeInfo, MonoObject* value)
+	{
+		if (value == nullptr)
+			return nullptr;
+
+		switch(typeInfo->getTypeId())
+		{
+		case TID_SerializableTypeInfoPrimitive:
+		case TID_SerializableTypeInfoRef:
+			// Primitives are boxed copies already, strings are immutable and references must keep pointing to the same
+			// game object or resource
+			return value;
+		case TID_SerializableTypeInfoRRef:
+			// Each resource reference owns its own handle, so create a new one
+			return ManagedSerializableFieldData::create(typeInfo, value)->getValueBoxed(typeInfo);
+		case TID_SerializableTypeInfoObject:
+			return cloneObject(std::static_pointer_cast<ManagedSerializableTypeInfoObject>(typeInfo), value);
+		case TID_SerializableTypeInfoArray:
+			return cloneArray(std::static_pointer_cast<ManagedSerializableTypeInfoArray>(typeInfo), value);
+		case TID_SerializableTypeInfoList:
+			return cloneList(std::static_pointer_cast<ManagedSerializableTypeInfoList>(typeInfo), value);
+		case TID_SerializableTypeInfoDictionary:
+			return cloneDictionary(std::static_pointer_cast<ManagedSerializableTypeInfoDictionary>(typeInfo), value);
+		default:
+			break;
+		}
+
+		return nullptr;
+	}
+
+	MonoObject* ManagedSerializableCloner::cloneObject(const SPtr<ManagedSerializableTypeInfoObject>& typeInfo,
+		MonoObject* value)
+	{
+		// Use the actual type of the instance, as it might be derived from the field type
+		String ns;
+		String typeName;
+		MonoUtil::getClassName(value, ns, typeName);
+
+		SPtr<ManagedSerializableObjectInfo> objInfo;
+		if (!ScriptAssemblyManager::instance().getSerializableObjectInfo(ns, typeName, objInfo))
+			return nullptr;
+
+		if (objInfo->mBlittable)
+			return MonoUtil::box(objInfo->mMonoClass->_getInternalClass(), MonoUtil::unbox(value));
+
+		// Never call constructor, same as during deserialization
+		MonoObject* clonedValue = objInfo->mMonoClass->createInstance(false);
+
+		SPtr<ManagedSerializableObjectInfo> curType = objInfo;
+		while (curType != nullptr)
+		{
+			for (auto& entry : curType->mFields)
+			{
+				const SPtr<ManagedSerializableMemberInfo>& field = entry.second;
+				if (!field->isSerializable())
+					continue;
+
+				MonoObject* fieldValue = clone(field->mTypeInfo, field->getValue(value));
+				if (fieldValue == nullptr)
+				{
+					// Value types cannot be set to null, leave them default initialized
+					::MonoClass* fieldClass = field->mTypeInfo->getMonoClass();
+					if (fieldClass == nullptr || MonoUtil::isValueType(fieldClass))
+						continue;
+				}
+
+				field->setValue(clonedValue, toParam(field->mTypeInfo, fieldValue));
+			}
+
+			curType = curType->mBaseClass;
+		}
+
+		return clonedValue;
+	}
+
+	MonoObject* ManagedSerializableCloner::cloneArray(const SPtr<ManagedSerializableTypeInfoArray>& typeInfo,
+		MonoObject* value)
+	{
+		// Multi-dimensional arrays are rare, so just go through the regular serialization path (minus the encoding)
+		if (typeInfo->mRank != 1)
+		{
+			SPtr<ManagedSerializableFieldData> data = ManagedSerializableFieldData::create(typeInfo, value);
+			data->serialize();
+			data->deserialize();
+
+			return data->getValueBoxed(typeInfo);
+		}
+
+		::MonoClass* elementMonoClass = typeInfo->mElementType->getMonoClass();
+		if (elementMonoClass == nullptr)
+			return nullptr;
+
+		ScriptArray srcArray((MonoArray*)value);
+		UINT32 numElements = srcArray.size();
+
+		ScriptArray dstArray(elementMonoClass, numElements);
+		if (numElements == 0)
+			return (MonoObject*)dstArray.getInternal();
+
+		UINT32 elementSize = srcArray.elementSize();
+		bool isValueType = MonoUtil::isValueType(elementMonoClass);
+		if (!requiresDeepCopy(typeInfo->mElementType))
+		{
+			if (isValueType)
+			{
+				memcpy(dstArray.getRaw(0, elementSize), srcArray.getRaw(0, elementSize), numElements * elementSize);
+			}
+			else
+			{
+				for (UINT32 i = 0; i < numElements; i++)
+					dstArray.set(i, srcArray.get<MonoObject*>(i));
+			}
+		}
+		else
+		{
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				if (isValueType)
+				{
+					MonoObject* element = MonoUtil::box(elementMonoClass, srcArray.getRaw(i, elementSize));
+					MonoObject* clonedElement = clone(typeInfo->mElementType, element);
+
+					if (clonedElement != nullptr)
+						dstArray.setRaw(i, (UINT8*)MonoUtil::unbox(clonedElement), elementSize);
+				}
+				else
+				{
+					MonoObject* clonedElement = clone(typeInfo->mElementType, srcArray.get<MonoObject*>(i));
+					dstArray.set(i, clonedElement);
+				}
+			}
+		}
+
+		return (MonoObject*)dstArray.getInternal();
+	}
+
+	MonoObject* ManagedSerializableCloner::cloneList(const SPtr<ManagedSerializableTypeInfoList>& typeInfo,
+		MonoObject* value)
+	{
+		MonoObject* clonedValue = ManagedSerializableList::createManagedInstance(typeInfo, 0);
+		if (clonedValue == nullptr)
+			return nullptr;
+
+		MonoClass* listClass = MonoManager::instance().findClass(typeInfo->getMonoClass());
+
+		// Elements that don't need to be recursed into can be copied by the list itself
+		if (!requiresDeepCopy(typeInfo->mElementType))
+		{
+			void* params[1] = { value };
+
+			MonoMethod* addRangeMethod = listClass->getMethod("AddRange", 1);
+			addRangeMethod->invoke(clonedValue, params);
+
+			return clonedValue;
+		}
+
+		MonoProperty* itemProp = listClass->getProperty("Item");
+		MonoProperty* countProp = listClass->getProperty("Count");
+		MonoMethod* addMethod = listClass->getMethod("Add", 1);
+
+		MonoObject* countObj = countProp->get(value);
+		UINT32 numElements = countObj != nullptr ? *(UINT32*)MonoUtil::unbox(countObj) : 0;
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			MonoObject* element = itemProp->getIndexed(value, i);
+			MonoObject* clonedElement = clone(typeInfo->mElementType, element);
+
+			// Value types cannot be null, keep the original if the element type is no longer serializable
+			if (clonedElement == nullptr && element != nullptr && MonoUtil::isValueType(MonoUtil::getClass(element)))
+				clonedElement = element;
+
+			void* params[1] = { toParam(typeInfo->mElementType, clonedElement) };
+			addMethod->invoke(clonedValue, params);
+		}
+
+		return clonedValue;
+	}
+
+	MonoObject* ManagedSerializableCloner::cloneDictionary(const SPtr<ManagedSerializableTypeInfoDictionary>& typeInfo,
+		MonoObject* value)
+	{
+		MonoObject* clonedValue = ManagedSerializableDictionary::createManagedInstance(typeInfo);
+		if (clonedValue == nullptr)
+			return nullptr;
+
+		MonoClass* dictionaryClass = MonoManager::instance().findClass(typeInfo->getMonoClass());
+		MonoMethod* addMethod = dictionaryClass->getMethod("Add", 2);
+
+		SPtr<ManagedSerializableDictionary> dictionary = ManagedSerializableDictionary::createFromExisting(value, typeInfo);
+		if (dictionary == nullptr)
+			return clonedValue;
+
+		ManagedSerializableDictionary::Enumerator enumerator = dictionary->getEnumerator();
+		while (enumerator.moveNext())
+		{
+			MonoObject* key = clone(typeInfo->mKeyType, enumerator.getKey()->getValueBoxed(typeInfo->mKeyType));
+			if (key == nullptr)
+				continue;
+
+			MonoObject* entryValue = clone(typeInfo->mValueType, enumerator.getValue()->getValueBoxed(typeInfo->mValueType));
+
+			void* params[2] = { toParam(typeInfo->mKeyType, key), toParam(typeInfo->mValueType, entryValue) };
+			addMethod->invoke(clonedValue, params);
+		}
+
+		return clonedValue;
+	}
+
+	bool ManagedSerializableCloner::requiresDeepCopy(const SPtr<ManagedSerializableTypeInfo>& typeInfo)
+	{
+		switch(typeInfo->getTypeId())
+		{
+		case TID_SerializableTypeInfoPrimitive:
+		case TID_SerializableTypeInfoRef:
+			return false;
+		case TID_SerializableTypeInfoObject:
+		{
+			auto objectTypeInfo = std::static_pointer_cast<ManagedSerializableTypeInfoObject>(typeInfo);
+			if (!objectTypeInfo->mValueType)
+				return true;
+
+			SPtr<ManagedSerializableObjectInfo> objInfo;
+			if (!ScriptAssemblyManager::instance().getSerializableObjectInfo(objectTypeInfo->mTypeNamespace,
+				objectTypeInfo->mTypeName, objInfo))
+			{
+				return true;
+			}
+
+			return !objInfo->mBlittable;
+		}
+		default:
+			return true;
+		}
+	}
+
+	void* ManagedSerializableCloner::toParam(const SPtr<ManagedSerializableTypeInfo>& typeInfo, MonoObject* value)
+	{
+		if (value == nullptr)
+			return nullptr;
+
+		// Structs and primitives are passed as raw types because mono expects them as such
+		::MonoClass* monoClass = typeInfo->getMonoClass();
+		if (monoClass != nullptr && MonoUtil::isValueType(monoClass))
+			return MonoUtil::unbox(value);
+
+		return value;
+	}
+}
@@ -0,0 +1,61 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/**
+	 * Creates deep copies of managed serializable objects by walking their type information and copying the values
+	 * directly between managed instances, without going through ManagedSerializableFieldData and binary serialization.
+	 *
+	 * The result is identical to serializing and deserializing the value: only serializable fields are copied, objects,
+	 * arrays, lists and dictionaries are recursed into, while game object and resource references keep referencing the
+	 * same objects. Primitive arrays and structs consisting only of primitive fields are copied in bulk.
+	 */
+	class BS_SCR_BE_EXPORT ManagedSerializableCloner
+	{
+	public:
+		/**
+		 * Creates a deep copy of a managed value.
+		 *
+		 * @param[in]	typeInfo	Type of the value to clone.
+		 * @param[in]	value		Value to clone. Value types are expected in their boxed form.
+		 * @return					Cloned value, boxed if it is a value type. Null if @p value is null or its type is no
+		 *							longer serializable.
+		 */
+		static MonoObject* clone(const SPtr<ManagedSerializableTypeInfo>& typeInfo, MonoObject* value);
+
+	private:
+		/** Clones an instance of a serializable class or struct. */
+		static MonoObject* cloneObject(const SPtr<ManagedSerializableTypeInfoObject>& typeInfo, MonoObject* value);
+
+		/** Clones a managed array. */
+		static MonoObject* cloneArray(const SPtr<ManagedSerializableTypeInfoArray>& typeInfo, MonoObject* value);
+
+		/** Clones a managed List<T>. */
+		static MonoObject* cloneList(const SPtr<ManagedSerializableTypeInfoList>& typeInfo, MonoObject* value);
+
+		/** Clones a managed Dictionary<K, V>. */
+		static MonoObject* cloneDictionary(const SPtr<ManagedSerializableTypeInfoDictionary>& typeInfo, MonoObject* value);
+
+		/**
+		 * Checks if values of the provided type need to be recursed into when cloned. If false the value can be copied
+		 * as is, either because it is a primitive, a blittable struct, an immutable string or a reference.
+		 */
+		static bool requiresDeepCopy(const SPtr<ManagedSerializableTypeInfo>& typeInfo);
+
+		/**
+		 * Converts a value returned by clone() into a form accepted by managed methods and member setters. Value types
+		 * are unboxed, while reference types are passed as is.
+		 */
+		static void* toParam(const SPtr<ManagedSerializableTypeInfo>& typeInfo, MonoObject* value);
+	};
+
+	/** @} */
+}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Serialization/BsManagedSerializableDictionary.h"
 #include "RTTI/BsManagedSerializableDictionaryRTTI.h"
+#include "BsScriptGCHandleTable.h"
 #include "BsMonoManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Serialization/BsManagedSerializableField.h"
@@ -42,180 +43,103 @@ namespace bs
 	ManagedSerializableDictionary::Enumerator::Enumerator(const ManagedSerializableDictionary* parent)
 		: mIteratorInitialized(false), mParent(parent)
 	{
-		MonoArray* keysArray = nullptr;
-		MonoArray* valuesArray = nullptr;
-		if(parent->mGCHandle != 0)
-		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(parent->mGCHandle);
-
-			mNumEntries = *(UINT32*)MonoUtil::unbox(parent->mCountProp->get(managedInstance));
-			MonoObject* keyCollection = parent->mKeysProp->get(managedInstance);
-			MonoObject* valueCollection = parent->mValuesProp->get(managedInstance);
-
-			mKeyType = parent->mDictionaryTypeInfo->mKeyType->getMonoClass();
-			mValueType = parent->mDictionaryTypeInfo->mValueType->getMonoClass();
-
-			ScriptArray keys(mKeyType, mNumEntries);
-			ScriptArray values(mValueType, mNumEntries);
-
-			UINT32 offset = 0;
-			void* keyParams[2] = { keys.getInternal(), &offset };
-			parent->mKeysCopyTo->invoke(keyCollection, keyParams);
-
-			void* valueParams[2] = { values.getInternal(), &offset };
-			parent->mValuesCopyTo->invoke(valueCollection, valueParams);
-
-			keysArray = keys.getInternal();
-			valuesArray = values.getInternal();
-		}
-		else
-			mNumEntries = (UINT32)parent->mCachedEntries.size();
-
-		// Note: Handle needed since Enumerator will be on the stack? meaning the GC should be able to find the references.
-		if(keysArray && valuesArray)
-		{
-			mKeysArrayHandle = MonoUtil::newGCHandle((MonoObject*)keysArray, false);
-			mValuesArrayHandle = MonoUtil::newGCHandle((MonoObject*)valuesArray, false);
-		}
+		createManagedEnumerator();
 	}
 
 	ManagedSerializableDictionary::Enumerator::Enumerator(const Enumerator& other)
-		: mNumEntries(other.mNumEntries), mIteratorInitialized(false), mParent(other.mParent)
-	{
-		if(other.mKeysArrayHandle != 0 && other.mValuesArrayHandle != 0)
-		{
-			MonoObject* keysArray = MonoUtil::getObjectFromGCHandle(other.mKeysArrayHandle);
-			mKeysArrayHandle = MonoUtil::newGCHandle(keysArray, false);
-
-			MonoObject* valuesArray = MonoUtil::getObjectFromGCHandle(other.mValuesArrayHandle);
-			mValuesArrayHandle = MonoUtil::newGCHandle(valuesArray, false);
-
-			mKeyType = other.mKeyType;
-			mValueType = other.mValueType;
-		}
-	}
+		: Enumerator(other.mParent)
+	{ }
 
 	ManagedSerializableDictionary::Enumerator::~Enumerator()
 	{
-		if(mKeysArrayHandle != 0)
-			MonoUtil::freeGCHandle(mKeysArrayHandle);
-
-		if(mValuesArrayHandle != 0)
-			MonoUtil::freeGCHandle(mValuesArrayHandle);
+		freeManagedEnumerator();
 	}
 
 	ManagedSerializableDictionary::Enumerator& 
 		ManagedSerializableDictionary::Enumerator::operator=(const Enumerator& other)
 	{
-		mNumEntries = other.mNumEntries;
+		if(this == &other)
+			return *this;
+
+		mCurrentKey = nullptr;
+		mCurrentValue = nullptr;
 		mIteratorInitialized = false;
 		mParent = other.mParent;
-		mKeyType = nullptr;
-		mValueType = nullptr;
 
-		if(mKeysArrayHandle != 0)
-		{
-			MonoUtil::freeGCHandle(mKeysArrayHandle);
-			mKeysArrayHandle = 0;
-		}
-
-		if(mValuesArrayHandle != 0)
-		{
-			MonoUtil::freeGCHandle(mValuesArrayHandle);
-			mValuesArrayHandle = 0;
-		}
-
-		if(other.mKeysArrayHandle != 0 && other.mValuesArrayHandle != 0)
-		{
-			MonoObject* keysArray = MonoUtil::getObjectFromGCHandle(other.mKeysArrayHandle);
-			mKeysArrayHandle = MonoUtil::newGCHandle(keysArray, false);
-
-			MonoObject* valuesArray = MonoUtil::getObjectFromGCHandle(other.mValuesArrayHandle);
-			mValuesArrayHandle = MonoUtil::newGCHandle(valuesArray, false);
-
-			mKeyType = other.mKeyType;
-			mValueType = other.mValueType;
-		}
+		// Like with the copy constructor, the new enumerator starts from the beginning
+		freeManagedEnumerator();
+		createManagedEnumerator();
 
 		return *this;
 	}
 
 	SPtr<ManagedSerializableFieldData> ManagedSerializableDictionary::Enumerator::getKey() const
 	{
-		if (mKeysArrayHandle != 0)
-		{
-			MonoArray* keysArray = (MonoArray*)MonoUtil::getObjectFromGCHandle(mKeysArrayHandle);
-			ScriptArray keys(keysArray);
-
-			if(mCurrentIdx != (UINT32)-1)
-			{
-				void* val = (void*)keys.getRaw(mCurrentIdx, keys.elementSize());
-
-				MonoObject* obj = nullptr;
-				if (MonoUtil::isValueType(mKeyType))
-				{
-					if (val != nullptr)
-						obj = MonoUtil::box(mKeyType, val);
-				}
-				else
-					obj = *(MonoObject**)val;
-
-				return ManagedSerializableFieldData::create(mParent->mDictionaryTypeInfo->mKeyType, obj);
-			}
-			else
-				return nullptr;
-		}
+		if (mEnumeratorHandle != 0)
+			return mCurrentKey;
 		else
-		{
 			return mCachedIter->first;
-		}
 	}
 
 	SPtr<ManagedSerializableFieldData> ManagedSerializableDictionary::Enumerator::getValue() const
 	{
-		if (mValuesArrayHandle != 0)
-		{
-			MonoArray* valuesArray = (MonoArray*)MonoUtil::getObjectFromGCHandle(mValuesArrayHandle);
-			ScriptArray values(valuesArray);
-
-			if(mCurrentIdx != (UINT32)-1)
-			{
-				void* val = (void*)values.getRaw(mCurrentIdx, values.elementSize());
-
-				MonoObject* obj = nullptr;
-				if (MonoUtil::isValueType(mValueType))
-				{
-					if (val != nullptr)
-						obj = MonoUtil::box(mValueType, val);
-				}
-				else
-					obj = *(MonoObject**)val;
-
-				return ManagedSerializableFieldData::create(mParent->mDictionaryTypeInfo->mValueType, obj);
-			}
-			else
-				return nullptr;
-		}
+		if (mEnumeratorHandle != 0)
+			return mCurrentValue;
 		else
-		{
 			return mCachedIter->second;
-		}
 	}
 
 	bool ManagedSerializableDictionary::Enumerator::moveNext()
 	{
-		if (mKeysArrayHandle != 0 && mValuesArrayHandle != 0)
+		if (mEnumeratorHandle != 0)
 		{
-			if((mCurrentIdx + 1) < mNumEntries)
+			mCurrentKey = nullptr;
+			mCurrentValue = nullptr;
+
+			// Managed enumerator would throw if we continued after the dictionary was modified through its parent
+			if(mNumModifications != mParent->mNumModifications)
+			{
+				LOGWRN("Managed dictionary was modified during enumeration. Enumeration stopped early.");
+				freeManagedEnumerator();
+				return false;
+			}
+
+			MonoObject* enumerator = ScriptGCHandleTable::instance().getObject(mEnumeratorHandle);
+			if(enumerator == nullptr)
+				return false;
+
+			// The enumerator is a value type, and its methods expect a pointer to the unboxed value. This also means
+			// the boxed copy we hold a handle to is the one that advances.
+			MonoObject* hasNext = mParent->mEnumMoveNextMethod->invoke((MonoObject*)MonoUtil::unbox(enumerator), nullptr);
+
+			// No return value means MoveNext threw, which happens if the dictionary was modified from managed code
+			if(hasNext == nullptr)
 			{
-				mCurrentIdx++;
-				return true;
+				LOGWRN("Managed dictionary was modified during enumeration. Enumeration stopped early.");
+				freeManagedEnumerator();
+				return false;
 			}
 
-			return false;
+			if(!*(bool*)MonoUtil::unbox(hasNext))
+				return false;
+
+			// Read (and box, for value types) each entry only once, no matter how many times it is accessed
+			MonoObject* keyValue = mParent->mEnumCurrentProp->get((MonoObject*)MonoUtil::unbox(enumerator));
+			MonoObject* key = mParent->mKeyValueKeyProp->get((MonoObject*)MonoUtil::unbox(keyValue));
+			MonoObject* value = mParent->mKeyValueValueProp->get((MonoObject*)MonoUtil::unbox(keyValue));
+
+			const SPtr<ManagedSerializableTypeInfoDictionary>& typeInfo = mParent->mDictionaryTypeInfo;
+			mCurrentKey = ManagedSerializableFieldData::create(typeInfo->mKeyType, key);
+			mCurrentValue = ManagedSerializableFieldData::create(typeInfo->mValueType, value);
+
+			return true;
 		}
 		else
 		{
+			// Enumerator was released early due to a modification, or parent isn't linked and we iterate cached entries
+			if(mParent->mGCHandle != 0)
+				return false;
+
 			if (!mIteratorInitialized)
 			{
 				mCachedIter = mParent->mCachedEntries.begin();
@@ -228,13 +152,35 @@ namespace bs
 		}
 	}
 
+	void ManagedSerializableDictionary::Enumerator::createManagedEnumerator()
+	{
+		if(mParent->mGCHandle == 0)
+			return;
+
+		// Iterate using the dictionary's own enumerator, instead of copying all keys and values into temporary arrays.
+		// The enumerator is returned boxed, and we keep that box alive for the lifetime of this object.
+		MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mParent->mGCHandle);
+		MonoObject* enumerator = mParent->mGetEnumeratorMethod->invoke(managedInstance, nullptr);
+
+		mEnumeratorHandle = ScriptGCHandleTable::instance().newHandle(enumerator, ScriptGCHandleCategory::Serialization);
+		mNumModifications = mParent->mNumModifications;
+	}
+
+	void ManagedSerializableDictionary::Enumerator::freeManagedEnumerator()
+	{
+		if(mEnumeratorHandle != 0 && ScriptGCHandleTable::isStarted())
+			ScriptGCHandleTable::instance().freeHandle(mEnumeratorHandle);
+
+		mEnumeratorHandle = 0;
+	}
+
 	ManagedSerializableDictionary::ManagedSerializableDictionary(const ConstructPrivately& dummy)
 	{ }
 
 	ManagedSerializableDictionary::ManagedSerializableDictionary(const ConstructPrivately& dummy, const SPtr<ManagedSerializableTypeInfoDictionary>& typeInfo, MonoObject* managedInstance)
 		: mDictionaryTypeInfo(typeInfo)
 	{
-		mGCHandle = MonoUtil::newGCHandle(managedInstance, false);
+		mGCHandle = ScriptGCHandleTable::instance().newHandle(managedInstance, ScriptGCHandleCategory::Serialization);
 
 		MonoClass* dictClass = MonoManager::instance().findClass(MonoUtil::getClass(managedInstance));
 		if (dictClass == nullptr)
@@ -245,9 +191,9 @@ namespace bs
 
 	ManagedSerializableDictionary::~ManagedSerializableDictionary()
 	{
-		if(mGCHandle != 0)
+		if(mGCHandle != 0 && ScriptGCHandleTable::isStarted())
 		{
-			MonoUtil::freeGCHandle(mGCHandle);
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 			mGCHandle = 0;
 		}
 	}
@@ -296,7 +242,7 @@ namespace bs
 	MonoObject* ManagedSerializableDictionary::getManagedInstance() const
 	{
 		if(mGCHandle != 0)
-			return MonoUtil::getObjectFromGCHandle(mGCHandle);
+			return ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		return nullptr;
 	}
@@ -306,7 +252,7 @@ namespace bs
 		if (mGCHandle == 0)
 			return;
 
-		MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoClass* dictionaryClass = MonoManager::instance().findClass(MonoUtil::getClass(managedInstance));
 		if (dictionaryClass == nullptr)
 			return;
@@ -329,7 +275,7 @@ namespace bs
 			fieldEntry.second->serialize();
 		}
 
-		MonoUtil::freeGCHandle(mGCHandle);
+		ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 		mGCHandle = 0;
 	}
 
@@ -373,7 +319,7 @@ namespace bs
 			params[0] = key->getValue(mDictionaryTypeInfo->mKeyType);
 			params[1] = &value;
 
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			mTryGetValueMethod->invoke(managedInstance, params);
 
 			MonoObject* boxedValue = value;
@@ -396,8 +342,9 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			setFieldData(managedInstance, key, val);
+			mNumModifications++;
 		}
 		else
 		{
@@ -421,8 +368,9 @@ namespace bs
 			void* params[1];
 			params[0] = key->getValue(mDictionaryTypeInfo->mKeyType);
 
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			mRemoveMethod->invoke(managedInstance, params);
+			mNumModifications++;
 		}
 		else
 		{
@@ -439,7 +387,7 @@ namespace bs
 			void* params[1];
 			params[0] = key->getValue(mDictionaryTypeInfo->mKeyType);
 
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			MonoObject* returnVal = mContainsKeyMethod->invoke(managedInstance, params);
 			return *(bool*)MonoUtil::unbox(returnVal);
 		}
@@ -458,15 +406,15 @@ namespace bs
 		mRemoveMethod = dictionaryClass->getMethod("Remove", 1);
 		mTryGetValueMethod = dictionaryClass->getMethod("TryGetValue", 2);
 		mContainsKeyMethod = dictionaryClass->getMethod("ContainsKey", 1);
-		mCountProp = dictionaryClass->getProperty("Count");
-		mKeysProp = dictionaryClass->getProperty("Keys");
-		mValuesProp = dictionaryClass->getProperty("Values");
+		mGetEnumeratorMethod = dictionaryClass->getMethod("GetEnumerator");
 
-		MonoClass* keyCollectionClass = mKeysProp->getReturnType();
-		mKeysCopyTo = keyCollectionClass->getMethod("CopyTo", 2);
+		MonoClass* enumeratorClass = mGetEnumeratorMethod->getReturnType();
+		mEnumMoveNextMethod = enumeratorClass->getMethod("MoveNext");
+		mEnumCurrentProp = enumeratorClass->getProperty("Current");
 
-		MonoClass* valueCollectionClass = mValuesProp->getReturnType();
-		mValuesCopyTo = valueCollectionClass->getMethod("CopyTo", 2);
+		MonoClass* keyValueClass = mEnumCurrentProp->getReturnType();
+		mKeyValueKeyProp = keyValueClass->getProperty("Key");
+		mKeyValueValueProp = keyValueClass->getProperty("Value");
 	}
 
 	RTTITypeBase* ManagedSerializableDictionary::getRTTIStatic()
@@ -71,6 +71,9 @@ namespace bs
 		/**
 		 * Helper class that enumerates over all entires in a managed dictionary. Operates on managed object if the parent
 		 * dictionary is in linked state, or on cached data otherwise.
+		 *
+		 * @note	Modifying a linked dictionary while it is being enumerated ends the enumeration early and logs a
+		 *			warning.
 		 */
 		class Enumerator
 		{
@@ -108,12 +111,16 @@ namespace bs
 			bool moveNext();
 
 		private:
-			uint32_t mKeysArrayHandle = 0;
-			uint32_t mValuesArrayHandle = 0;
-			UINT32 mNumEntries = 0;
-			UINT32 mCurrentIdx = (UINT32)-1;
-			::MonoClass* mKeyType = nullptr;
-			::MonoClass* mValueType = nullptr;
+			/** Retrieves a new managed enumerator from the parent dictionary, positioned before the first entry. */
+			void createManagedEnumerator();
+
+			/** Frees the handle to the managed enumerator, if any. */
+			void freeManagedEnumerator();
+
+			UINT32 mEnumeratorHandle = 0;
+			UINT32 mNumModifications = 0;
+			SPtr<ManagedSerializableFieldData> mCurrentKey;
+			SPtr<ManagedSerializableFieldData> mCurrentValue;
 
 			CachedEntriesMap::const_iterator mCachedIter;
 			bool mIteratorInitialized;
@@ -236,11 +243,14 @@ namespace bs
 		MonoMethod* mRemoveMethod = nullptr;
 		MonoMethod* mTryGetValueMethod = nullptr;
 		MonoMethod* mContainsKeyMethod = nullptr;
-		MonoProperty* mCountProp = nullptr;
-		MonoProperty* mKeysProp = nullptr;
-		MonoMethod* mKeysCopyTo = nullptr;
-		MonoProperty* mValuesProp = nullptr;
-		MonoMethod* mValuesCopyTo = nullptr;
+		MonoMethod* mGetEnumeratorMethod = nullptr;
+		MonoMethod* mEnumMoveNextMethod = nullptr;
+		MonoProperty* mEnumCurrentProp = nullptr;
+		MonoProperty* mKeyValueKeyProp = nullptr;
+		MonoProperty* mKeyValueValueProp = nullptr;
+
+		/** Incremented whenever the linked managed dictionary is modified through this object. */
+		UINT32 mNumModifications = 0;
 
 		SPtr<ManagedSerializableTypeInfoDictionary> mDictionaryTypeInfo;
 		CachedEntriesMap mCachedEntries;
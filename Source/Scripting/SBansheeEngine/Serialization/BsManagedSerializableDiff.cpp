@@ -8,9 +8,52 @@
 #include "Serialization/BsManagedSerializableList.h"
 #include "Serialization/BsManagedSerializableDictionary.h"
 #include "RTTI/BsManagedSerializableDiffRTTI.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
+	/**
+	 * Checks if the provided complex field data contains a non-null value that isn't linked to a managed instance. Such
+	 * data is immutable for the duration of diff generation and doesn't require access to the managed runtime, so it can
+	 * be processed on worker threads.
+	 */
+	static bool isSerializedValue(const SPtr<ManagedSerializableFieldData>& data, UINT32 typeId)
+	{
+		switch (typeId)
+		{
+		case TID_SerializableTypeInfoObject:
+		{
+			const SPtr<ManagedSerializableObject>& value = 
+				std::static_pointer_cast<ManagedSerializableFieldDataObject>(data)->value;
+
+			return value != nullptr && value->getManagedInstance() == nullptr;
+		}
+		case TID_SerializableTypeInfoArray:
+		{
+			const SPtr<ManagedSerializableArray>& value = 
+				std::static_pointer_cast<ManagedSerializableFieldDataArray>(data)->value;
+
+			return value != nullptr && value->getManagedInstance() == nullptr;
+		}
+		case TID_SerializableTypeInfoList:
+		{
+			const SPtr<ManagedSerializableList>& value = 
+				std::static_pointer_cast<ManagedSerializableFieldDataList>(data)->value;
+
+			return value != nullptr && value->getManagedInstance() == nullptr;
+		}
+		case TID_SerializableTypeInfoDictionary:
+		{
+			const SPtr<ManagedSerializableDictionary>& value = 
+				std::static_pointer_cast<ManagedSerializableFieldDataDictionary>(data)->value;
+
+			return value != nullptr && value->getManagedInstance() == nullptr;
+		}
+		default:
+			return false;
+		}
+	}
+
 	ManagedSerializableDiff::ModifiedField::ModifiedField(const SPtr<ManagedSerializableTypeInfo>& parentType,
 		const SPtr<ManagedSerializableMemberInfo>& fieldType, const SPtr<Modification>& modification)
 		:parentType(parentType), fieldType(fieldType), modification(modification)
@@ -163,8 +206,12 @@ namespace bs
 		if (!oldObjInfo->mTypeInfo->matches(newObjInfo->mTypeInfo))
 			return nullptr;
 
+		// Objects not linked to managed instances (e.g. when generating prefab diffs) don't need to touch the managed
+		// runtime, so their fields can be compared in parallel
+		bool parallel = oldObj->getManagedInstance() == nullptr && newObj->getManagedInstance() == nullptr;
+
 		SPtr<ManagedSerializableDiff> output = bs_shared_ptr_new<ManagedSerializableDiff>();
-		SPtr<ModifiedObject> modifications = output->generateDiff(oldObj, newObj);
+		SPtr<ModifiedObject> modifications = output->generateDiff(oldObj, newObj, parallel);
 
 		if (modifications != nullptr)
 		{
@@ -176,9 +223,18 @@ namespace bs
 	}
 
 	SPtr<ManagedSerializableDiff::ModifiedObject> ManagedSerializableDiff::generateDiff
-		(const SPtr<ManagedSerializableObject>& oldObj, const SPtr<ManagedSerializableObject>& newObj)
+		(const SPtr<ManagedSerializableObject>& oldObj, const SPtr<ManagedSerializableObject>& newObj, bool parallel)
 	{
-		SPtr<ModifiedObject> output = nullptr;
+		/** Information about a single field to compare. */
+		struct FieldDiff
+		{
+			SPtr<ManagedSerializableTypeInfo> parentType;
+			SPtr<ManagedSerializableMemberInfo> fieldInfo;
+			SPtr<Modification> modification;
+		};
+
+		Vector<FieldDiff> fieldDiffs;
+		Vector<SPtr<Task>> tasks;
 
 		SPtr<ManagedSerializableObjectInfo> curObjInfo = newObj->getObjectInfo();
 		while (curObjInfo != nullptr)
@@ -188,22 +244,52 @@ namespace bs
 				if (!field.second->isSerializable())
 					continue;
 
-				UINT32 fieldTypeId = field.second->mTypeInfo->getTypeId();
+				fieldDiffs.push_back({ curObjInfo->mTypeInfo, field.second, nullptr });
+			}
+
+			curObjInfo = curObjInfo->mBaseClass;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)fieldDiffs.size(); i++)
+		{
+			FieldDiff& fieldDiff = fieldDiffs[i];
+			UINT32 fieldTypeId = fieldDiff.fieldInfo->mTypeInfo->getTypeId();
+
+			SPtr<ManagedSerializableFieldData> oldData = oldObj->getFieldData(fieldDiff.fieldInfo);
+			SPtr<ManagedSerializableFieldData> newData = newObj->getFieldData(fieldDiff.fieldInfo);
 
-				SPtr<ManagedSerializableFieldData> oldData = oldObj->getFieldData(field.second);
-				SPtr<ManagedSerializableFieldData> newData = newObj->getFieldData(field.second);
-				SPtr<Modification> newMod = generateDiff(oldData, newData, fieldTypeId);
-				
-				if (newMod != nullptr)
+			// Complex fields are independent sub-trees that can be compared on worker threads, while primitive fields
+			// aren't worth the task overhead
+			if (parallel && oldData != nullptr && newData != nullptr && isSerializedValue(oldData, fieldTypeId) && 
+				isSerializedValue(newData, fieldTypeId))
+			{
+				auto worker = [this, &fieldDiffs, i, oldData, newData, fieldTypeId]()
 				{
-					if (output == nullptr)
-						output = ModifiedObject::create();
+					fieldDiffs[i].modification = generateDiff(oldData, newData, fieldTypeId);
+				};
 
-					output->entries.push_back(ModifiedField(curObjInfo->mTypeInfo, field.second, newMod));
-				}
+				SPtr<Task> task = Task::create("ManagedSerializableDiff", worker);
+				TaskScheduler::instance().addTask(task);
+
+				tasks.push_back(task);
 			}
+			else
+				fieldDiff.modification = generateDiff(oldData, newData, fieldTypeId);
+		}
 
-			curObjInfo = curObjInfo->mBaseClass;
+		for (auto& task : tasks)
+			task->wait();
+
+		SPtr<ModifiedObject> output = nullptr;
+		for (auto& fieldDiff : fieldDiffs)
+		{
+			if (fieldDiff.modification == nullptr)
+				continue;
+
+			if (output == nullptr)
+				output = ModifiedObject::create();
+
+			output->entries.push_back(ModifiedField(fieldDiff.parentType, fieldDiff.fieldInfo, fieldDiff.modification));
 		}
 
 		return output;
@@ -196,8 +196,11 @@ namespace bs
 	private:
 		/**
 		 * Recursively generates a diff between all fields of the specified objects. Returns null if objects are identical.
+		 * If @p parallel is true, fields containing complex objects, arrays, lists or dictionaries not linked to managed
+		 * instances are compared using worker threads.
 		 */
-		SPtr<ModifiedObject> generateDiff(const SPtr<ManagedSerializableObject>& oldObj, const SPtr<ManagedSerializableObject>& newObj);
+		SPtr<ModifiedObject> generateDiff(const SPtr<ManagedSerializableObject>& oldObj, 
+			const SPtr<ManagedSerializableObject>& newObj, bool parallel = false);
 
 		/**
 		 * Generates a diff between two fields. Fields can be of any type and the system will generate the diff 
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Serialization/BsManagedSerializableList.h"
 #include "RTTI/BsManagedSerializableListRTTI.h"
+#include "BsScriptGCHandleTable.h"
 #include "BsMonoManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Serialization/BsManagedSerializableField.h"
@@ -21,7 +22,7 @@ namespace bs
 		const SPtr<ManagedSerializableTypeInfoList>& typeInfo, MonoObject* managedInstance)
 		:mListTypeInfo(typeInfo)
 	{
-		mGCHandle = MonoUtil::newGCHandle(managedInstance, false);
+		mGCHandle = ScriptGCHandleTable::instance().newHandle(managedInstance, ScriptGCHandleCategory::Serialization);
 
 		MonoClass* listClass = MonoManager::instance().findClass(MonoUtil::getClass(managedInstance));
 		if(listClass == nullptr)
@@ -34,9 +35,9 @@ namespace bs
 
 	ManagedSerializableList::~ManagedSerializableList()
 	{
-		if(mGCHandle != 0)
+		if(mGCHandle != 0 && ScriptGCHandleTable::isStarted())
 		{
-			MonoUtil::freeGCHandle(mGCHandle);
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 			mGCHandle = 0;
 		}
 	}
@@ -94,7 +95,7 @@ namespace bs
 	MonoObject* ManagedSerializableList::getManagedInstance() const
 	{
 		if(mGCHandle != 0)
-			return MonoUtil::getObjectFromGCHandle(mGCHandle);
+			return ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		return nullptr;
 	}
@@ -103,7 +104,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			setFieldData(managedInstance, arrayIdx, val);
 		}
 		else
@@ -117,7 +118,7 @@ namespace bs
 
 	void ManagedSerializableList::addFieldDataInternal(const SPtr<ManagedSerializableFieldData>& val)
 	{
-		MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		void* params[1];
 		params[0] = val->getValue(mListTypeInfo->mElementType);
@@ -128,7 +129,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			MonoObject* obj = mItemProp->getIndexed(managedInstance, arrayIdx);
 
 			return ManagedSerializableFieldData::create(mListTypeInfo->mElementType, obj);
@@ -181,7 +182,7 @@ namespace bs
 		for (auto& fieldEntry : mCachedEntries)
 			fieldEntry->serialize();
 
-		MonoUtil::freeGCHandle(mGCHandle);
+		ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 		mGCHandle = 0;
 	}
 
@@ -211,7 +212,7 @@ namespace bs
 
 	UINT32 ManagedSerializableList::getLengthInternal() const
 	{
-		MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 		MonoObject* length = mCountProp->get(managedInstance);
 
 		if(length == nullptr)
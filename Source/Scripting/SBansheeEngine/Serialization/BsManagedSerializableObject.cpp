@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Serialization/BsManagedSerializableObject.h"
 #include "RTTI/BsManagedSerializableObjectRTTI.h"
+#include "BsScriptGCHandleTable.h"
 #include "Serialization/BsManagedSerializableObjectInfo.h"
 #include "Serialization/BsManagedSerializableField.h"
 #include "Serialization/BsScriptAssemblyManager.h"
@@ -33,14 +34,14 @@ namespace bs
 	ManagedSerializableObject::ManagedSerializableObject(const ConstructPrivately& dummy, SPtr<ManagedSerializableObjectInfo> objInfo, MonoObject* managedInstance)
 		:mObjInfo(objInfo)
 	{
-		mGCHandle = MonoUtil::newGCHandle(managedInstance, false);
+		mGCHandle = ScriptGCHandleTable::instance().newHandle(managedInstance, ScriptGCHandleCategory::Serialization);
 	}
 
 	ManagedSerializableObject::~ManagedSerializableObject()
 	{
-		if(mGCHandle != 0)
+		if(mGCHandle != 0 && ScriptGCHandleTable::isStarted())
 		{
-			MonoUtil::freeGCHandle(mGCHandle);
+			ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 			mGCHandle = 0;
 		}		
 	}
@@ -93,7 +94,7 @@ namespace bs
 	MonoObject* ManagedSerializableObject::getManagedInstance() const
 	{
 		if(mGCHandle != 0)
-			return MonoUtil::getObjectFromGCHandle(mGCHandle);
+			return ScriptGCHandleTable::instance().getObject(mGCHandle);
 
 		return nullptr;
 	}
@@ -124,7 +125,7 @@ namespace bs
 		for (auto& fieldEntry : mCachedData)
 			fieldEntry.second->serialize();
 
-		MonoUtil::freeGCHandle(mGCHandle);
+		ScriptGCHandleTable::instance().freeHandle(mGCHandle);
 		mGCHandle = 0;
 	}
 
@@ -183,7 +184,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			fieldInfo->setValue(managedInstance, val->getValue(fieldInfo->mTypeInfo));
 		}
 		else
@@ -197,7 +198,7 @@ namespace bs
 	{
 		if (mGCHandle != 0)
 		{
-			MonoObject* managedInstance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+			MonoObject* managedInstance = ScriptGCHandleTable::instance().getObject(mGCHandle);
 			MonoObject* fieldValue = fieldInfo->getValue(managedInstance);
 
 			return ManagedSerializableFieldData::create(fieldInfo->mTypeInfo, fieldValue);
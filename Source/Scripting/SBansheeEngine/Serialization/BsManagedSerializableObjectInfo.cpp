@@ -26,7 +26,7 @@ namespace bs
 	}
 
 	ManagedSerializableObjectInfo::ManagedSerializableObjectInfo()
-		:mMonoClass(nullptr)
+		:mMonoClass(nullptr), mBlittable(false)
 	{
 
 	}
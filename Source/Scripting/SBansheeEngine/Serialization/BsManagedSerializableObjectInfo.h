@@ -420,6 +420,12 @@ namespace bs
 		SPtr<ManagedSerializableObjectInfo> mBaseClass;
 		Vector<std::weak_ptr<ManagedSerializableObjectInfo>> mDerivedClasses;
 
+		/**
+		 * True if the type is a struct whose instance fields are all serializable non-string primitives, in which case its
+		 * contents can be copied directly. Determined when the assembly is loaded, and not serialized.
+		 */
+		bool mBlittable;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
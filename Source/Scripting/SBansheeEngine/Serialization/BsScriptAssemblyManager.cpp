@@ -143,6 +143,7 @@ namespace bs
 			SPtr<ManagedSerializableObjectInfo> objInfo = curClassInfo.second;
 
 			UINT32 mUniqueFieldId = 1;
+			bool blittable = objInfo->mTypeInfo->mValueType;
 
 			const Vector<MonoField*>& fields = objInfo->mMonoClass->getAllFields();
 			for(auto& field : fields)
@@ -152,7 +153,10 @@ namespace bs
 
 				SPtr<ManagedSerializableTypeInfo> typeInfo = getTypeInfo(field->getType());
 				if (typeInfo == nullptr)
+				{
+					blittable = false;
 					continue;
+				}
 
 				SPtr<ManagedSerializableFieldInfo> fieldInfo = bs_shared_ptr_new<ManagedSerializableFieldInfo>();
 				fieldInfo->mFieldId = mUniqueFieldId++;
@@ -187,6 +191,12 @@ namespace bs
 				if (field->hasAttribute(mBuiltin.stepAttribute))
 					fieldInfo->mFlags |= ScriptFieldFlag::Step;
 
+				if (!fieldInfo->isSerializable() || typeInfo->getTypeId() != TID_SerializableTypeInfoPrimitive ||
+					std::static_pointer_cast<ManagedSerializableTypeInfoPrimitive>(typeInfo)->mType == ScriptPrimitiveType::String)
+				{
+					blittable = false;
+				}
+
 				objInfo->mFieldNameToId[fieldInfo->mName] = fieldInfo->mFieldId;
 				objInfo->mFields[fieldInfo->mFieldId] = fieldInfo;
 			}
@@ -224,9 +234,15 @@ namespace bs
 				if (property->hasAttribute(mBuiltin.stepAttribute))
 					propertyInfo->mFlags |= ScriptFieldFlag::Step;
 
+				// Serializable properties must go through their setters
+				if (propertyInfo->isSerializable())
+					blittable = false;
+
 				objInfo->mFieldNameToId[propertyInfo->mName] = propertyInfo->mFieldId;
 				objInfo->mFields[propertyInfo->mFieldId] = propertyInfo;
 			}
+
+			objInfo->mBlittable = blittable;
 		}
 
 		// Form parent/child connections
@@ -0,0 +1,174 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptAnimationCurvesKeyFrames.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+
+#include "BsScriptAnimationCurves.generated.h"
+
+namespace bs
+{
+	ScriptAnimationCurvesKeyFrames::ScriptAnimationCurvesKeyFrames(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptAnimationCurvesKeyFrames::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_FindCurve",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_FindCurve);
+		metaData.scriptClass->addInternalCall("Internal_GetNumKeyFrames",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_GetNumKeyFrames);
+		metaData.scriptClass->addInternalCall("Internal_GetKeyFrames",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_GetKeyFrames);
+		metaData.scriptClass->addInternalCall("Internal_SetKeyFrameFloat",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameFloat);
+		metaData.scriptClass->addInternalCall("Internal_SetKeyFrameVec3",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameVec3);
+		metaData.scriptClass->addInternalCall("Internal_SetKeyFrameQuat",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameQuat);
+		metaData.scriptClass->addInternalCall("Internal_AddKeyFrameFloat",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameFloat);
+		metaData.scriptClass->addInternalCall("Internal_AddKeyFrameVec3",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameVec3);
+		metaData.scriptClass->addInternalCall("Internal_AddKeyFrameQuat",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameQuat);
+		metaData.scriptClass->addInternalCall("Internal_RemoveKeyFrame",
+			(void*)&ScriptAnimationCurvesKeyFrames::internal_RemoveKeyFrame);
+		metaData.scriptClass->addInternalCall("Internal_Clone", (void*)&ScriptAnimationCurvesKeyFrames::internal_Clone);
+	}
+
+	template<class T>
+	UINT32 ScriptAnimationCurvesKeyFrames::copyKeyFrames(const SPtr<AnimationCurves>& curves, AnimationCurveSet set,
+		UINT32 curveIdx, UINT32 start, MonoArray* output)
+	{
+		const Vector<TKeyframe<T>>* keyFrames = AnimationCurvesEx::getKeyframes<T>(curves, set, curveIdx);
+		if (keyFrames == nullptr || start >= (UINT32)keyFrames->size())
+			return 0;
+
+		ScriptArray outputArray(output);
+
+		// Managed keyframe structs are blittable, but make sure the array is of the type matching the curve set
+		if (outputArray.elementSize() != sizeof(TKeyframe<T>))
+			return 0;
+
+		UINT32 count = std::min((UINT32)keyFrames->size() - start, outputArray.size());
+		if (count > 0)
+			memcpy(outputArray.getRaw(0, sizeof(TKeyframe<T>)), &(*keyFrames)[start], count * sizeof(TKeyframe<T>));
+
+		return count;
+	}
+
+	bool ScriptAnimationCurvesKeyFrames::checkIfShared(ScriptAnimationCurves* thisPtr)
+	{
+		if (!AnimationCurvesEx::isClipOwned(thisPtr->getInternal()))
+			return false;
+
+		LOGWRN("Cannot modify keyframes of animation curves shared with an animation clip. Use "
+			"AnimationClip.EditCurves instead.");
+		return true;
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_FindCurve(ScriptAnimationCurves* thisPtr, AnimationCurveSet set,
+		MonoString* name)
+	{
+		String nativeName = MonoUtil::monoToString(name);
+		return AnimationCurvesEx::findCurve(thisPtr->getInternal(), set, nativeName);
+	}
+
+	UINT32 ScriptAnimationCurvesKeyFrames::internal_GetNumKeyFrames(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx)
+	{
+		return AnimationCurvesEx::getNumKeyframes(thisPtr->getInternal(), set, curveIdx);
+	}
+
+	UINT32 ScriptAnimationCurvesKeyFrames::internal_GetKeyFrames(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, UINT32 start, MonoArray* output)
+	{
+		if (output == nullptr)
+			return 0;
+
+		switch (set)
+		{
+		case AnimationCurveSet::Position:
+		case AnimationCurveSet::Scale:
+			return copyKeyFrames<Vector3>(thisPtr->getInternal(), set, curveIdx, start, output);
+		case AnimationCurveSet::Rotation:
+			return copyKeyFrames<Quaternion>(thisPtr->getInternal(), set, curveIdx, start, output);
+		case AnimationCurveSet::Generic:
+			return copyKeyFrames<float>(thisPtr->getInternal(), set, curveIdx, start, output);
+		}
+
+		return 0;
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameFloat(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, UINT32 keyIdx, TKeyframe<float>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::setKeyframe(thisPtr->getInternal(), set, curveIdx, keyIdx, *keyFrame);
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameVec3(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, UINT32 keyIdx, TKeyframe<Vector3>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::setKeyframe(thisPtr->getInternal(), set, curveIdx, keyIdx, *keyFrame);
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_SetKeyFrameQuat(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, UINT32 keyIdx, TKeyframe<Quaternion>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::setKeyframe(thisPtr->getInternal(), set, curveIdx, keyIdx, *keyFrame);
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameFloat(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, TKeyframe<float>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::addKeyframe(thisPtr->getInternal(), set, curveIdx, *keyFrame);
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameVec3(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, TKeyframe<Vector3>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::addKeyframe(thisPtr->getInternal(), set, curveIdx, *keyFrame);
+	}
+
+	INT32 ScriptAnimationCurvesKeyFrames::internal_AddKeyFrameQuat(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, TKeyframe<Quaternion>* keyFrame)
+	{
+		if (checkIfShared(thisPtr))
+			return -1;
+
+		return AnimationCurvesEx::addKeyframe(thisPtr->getInternal(), set, curveIdx, *keyFrame);
+	}
+
+	bool ScriptAnimationCurvesKeyFrames::internal_RemoveKeyFrame(ScriptAnimationCurves* thisPtr,
+		AnimationCurveSet set, UINT32 curveIdx, UINT32 keyIdx)
+	{
+		if (checkIfShared(thisPtr))
+			return false;
+
+		return AnimationCurvesEx::removeKeyframe(thisPtr->getInternal(), set, curveIdx, keyIdx);
+	}
+
+	MonoObject* ScriptAnimationCurvesKeyFrames::internal_Clone(ScriptAnimationCurves* thisPtr)
+	{
+		SPtr<AnimationCurves> copy = bs_shared_ptr_new<AnimationCurves>(*thisPtr->getInternal());
+		return ScriptAnimationCurves::create(copy);
+	}
+}
\ No newline at end of file
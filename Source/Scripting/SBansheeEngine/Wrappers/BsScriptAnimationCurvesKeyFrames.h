@@ -0,0 +1,70 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Extensions/BsAnimationEx.h"
+
+namespace bs
+{
+	class ScriptAnimationCurves;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for AnimationCurvesKeyFrames. Provides access to individual keyframes of curves
+	 * in AnimationCurves, without copying the entire curve set between native and managed code.
+	 */
+	class BS_SCR_BE_EXPORT ScriptAnimationCurvesKeyFrames : public ScriptObject<ScriptAnimationCurvesKeyFrames>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "AnimationCurvesKeyFrames")
+
+	private:
+		ScriptAnimationCurvesKeyFrames(MonoObject* instance);
+
+		/**
+		 * Copies keyframes of type @p T from the specified curve into a managed array. Returns the number of copied
+		 * keyframes.
+		 */
+		template<class T>
+		static UINT32 copyKeyFrames(const SPtr<AnimationCurves>& curves, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 start, MonoArray* output);
+
+		/**
+		 * Checks are the curves owned by an animation clip, and logs a warning if so. Curves returned by an
+		 * AnimationClip, or passed to its constructor, are shared with the clip and the animation thread, and modifying
+		 * them in place would bypass the clip's versioning. Such curves must be copied, modified and assigned back to
+		 * the clip.
+		 */
+		static bool checkIfShared(ScriptAnimationCurves* thisPtr);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static INT32 internal_FindCurve(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, MonoString* name);
+		static UINT32 internal_GetNumKeyFrames(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx);
+		static UINT32 internal_GetKeyFrames(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 start, MonoArray* output);
+		static INT32 internal_SetKeyFrameFloat(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx, TKeyframe<float>* keyFrame);
+		static INT32 internal_SetKeyFrameVec3(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx, TKeyframe<Vector3>* keyFrame);
+		static INT32 internal_SetKeyFrameQuat(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx, TKeyframe<Quaternion>* keyFrame);
+		static INT32 internal_AddKeyFrameFloat(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			TKeyframe<float>* keyFrame);
+		static INT32 internal_AddKeyFrameVec3(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			TKeyframe<Vector3>* keyFrame);
+		static INT32 internal_AddKeyFrameQuat(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			TKeyframe<Quaternion>* keyFrame);
+		static bool internal_RemoveKeyFrame(ScriptAnimationCurves* thisPtr, AnimationCurveSet set, UINT32 curveIdx,
+			UINT32 keyIdx);
+		static MonoObject* internal_Clone(ScriptAnimationCurves* thisPtr);
+	};
+
+	/** @} */
+}
\ No newline at end of file
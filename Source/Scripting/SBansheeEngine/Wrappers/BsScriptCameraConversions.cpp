@@ -0,0 +1,226 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptCameraConversions.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "Components/BsCCamera.h"
+#include "RenderAPI/BsViewport.h"
+#include "Math/BsRay.h"
+
+#include "BsScriptCCamera.generated.h"
+
+namespace bs
+{
+	/** Limits the number of points to the size of a managed array. Returns zero if the array is missing. */
+	static UINT32 clampToArray(UINT32 numPoints, MonoArray* array)
+	{
+		if (array == nullptr)
+			return 0;
+
+		ScriptArray scriptArray(array);
+		return std::min(numPoints, scriptArray.size());
+	}
+
+	/** Returns the camera component referenced by the script object, or null if it has been destroyed. */
+	static CCamera* getCamera(ScriptCCamera* thisPtr)
+	{
+		if (thisPtr == nullptr)
+			return nullptr;
+
+		const GameObjectHandle<CCamera>& camera = thisPtr->getHandle();
+		if (camera.isDestroyed())
+			return nullptr;
+
+		return camera.get();
+	}
+
+	/**
+	 * Transforms world points into normalized device coordinates and determines whether they are within the camera's
+	 * frustum. @p output is called with the index, NDC position and visibility of each point. Returns the number of
+	 * visible points.
+	 */
+	template<class Output>
+	static UINT32 worldToNdc(const CCamera& camera, const Vector3* points, UINT32 numPoints, Output output)
+	{
+		const Matrix4& view = camera.getViewMatrix();
+		Matrix4 viewProj = camera.getProjectionMatrix() * view;
+
+		float nearDist = camera.getNearClipDistance();
+		float farDist = camera.getFarClipDistance();
+
+		// Matrix rows are hoisted out of the loop so the per-point work is a plain set of multiply-adds
+		const float* r0 = viewProj[0];
+		const float* r1 = viewProj[1];
+		const float* r3 = viewProj[3];
+		const float* viewZ = view[2];
+
+		UINT32 numVisible = 0;
+		for (UINT32 i = 0; i < numPoints; i++)
+		{
+			const Vector3& point = points[i];
+
+			float x = r0[0] * point.x + r0[1] * point.y + r0[2] * point.z + r0[3];
+			float y = r1[0] * point.x + r1[1] * point.y + r1[2] * point.z + r1[3];
+			float w = r3[0] * point.x + r3[1] * point.y + r3[2] * point.z + r3[3];
+
+			// Camera looks down the negative Z axis in view space
+			float depth = -(viewZ[0] * point.x + viewZ[1] * point.y + viewZ[2] * point.z + viewZ[3]);
+
+			bool visible = w > 0.0f && Math::abs(x) <= w && Math::abs(y) <= w && depth >= nearDist && depth <= farDist;
+			if (visible)
+				numVisible++;
+
+			// Same handling of degenerate points as CCamera::projectPoint()
+			Vector2 ndcPoint;
+			if (Math::abs(w) > 1e-7f)
+			{
+				float invW = 1.0f / w;
+				ndcPoint = Vector2(x * invW, y * invW);
+			}
+			else
+				ndcPoint = Vector2::ZERO;
+
+			output(i, ndcPoint, visible);
+		}
+
+		return numVisible;
+	}
+
+	ScriptCameraConversions::ScriptCameraConversions(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptCameraConversions::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_WorldToScreenPoints",
+			(void*)&ScriptCameraConversions::internal_WorldToScreenPoints);
+		metaData.scriptClass->addInternalCall("Internal_WorldToNdcPoints",
+			(void*)&ScriptCameraConversions::internal_WorldToNdcPoints);
+		metaData.scriptClass->addInternalCall("Internal_WorldToViewPoints",
+			(void*)&ScriptCameraConversions::internal_WorldToViewPoints);
+		metaData.scriptClass->addInternalCall("Internal_ScreenToWorldPoints",
+			(void*)&ScriptCameraConversions::internal_ScreenToWorldPoints);
+		metaData.scriptClass->addInternalCall("Internal_ScreenPointsToRays",
+			(void*)&ScriptCameraConversions::internal_ScreenPointsToRays);
+	}
+
+	UINT32 ScriptCameraConversions::internal_WorldToScreenPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints,
+		UINT32 numPoints, MonoArray* screenPoints, MonoArray* visible)
+	{
+		CCamera* camera = getCamera(thisPtr);
+		if (camera == nullptr || camera->getViewport() == nullptr)
+			return 0;
+
+		numPoints = clampToArray(clampToArray(numPoints, worldPoints), screenPoints);
+		if (visible != nullptr)
+			numPoints = clampToArray(numPoints, visible);
+
+		if (numPoints == 0)
+			return 0;
+
+		const Vector3* input = ScriptArray(worldPoints).getRaw<Vector3>();
+		Vector2I* output = ScriptArray(screenPoints).getRaw<Vector2I>();
+		bool* visibleOutput = visible != nullptr ? ScriptArray(visible).getRaw<bool>() : nullptr;
+
+		Rect2I area = camera->getViewport()->getPixelArea();
+		float left = (float)area.x;
+		float top = (float)area.y;
+		float width = (float)area.width;
+		float height = (float)area.height;
+
+		return worldToNdc(*camera, input, numPoints, [&](UINT32 i, const Vector2& ndcPoint, bool isVisible)
+		{
+			// Same mapping as CCamera::ndcToScreenPoint(), with the viewport area looked up only once
+			float x = left + (ndcPoint.x * 0.5f + 0.5f) * width;
+			float y = top + (1.0f - (ndcPoint.y * 0.5f + 0.5f)) * height;
+
+			output[i] = Vector2I(Math::roundToInt(x), Math::roundToInt(y));
+
+			if (visibleOutput != nullptr)
+				visibleOutput[i] = isVisible;
+		});
+	}
+
+	UINT32 ScriptCameraConversions::internal_WorldToNdcPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints,
+		UINT32 numPoints, MonoArray* ndcPoints, MonoArray* visible)
+	{
+		CCamera* camera = getCamera(thisPtr);
+		if (camera == nullptr)
+			return 0;
+
+		numPoints = clampToArray(clampToArray(numPoints, worldPoints), ndcPoints);
+		if (visible != nullptr)
+			numPoints = clampToArray(numPoints, visible);
+
+		if (numPoints == 0)
+			return 0;
+
+		const Vector3* input = ScriptArray(worldPoints).getRaw<Vector3>();
+		Vector2* output = ScriptArray(ndcPoints).getRaw<Vector2>();
+		bool* visibleOutput = visible != nullptr ? ScriptArray(visible).getRaw<bool>() : nullptr;
+
+		return worldToNdc(*camera, input, numPoints, [&](UINT32 i, const Vector2& ndcPoint, bool isVisible)
+		{
+			output[i] = ndcPoint;
+
+			if (visibleOutput != nullptr)
+				visibleOutput[i] = isVisible;
+		});
+	}
+
+	void ScriptCameraConversions::internal_WorldToViewPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints,
+		UINT32 numPoints, MonoArray* viewPoints)
+	{
+		CCamera* camera = getCamera(thisPtr);
+		if (camera == nullptr)
+			return;
+
+		numPoints = clampToArray(clampToArray(numPoints, worldPoints), viewPoints);
+		if (numPoints == 0)
+			return;
+
+		const Vector3* input = ScriptArray(worldPoints).getRaw<Vector3>();
+		Vector3* output = ScriptArray(viewPoints).getRaw<Vector3>();
+
+		const Matrix4& view = camera->getViewMatrix();
+		for (UINT32 i = 0; i < numPoints; i++)
+			output[i] = view.multiplyAffine(input[i]);
+	}
+
+	void ScriptCameraConversions::internal_ScreenToWorldPoints(ScriptCCamera* thisPtr, MonoArray* screenPoints,
+		float depth, UINT32 numPoints, MonoArray* worldPoints)
+	{
+		CCamera* camera = getCamera(thisPtr);
+		if (camera == nullptr)
+			return;
+
+		numPoints = clampToArray(clampToArray(numPoints, screenPoints), worldPoints);
+		if (numPoints == 0)
+			return;
+
+		const Vector2I* input = ScriptArray(screenPoints).getRaw<Vector2I>();
+		Vector3* output = ScriptArray(worldPoints).getRaw<Vector3>();
+
+		for (UINT32 i = 0; i < numPoints; i++)
+			output[i] = camera->screenToWorldPoint(input[i], depth);
+	}
+
+	void ScriptCameraConversions::internal_ScreenPointsToRays(ScriptCCamera* thisPtr, MonoArray* screenPoints,
+		UINT32 numPoints, MonoArray* rays)
+	{
+		CCamera* camera = getCamera(thisPtr);
+		if (camera == nullptr)
+			return;
+
+		numPoints = clampToArray(clampToArray(numPoints, screenPoints), rays);
+		if (numPoints == 0)
+			return;
+
+		const Vector2I* input = ScriptArray(screenPoints).getRaw<Vector2I>();
+		Ray* output = ScriptArray(rays).getRaw<Ray>();
+
+		for (UINT32 i = 0; i < numPoints; i++)
+			output[i] = camera->screenPointToRay(input[i]);
+	}
+}
\ No newline at end of file
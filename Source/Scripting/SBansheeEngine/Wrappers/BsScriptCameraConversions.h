@@ -0,0 +1,44 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	class ScriptCCamera;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for CameraConversions. Converts many points between camera coordinate spaces in a
+	 * single call, reading from and writing to caller provided managed arrays.
+	 */
+	class BS_SCR_BE_EXPORT ScriptCameraConversions : public ScriptObject<ScriptCameraConversions>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "CameraConversions")
+
+	private:
+		ScriptCameraConversions(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static UINT32 internal_WorldToScreenPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints, UINT32 numPoints,
+			MonoArray* screenPoints, MonoArray* visible);
+		static UINT32 internal_WorldToNdcPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints, UINT32 numPoints,
+			MonoArray* ndcPoints, MonoArray* visible);
+		static void internal_WorldToViewPoints(ScriptCCamera* thisPtr, MonoArray* worldPoints, UINT32 numPoints,
+			MonoArray* viewPoints);
+		static void internal_ScreenToWorldPoints(ScriptCCamera* thisPtr, MonoArray* screenPoints, float depth,
+			UINT32 numPoints, MonoArray* worldPoints);
+		static void internal_ScreenPointsToRays(ScriptCCamera* thisPtr, MonoArray* screenPoints, UINT32 numPoints,
+			MonoArray* rays);
+	};
+
+	/** @} */
+}
\ No newline at end of file
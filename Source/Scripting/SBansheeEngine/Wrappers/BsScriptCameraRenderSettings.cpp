@@ -0,0 +1,312 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptCameraRenderSettings.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsScriptObjectManager.h"
+#include "Components/BsCCamera.h"
+#include "Renderer/BsRenderSettings.h"
+
+#include "BsScriptCCamera.generated.h"
+#include "BsScriptAutoExposureSettings.generated.h"
+#include "BsScriptTonemappingSettings.generated.h"
+#include "BsScriptWhiteBalanceSettings.generated.h"
+#include "BsScriptColorGradingSettings.generated.h"
+#include "BsScriptDepthOfFieldSettings.generated.h"
+#include "BsScriptAmbientOcclusionSettings.generated.h"
+#include "BsScriptScreenSpaceReflectionsSettings.generated.h"
+#include "BsScriptShadowSettings.generated.h"
+
+namespace bs
+{
+	Vector<ScriptCameraRenderSettings::PendingSettings> ScriptCameraRenderSettings::sPending;
+	HEvent ScriptCameraRenderSettings::sRefreshStartedConn;
+
+	ScriptCameraRenderSettings::ScriptCameraRenderSettings(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptCameraRenderSettings::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_SetExposureScale",
+			(void*)&ScriptCameraRenderSettings::internal_SetExposureScale);
+		metaData.scriptClass->addInternalCall("Internal_SetGamma",
+			(void*)&ScriptCameraRenderSettings::internal_SetGamma);
+		metaData.scriptClass->addInternalCall("Internal_SetFeatureEnabled",
+			(void*)&ScriptCameraRenderSettings::internal_SetFeatureEnabled);
+		metaData.scriptClass->addInternalCall("Internal_SetAutoExposure",
+			(void*)&ScriptCameraRenderSettings::internal_SetAutoExposure);
+		metaData.scriptClass->addInternalCall("Internal_SetTonemapping",
+			(void*)&ScriptCameraRenderSettings::internal_SetTonemapping);
+		metaData.scriptClass->addInternalCall("Internal_SetWhiteBalance",
+			(void*)&ScriptCameraRenderSettings::internal_SetWhiteBalance);
+		metaData.scriptClass->addInternalCall("Internal_SetColorGrading",
+			(void*)&ScriptCameraRenderSettings::internal_SetColorGrading);
+		metaData.scriptClass->addInternalCall("Internal_SetDepthOfField",
+			(void*)&ScriptCameraRenderSettings::internal_SetDepthOfField);
+		metaData.scriptClass->addInternalCall("Internal_SetAmbientOcclusion",
+			(void*)&ScriptCameraRenderSettings::internal_SetAmbientOcclusion);
+		metaData.scriptClass->addInternalCall("Internal_SetScreenSpaceReflections",
+			(void*)&ScriptCameraRenderSettings::internal_SetScreenSpaceReflections);
+		metaData.scriptClass->addInternalCall("Internal_SetShadowSettings",
+			(void*)&ScriptCameraRenderSettings::internal_SetShadowSettings);
+		metaData.scriptClass->addInternalCall("Internal_GetDirtyGroups",
+			(void*)&ScriptCameraRenderSettings::internal_GetDirtyGroups);
+		metaData.scriptClass->addInternalCall("Internal_Apply", (void*)&ScriptCameraRenderSettings::internal_Apply);
+	}
+
+	void ScriptCameraRenderSettings::update()
+	{
+		// Each camera's settings are applied once, no matter how many groups were modified during the frame
+		for (auto& entry : sPending)
+			applyPending(entry);
+
+		sPending.clear();
+	}
+
+	void ScriptCameraRenderSettings::startUp()
+	{
+		sRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(&onRefreshStarted);
+	}
+
+	void ScriptCameraRenderSettings::shutDown()
+	{
+		sRefreshStartedConn.disconnect();
+		sPending.clear();
+	}
+
+	void ScriptCameraRenderSettings::onRefreshStarted()
+	{
+		sPending.clear();
+	}
+
+	void ScriptCameraRenderSettings::applyPending(const PendingSettings& entry)
+	{
+		if (entry.camera.isDestroyed())
+			return;
+
+		// Settings were assigned after the modifications were made, and the assignment is the more recent change
+		const SPtr<RenderSettings>& current = entry.camera->getRenderSettings();
+		if (current != entry.base)
+			return;
+
+		// Only pass on the modified groups, so changes made directly to the camera's settings object aren't lost
+		SPtr<RenderSettings> output = bs_shared_ptr_new<RenderSettings>();
+		if (current != nullptr)
+			*output = *current;
+
+		const RenderSettings& src = *entry.settings;
+		const UINT32 groups = entry.dirtyGroups;
+		if (groups & (UINT32)RenderSettingsGroup::General)
+		{
+			output->exposureScale = src.exposureScale;
+			output->gamma = src.gamma;
+			output->enableAutoExposure = src.enableAutoExposure;
+			output->enableTonemapping = src.enableTonemapping;
+			output->enableFXAA = src.enableFXAA;
+			output->enableHDR = src.enableHDR;
+			output->enableLighting = src.enableLighting;
+			output->enableShadows = src.enableShadows;
+			output->enableIndirectLighting = src.enableIndirectLighting;
+			output->enableSkybox = src.enableSkybox;
+			output->overlayOnly = src.overlayOnly;
+		}
+
+		if (groups & (UINT32)RenderSettingsGroup::AutoExposure)
+			output->autoExposure = src.autoExposure;
+
+		if (groups & (UINT32)RenderSettingsGroup::Tonemapping)
+			output->tonemapping = src.tonemapping;
+
+		if (groups & (UINT32)RenderSettingsGroup::WhiteBalance)
+			output->whiteBalance = src.whiteBalance;
+
+		if (groups & (UINT32)RenderSettingsGroup::ColorGrading)
+			output->colorGrading = src.colorGrading;
+
+		if (groups & (UINT32)RenderSettingsGroup::DepthOfField)
+			output->depthOfField = src.depthOfField;
+
+		if (groups & (UINT32)RenderSettingsGroup::AmbientOcclusion)
+			output->ambientOcclusion = src.ambientOcclusion;
+
+		if (groups & (UINT32)RenderSettingsGroup::ScreenSpaceReflections)
+			output->screenSpaceReflections = src.screenSpaceReflections;
+
+		if (groups & (UINT32)RenderSettingsGroup::Shadows)
+			output->shadowSettings = src.shadowSettings;
+
+		entry.camera->setRenderSettings(output);
+	}
+
+	ScriptCameraRenderSettings::PendingSettings* ScriptCameraRenderSettings::findPending(ScriptCCamera* thisPtr)
+	{
+		const GameObjectHandle<CCamera>& camera = thisPtr->getHandle();
+		for (auto& entry : sPending)
+		{
+			if (entry.camera == camera)
+				return &entry;
+		}
+
+		return nullptr;
+	}
+
+	RenderSettings* ScriptCameraRenderSettings::beginEdit(ScriptCCamera* thisPtr, RenderSettingsGroup group)
+	{
+		const GameObjectHandle<CCamera>& camera = thisPtr->getHandle();
+		if (camera.isDestroyed())
+			return nullptr;
+
+		const SPtr<RenderSettings>& current = camera->getRenderSettings();
+		PendingSettings* entry = findPending(thisPtr);
+
+		// Settings were assigned since the modifications started, which overrides them
+		if (entry != nullptr && entry->base != current)
+		{
+			sPending.erase(sPending.begin() + (entry - sPending.data()));
+			entry = nullptr;
+		}
+
+		if (entry == nullptr)
+		{
+			SPtr<RenderSettings> settings = bs_shared_ptr_new<RenderSettings>();
+			if (current != nullptr)
+				*settings = *current;
+
+			sPending.push_back({ camera, current, settings, 0 });
+			entry = &sPending.back();
+		}
+
+		entry->dirtyGroups |= (UINT32)group;
+		return entry->settings.get();
+	}
+
+	template<class ScriptType, class Type>
+	void ScriptCameraRenderSettings::setGroup(ScriptCCamera* thisPtr, MonoObject* value, Type RenderSettings::* member,
+		RenderSettingsGroup group)
+	{
+		if (value == nullptr)
+			return;
+
+		ScriptType* scriptValue = ScriptType::toNative(value);
+		RenderSettings* settings = beginEdit(thisPtr, group);
+		if (settings != nullptr)
+			settings->*member = *scriptValue->getInternal();
+	}
+
+	void ScriptCameraRenderSettings::internal_SetExposureScale(ScriptCCamera* thisPtr, float value)
+	{
+		RenderSettings* settings = beginEdit(thisPtr, RenderSettingsGroup::General);
+		if (settings != nullptr)
+			settings->exposureScale = value;
+	}
+
+	void ScriptCameraRenderSettings::internal_SetGamma(ScriptCCamera* thisPtr, float value)
+	{
+		RenderSettings* settings = beginEdit(thisPtr, RenderSettingsGroup::General);
+		if (settings != nullptr)
+			settings->gamma = value;
+	}
+
+	void ScriptCameraRenderSettings::internal_SetFeatureEnabled(ScriptCCamera* thisPtr, RenderFeature feature,
+		bool enabled)
+	{
+		RenderSettings* settings = beginEdit(thisPtr, RenderSettingsGroup::General);
+		if (settings == nullptr)
+			return;
+
+		switch (feature)
+		{
+		case RenderFeature::AutoExposure:
+			settings->enableAutoExposure = enabled;
+			break;
+		case RenderFeature::Tonemapping:
+			settings->enableTonemapping = enabled;
+			break;
+		case RenderFeature::FXAA:
+			settings->enableFXAA = enabled;
+			break;
+		case RenderFeature::HDR:
+			settings->enableHDR = enabled;
+			break;
+		case RenderFeature::Lighting:
+			settings->enableLighting = enabled;
+			break;
+		case RenderFeature::Shadows:
+			settings->enableShadows = enabled;
+			break;
+		case RenderFeature::IndirectLighting:
+			settings->enableIndirectLighting = enabled;
+			break;
+		case RenderFeature::Skybox:
+			settings->enableSkybox = enabled;
+			break;
+		case RenderFeature::OverlayOnly:
+			settings->overlayOnly = enabled;
+			break;
+		}
+	}
+
+	void ScriptCameraRenderSettings::internal_SetAutoExposure(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptAutoExposureSettings>(thisPtr, value, &RenderSettings::autoExposure,
+			RenderSettingsGroup::AutoExposure);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetTonemapping(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptTonemappingSettings>(thisPtr, value, &RenderSettings::tonemapping,
+			RenderSettingsGroup::Tonemapping);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetWhiteBalance(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptWhiteBalanceSettings>(thisPtr, value, &RenderSettings::whiteBalance,
+			RenderSettingsGroup::WhiteBalance);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetColorGrading(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptColorGradingSettings>(thisPtr, value, &RenderSettings::colorGrading,
+			RenderSettingsGroup::ColorGrading);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetDepthOfField(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptDepthOfFieldSettings>(thisPtr, value, &RenderSettings::depthOfField,
+			RenderSettingsGroup::DepthOfField);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetAmbientOcclusion(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptAmbientOcclusionSettings>(thisPtr, value, &RenderSettings::ambientOcclusion,
+			RenderSettingsGroup::AmbientOcclusion);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetScreenSpaceReflections(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptScreenSpaceReflectionsSettings>(thisPtr, value, &RenderSettings::screenSpaceReflections,
+			RenderSettingsGroup::ScreenSpaceReflections);
+	}
+
+	void ScriptCameraRenderSettings::internal_SetShadowSettings(ScriptCCamera* thisPtr, MonoObject* value)
+	{
+		setGroup<ScriptShadowSettings>(thisPtr, value, &RenderSettings::shadowSettings, RenderSettingsGroup::Shadows);
+	}
+
+	UINT32 ScriptCameraRenderSettings::internal_GetDirtyGroups(ScriptCCamera* thisPtr)
+	{
+		PendingSettings* entry = findPending(thisPtr);
+		return entry != nullptr ? entry->dirtyGroups : 0;
+	}
+
+	void ScriptCameraRenderSettings::internal_Apply(ScriptCCamera* thisPtr)
+	{
+		PendingSettings* entry = findPending(thisPtr);
+		if (entry == nullptr)
+			return;
+
+		applyPending(*entry);
+		sPending.erase(sPending.begin() + (entry - sPending.data()));
+	}
+}
\ No newline at end of file
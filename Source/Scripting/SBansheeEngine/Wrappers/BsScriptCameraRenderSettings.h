@@ -0,0 +1,126 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	class ScriptCCamera;
+	struct RenderSettings;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** Groups of RenderSettings that can be modified independently. Used as flags for tracking modified groups. */
+	enum class RenderSettingsGroup
+	{
+		General = 1 << 0, /**< Exposure scale, gamma and the feature toggles. */
+		AutoExposure = 1 << 1,
+		Tonemapping = 1 << 2,
+		WhiteBalance = 1 << 3,
+		ColorGrading = 1 << 4,
+		DepthOfField = 1 << 5,
+		AmbientOcclusion = 1 << 6,
+		ScreenSpaceReflections = 1 << 7,
+		Shadows = 1 << 8
+	};
+
+	/** Boolean toggles in RenderSettings that can be set through ScriptCameraRenderSettings. */
+	enum class RenderFeature
+	{
+		AutoExposure,
+		Tonemapping,
+		FXAA,
+		HDR,
+		Lighting,
+		Shadows,
+		IndirectLighting,
+		Skybox,
+		OverlayOnly
+	};
+
+	/**
+	 * Interop class between C++ & CLR for CameraRenderSettings. Allows individual groups of a camera's render settings
+	 * to be modified without converting the entire RenderSettings object. Modifications are applied to a private copy
+	 * of the camera's settings, and are passed on to the camera once per frame, regardless of how many were made.
+	 * Only the modified groups are passed on, and if the camera's settings get replaced in the meantime (e.g. by
+	 * assigning Camera.RenderSettings) the newer assignment takes precedence over the pending modifications.
+	 */
+	class BS_SCR_BE_EXPORT ScriptCameraRenderSettings : public ScriptObject<ScriptCameraRenderSettings>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "CameraRenderSettings")
+
+		/** Applies render settings modified since the last call to their cameras. Must be called once per frame. */
+		static void update();
+
+		/** Initializes the pending settings tracking. Must be called before use. */
+		static void startUp();
+
+		/** Discards any pending settings and cleans up. */
+		static void shutDown();
+
+	private:
+		/** Render settings of a single camera, with modifications not yet applied to the camera. */
+		struct PendingSettings
+		{
+			GameObjectHandle<CCamera> camera;
+			SPtr<RenderSettings> base; /**< Settings object assigned to the camera when the modifications started. */
+			SPtr<RenderSettings> settings;
+			UINT32 dirtyGroups;
+		};
+
+		ScriptCameraRenderSettings(MonoObject* instance);
+
+		/**
+		 * Returns the settings to modify for the provided camera and marks the specified group as dirty. On the first
+		 * modification since the settings were last applied, the camera's current settings are copied, so the object
+		 * shared with the camera (and any scripts referencing it) isn't modified until the settings are applied. If the
+		 * camera's settings were replaced since the modifications started, the earlier modifications are discarded.
+		 * Returns null if the camera has been destroyed.
+		 */
+		static RenderSettings* beginEdit(ScriptCCamera* thisPtr, RenderSettingsGroup group);
+
+		/** Returns the entry for the provided camera, or null if the camera has no modified settings. */
+		static PendingSettings* findPending(ScriptCCamera* thisPtr);
+
+		/**
+		 * Passes the modified groups of the provided entry on to its camera. Does nothing if the camera's settings were
+		 * replaced after the modifications were made.
+		 */
+		static void applyPending(const PendingSettings& entry);
+
+		/** Triggered when assembly refresh starts. */
+		static void onRefreshStarted();
+
+		/** Copies the settings from a managed settings object into a member of RenderSettings. */
+		template<class ScriptType, class Type>
+		static void setGroup(ScriptCCamera* thisPtr, MonoObject* value, Type RenderSettings::* member,
+			RenderSettingsGroup group);
+
+		static Vector<PendingSettings> sPending;
+		static HEvent sRefreshStartedConn;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_SetExposureScale(ScriptCCamera* thisPtr, float value);
+		static void internal_SetGamma(ScriptCCamera* thisPtr, float value);
+		static void internal_SetFeatureEnabled(ScriptCCamera* thisPtr, RenderFeature feature, bool enabled);
+		static void internal_SetAutoExposure(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetTonemapping(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetWhiteBalance(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetColorGrading(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetDepthOfField(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetAmbientOcclusion(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetScreenSpaceReflections(ScriptCCamera* thisPtr, MonoObject* value);
+		static void internal_SetShadowSettings(ScriptCCamera* thisPtr, MonoObject* value);
+		static UINT32 internal_GetDirtyGroups(ScriptCCamera* thisPtr);
+		static void internal_Apply(ScriptCCamera* thisPtr);
+	};
+
+	/** @} */
+}
\ No newline at end of file
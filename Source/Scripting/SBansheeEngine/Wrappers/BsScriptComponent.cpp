@@ -91,6 +91,8 @@ namespace bs
 			ScriptComponentBase* scriptComponent = 
 				ScriptGameObjectManager::instance().createBuiltinScriptComponent(component);
 
+			ScriptGameObjectManager::instance().onHierarchyModified();
+
 			return scriptComponent->getManagedInstance();
 		}
 	}
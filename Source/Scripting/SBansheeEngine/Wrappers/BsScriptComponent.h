@@ -34,6 +34,9 @@ namespace bs
 
 		/** Checks if the provided game object is destroyed and logs a warning if it is. */
 		static bool checkIfDestroyed(const GameObjectHandleBase& handle);
+
+		/** Time at which the interop object was last requested from the script game object manager, in seconds. */
+		float mLastAccessTime = 0.0f;
 	};
 
 	/**	Base class for a specific builtin component's interop object. */
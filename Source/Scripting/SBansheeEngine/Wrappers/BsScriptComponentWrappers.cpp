@@ -0,0 +1,65 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptComponentWrappers.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+#include "BsScriptGameObjectManager.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+
+namespace bs
+{
+	ScriptComponentWrappers::ScriptComponentWrappers(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptComponentWrappers::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_GetIdleReleaseTime",
+			(void*)&ScriptComponentWrappers::internal_GetIdleReleaseTime);
+		metaData.scriptClass->addInternalCall("Internal_SetIdleReleaseTime",
+			(void*)&ScriptComponentWrappers::internal_SetIdleReleaseTime);
+		metaData.scriptClass->addInternalCall("Internal_GetStats", (void*)&ScriptComponentWrappers::internal_GetStats);
+	}
+
+	float ScriptComponentWrappers::internal_GetIdleReleaseTime()
+	{
+		return ScriptGameObjectManager::instance().getBuiltinComponentIdleTime();
+	}
+
+	void ScriptComponentWrappers::internal_SetIdleReleaseTime(float seconds)
+	{
+		ScriptGameObjectManager::instance().setBuiltinComponentIdleTime(std::max(seconds, 0.0f));
+	}
+
+	void ScriptComponentWrappers::internal_GetStats(MonoArray** typeNames, MonoArray** numReferenced,
+		MonoArray** numIdle)
+	{
+		Vector<ScriptGameObjectManager::BuiltinComponentWrapperStats> stats =
+			ScriptGameObjectManager::instance().getBuiltinComponentWrapperStats();
+
+		UINT32 numTypes = (UINT32)stats.size();
+
+		ScriptArray outputTypeNames = ScriptArray::create<String>(numTypes);
+		ScriptArray outputNumReferenced = ScriptArray::create<UINT32>(numTypes);
+		ScriptArray outputNumIdle = ScriptArray::create<UINT32>(numTypes);
+
+		for (UINT32 i = 0; i < numTypes; i++)
+		{
+			String typeName;
+
+			BuiltinComponentInfo* info = ScriptAssemblyManager::instance().getBuiltinComponentInfo(stats[i].typeId);
+			if (info != nullptr)
+				typeName = info->monoClass->getFullName();
+
+			outputTypeNames.set(i, MonoUtil::stringToMono(typeName));
+			outputNumReferenced.set(i, stats[i].numReferenced);
+			outputNumIdle.set(i, stats[i].numIdle);
+		}
+
+		MonoUtil::referenceCopy(typeNames, (MonoObject*)outputTypeNames.getInternal());
+		MonoUtil::referenceCopy(numReferenced, (MonoObject*)outputNumReferenced.getInternal());
+		MonoUtil::referenceCopy(numIdle, (MonoObject*)outputNumIdle.getInternal());
+	}
+}
\ No newline at end of file
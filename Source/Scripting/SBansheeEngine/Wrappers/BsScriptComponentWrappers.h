@@ -0,0 +1,35 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for ComponentWrappers. Controls the lifetime of managed objects wrapping built-in
+	 * components, and reports how many of them exist.
+	 */
+	class BS_SCR_BE_EXPORT ScriptComponentWrappers : public ScriptObject<ScriptComponentWrappers>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "ComponentWrappers")
+
+	private:
+		ScriptComponentWrappers(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static float internal_GetIdleReleaseTime();
+		static void internal_SetIdleReleaseTime(float seconds);
+		static void internal_GetStats(MonoArray** typeNames, MonoArray** numReferenced, MonoArray** numIdle);
+	};
+
+	/** @} */
+}
\ No newline at end of file
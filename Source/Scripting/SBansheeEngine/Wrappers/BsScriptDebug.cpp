@@ -7,19 +7,149 @@
 #include "BsMonoUtil.h"
 #include "Debug/BsDebug.h"
 #include "Wrappers/BsScriptLogEntry.h"
+#include <atomic>
+#include <limits>
 
 namespace bs
 {
 	HEvent ScriptDebug::mOnLogEntryAddedConn;
-	ScriptDebug::OnAddedThunkDef ScriptDebug::onAddedThunk = nullptr;
+	ScriptDebug::OnEntriesAddedThunkDef ScriptDebug::onEntriesAddedThunk = nullptr;
 
 	/**	C++ version of the managed LogEntry structure. */
 	struct ScriptLogEntryData
 	{
 		UINT32 type;
 		MonoString* message;
+		UINT64 sequence;
 	};
 
+	/** Log entry as stored in the script-visible log. */
+	struct ScriptLogRecord
+	{
+		UINT64 sequence;
+		UINT32 channel;
+		String message;
+	};
+
+	/**
+	 * Bounded lock-free queue of log entries, written to by any thread that logs a message and read from the main thread
+	 * once per frame. Each entry is assigned a sequence number in the order it was queued. Entries are dropped if the
+	 * queue is full, in which case they remain available in the native log only.
+	 */
+	class ScriptLogQueue
+	{
+		static const UINT32 CAPACITY = 4096; // Must be a power of two
+		static const UINT32 MASK = CAPACITY - 1;
+
+		/** Slot in the queue. @p sequence determines whether the slot is free for writing, or has been written to. */
+		struct Slot
+		{
+			std::atomic<UINT64> sequence;
+			UINT32 channel;
+			String message;
+		};
+
+	public:
+		ScriptLogQueue()
+		{
+			for (UINT32 i = 0; i < CAPACITY; i++)
+				mSlots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		/** Queues a new entry. Returns false if the queue is full. Safe to call from multiple threads at once. */
+		bool push(UINT32 channel, const String& message)
+		{
+			UINT64 writePos = mWritePos.load(std::memory_order_relaxed);
+			Slot* slot;
+			while (true)
+			{
+				slot = &mSlots[writePos & MASK];
+				UINT64 slotSequence = slot->sequence.load(std::memory_order_acquire);
+
+				INT64 diff = (INT64)slotSequence - (INT64)writePos;
+				if (diff == 0)
+				{
+					if (mWritePos.compare_exchange_weak(writePos, writePos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					mNumDropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				else
+					writePos = mWritePos.load(std::memory_order_relaxed);
+			}
+
+			slot->channel = channel;
+			slot->message = message;
+			slot->sequence.store(writePos + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Removes the oldest entry from the queue. Returns false if the queue is empty. Must only be called from a single
+		 * thread.
+		 */
+		bool pop(ScriptLogRecord& output)
+		{
+			Slot& slot = mSlots[mReadPos & MASK];
+			if (slot.sequence.load(std::memory_order_acquire) != mReadPos + 1)
+				return false;
+
+			output.sequence = mReadPos;
+			output.channel = slot.channel;
+			output.message = std::move(slot.message);
+			slot.message.clear();
+
+			slot.sequence.store(mReadPos + CAPACITY, std::memory_order_release);
+			mReadPos++;
+
+			return true;
+		}
+
+		/** Returns the number of entries dropped since the last call, and resets the counter. */
+		UINT32 resetNumDropped()
+		{
+			return mNumDropped.exchange(0, std::memory_order_relaxed);
+		}
+
+	private:
+		Slot mSlots[CAPACITY];
+		std::atomic<UINT64> mWritePos { 0 };
+		std::atomic<UINT32> mNumDropped { 0 };
+		UINT64 mReadPos = 0;
+	};
+
+	/** Queue the log entries are posted to from the logging threads. */
+	static ScriptLogQueue gLogQueue;
+
+	/**
+	 * Maximum number of most recent log entries visible to scripts. Older entries remain available in the native log
+	 * only. The script-visible log is allowed to grow by MAX_LOG_RECORDS_SLACK entries before it is trimmed, so entries
+	 * don't need to be removed from its front on every flush.
+	 */
+	static const UINT32 MAX_LOG_RECORDS = 10000;
+	static const UINT32 MAX_LOG_RECORDS_SLACK = 2500;
+
+	/**
+	 * Log entries visible to scripts, sorted by sequence. Only accessed from the main thread. Queue sequence numbers are
+	 * offset by the number of entries present in the log on start-up.
+	 */
+	static Vector<ScriptLogRecord> gLogRecords;
+	static UINT64 gSequenceOffset = 0;
+
+	/** First sequence number managed code hasn't been notified about yet. */
+	static UINT64 gNotifiedSequence = 0;
+
+	/** Finds the first record whose sequence number is equal to or larger than @p sequence. */
+	static Vector<ScriptLogRecord>::iterator findLogRecord(UINT64 sequence)
+	{
+		return std::lower_bound(gLogRecords.begin(), gLogRecords.end(), sequence,
+			[](const ScriptLogRecord& record, UINT64 value) { return record.sequence < value; });
+	}
+
 	ScriptDebug::ScriptDebug(MonoObject* instance)
 		:ScriptObject(instance)
 	{ }
@@ -33,25 +163,84 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptDebug::internal_clear);
 		metaData.scriptClass->addInternalCall("Internal_ClearType", (void*)&ScriptDebug::internal_clearType);
 		metaData.scriptClass->addInternalCall("Internal_GetMessages", (void*)&ScriptDebug::internal_getMessages);
+		metaData.scriptClass->addInternalCall("Internal_GetEntries", (void*)&ScriptDebug::internal_getEntries);
+		metaData.scriptClass->addInternalCall("Internal_GetMessage", (void*)&ScriptDebug::internal_getMessage);
+		metaData.scriptClass->addInternalCall("Internal_GetFirstSequence", (void*)&ScriptDebug::internal_getFirstSequence);
 
-		onAddedThunk = (OnAddedThunkDef)metaData.scriptClass->getMethod("Internal_OnAdded", 2)->getThunk();
+		onEntriesAddedThunk = (OnEntriesAddedThunkDef)metaData.scriptClass->getMethod("Internal_OnEntriesAdded", 2)->getThunk();
 	}
 
 	void ScriptDebug::startUp()
 	{
+		Vector<LogEntry> entries = gDebug().getLog().getEntries();
+
+		UINT32 numEntries = (UINT32)entries.size();
+		UINT32 firstEntry = numEntries > MAX_LOG_RECORDS ? numEntries - MAX_LOG_RECORDS : 0;
+
+		gLogRecords.clear();
+		gLogRecords.reserve(numEntries - firstEntry);
+		for (UINT32 i = firstEntry; i < numEntries; i++)
+			gLogRecords.push_back({ i, entries[i].getChannel(), entries[i].getMessage() });
+
+		gSequenceOffset = numEntries;
+		gNotifiedSequence = numEntries;
+
 		mOnLogEntryAddedConn = gDebug().onLogEntryAdded.connect(&ScriptDebug::onLogEntryAdded);
 	}
 
 	void ScriptDebug::shutDown()
 	{
 		mOnLogEntryAddedConn.disconnect();
+
+		flushQueuedEntries();
+		gLogRecords.clear();
+	}
+
+	void ScriptDebug::update()
+	{
+		flushQueuedEntries();
+
+		UINT32 numDropped = gLogQueue.resetNumDropped();
+		if (numDropped > 0)
+		{
+			// Logged normally, so it ends up in the queue for the next frame
+			LOGWRN(toString(numDropped) + " log message(s) were not forwarded to scripts because too many messages were "
+				"logged in a single frame. They are still present in the engine log.");
+		}
+
+		// The log might have been cleared from native code, in which case the script-visible entries are stale
+		LogEntry lastEntry;
+		if (!gLogRecords.empty() && !gDebug().getLog().getLastEntry(lastEntry))
+			gLogRecords.clear();
+
+		if (gLogRecords.empty() || gLogRecords.back().sequence < gNotifiedSequence)
+			return;
+
+		// Only report entries flushed so far, entries flushed while managed code runs are reported on the next update
+		UINT64 firstSequence = gNotifiedSequence;
+		UINT64 endSequence = gLogRecords.back().sequence + 1;
+		gNotifiedSequence = endSequence;
+
+		if (onEntriesAddedThunk != nullptr)
+			MonoUtil::invokeThunk(onEntriesAddedThunk, firstSequence, endSequence);
 	}
 
 	void ScriptDebug::onLogEntryAdded(const LogEntry& entry)
 	{
-		MonoString* message = MonoUtil::stringToMono(entry.getMessage());
+		gLogQueue.push(entry.getChannel(), entry.getMessage());
+	}
 
-		MonoUtil::invokeThunk(onAddedThunk, entry.getChannel(), message);
+	void ScriptDebug::flushQueuedEntries()
+	{
+		ScriptLogRecord record;
+		while (gLogQueue.pop(record))
+		{
+			record.sequence += gSequenceOffset;
+			gLogRecords.push_back(std::move(record));
+		}
+
+		if (gLogRecords.size() > (MAX_LOG_RECORDS + MAX_LOG_RECORDS_SLACK))
+			gLogRecords.erase(gLogRecords.begin(), gLogRecords.end() - MAX_LOG_RECORDS);
 	}
 
 	void ScriptDebug::internal_log(MonoString* message)
@@ -77,27 +266,67 @@ namespace bs
 	void ScriptDebug::internal_clear()
 	{
 		gDebug().getLog().clear();
+
+		flushQueuedEntries();
+		gLogRecords.clear();
 	}
 
 	void ScriptDebug::internal_clearType(UINT32 type)
 	{
 		gDebug().getLog().clear(type);
+
+		flushQueuedEntries();
+		gLogRecords.erase(std::remove_if(gLogRecords.begin(), gLogRecords.end(),
+			[type](const ScriptLogRecord& record) { return record.channel == type; }), gLogRecords.end());
 	}
 
 	MonoArray* ScriptDebug::internal_getMessages()
 	{
-		Vector<LogEntry> entries = gDebug().getLog().getEntries();
+		return internal_getEntries(0, std::numeric_limits<UINT64>::max(), true);
+	}
+
+	MonoArray* ScriptDebug::internal_getEntries(UINT64 fromSequence, UINT64 toSequence, bool includeMessages)
+	{
+		flushQueuedEntries();
+
+		auto iterFirst = findLogRecord(fromSequence);
+		auto iterEnd = findLogRecord(toSequence);
+		UINT32 numEntries = iterEnd > iterFirst ? (UINT32)(iterEnd - iterFirst) : 0;
 
-		UINT32 numEntries = (UINT32)entries.size();
 		ScriptArray output = ScriptArray::create<ScriptLogEntry>(numEntries);
 		for (UINT32 i = 0; i < numEntries; i++)
 		{
-			MonoString* message = MonoUtil::stringToMono(entries[i].getMessage());
+			const ScriptLogRecord& record = *(iterFirst + i);
 
-			ScriptLogEntryData scriptEntry = { entries[i].getChannel(), message };
+			MonoString* message = nullptr;
+			if (includeMessages)
+				message = MonoUtil::stringToMono(record.message);
+
+			ScriptLogEntryData scriptEntry = { record.channel, message, record.sequence };
 			output.set(i, scriptEntry);
 		}
 
 		return output.getInternal();
 	}
+
+	MonoString* ScriptDebug::internal_getMessage(UINT64 sequence)
+	{
+		flushQueuedEntries();
+
+		auto iterFind = findLogRecord(sequence);
+		if (iterFind == gLogRecords.end() || iterFind->sequence != sequence)
+			return nullptr;
+
+		return MonoUtil::stringToMono(iterFind->message);
+	}
+
+	UINT64 ScriptDebug::internal_getFirstSequence()
+	{
+		flushQueuedEntries();
+
+		if (gLogRecords.empty())
+			return std::numeric_limits<UINT64>::max();
+
+		return gLogRecords.front().sequence;
+	}
 }
\ No newline at end of file
@@ -22,12 +22,25 @@ namespace bs
 
 		/**	Unregisters internal callbacks. Must be called on scripting system shutdown. */
 		static void shutDown();
+
+		/**
+		 * Moves log entries queued since the last call into the script-visible log and notifies managed code about them.
+		 * Only the most recent entries are kept in the script-visible log. Must be called once per frame from the main
+		 * thread.
+		 */
+		static void update();
 	private:
 		ScriptDebug(MonoObject* instance);
 
-		/**	Triggered when a new entry is added to the debug log. */
+		/**
+		 * Triggered when a new entry is added to the debug log. Can be called from any thread. Entries are only queued,
+		 * and are forwarded to managed code on the next call to update().
+		 */
 		static void onLogEntryAdded(const LogEntry& entry);
 
+		/** Moves all queued log entries into the script-visible log, without notifying managed code. */
+		static void flushQueuedEntries();
+
 		static HEvent mOnLogEntryAddedConn;
 
 		/************************************************************************/
@@ -40,10 +53,13 @@ namespace bs
 		static void internal_clear();
 		static void internal_clearType(UINT32 type);
 		static MonoArray* internal_getMessages();
+		static MonoArray* internal_getEntries(UINT64 fromSequence, UINT64 toSequence, bool includeMessages);
+		static MonoString* internal_getMessage(UINT64 sequence);
+		static UINT64 internal_getFirstSequence();
 
-		typedef void(BS_THUNKCALL *OnAddedThunkDef) (UINT32, MonoString*, MonoException**);
+		typedef void(BS_THUNKCALL *OnEntriesAddedThunkDef) (UINT64, UINT64, MonoException**);
 
-		static OnAddedThunkDef onAddedThunk;
+		static OnEntriesAddedThunkDef onEntriesAddedThunk;
 	};
 
 	/** @} */
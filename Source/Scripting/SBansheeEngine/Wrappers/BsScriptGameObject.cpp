@@ -27,6 +27,7 @@ namespace bs
 		BS_ASSERT(mGCHandle == 0 && "Attempting to set a new managed instance without freeing the old one.");
 
 		mGCHandle = MonoUtil::newGCHandle(instance, false);
+		mIsReferenceWeak = false;
 	}
 
 	void ScriptGameObjectBase::freeManagedInstance()
@@ -36,6 +37,37 @@ namespace bs
 			MonoUtil::freeGCHandle(mGCHandle);
 			mGCHandle = 0;
 		}
+
+		mIsReferenceWeak = false;
+	}
+
+	void ScriptGameObjectBase::_weakenManagedReference()
+	{
+		if (mGCHandle == 0 || mIsReferenceWeak)
+			return;
+
+		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoUtil::freeGCHandle(mGCHandle);
+
+		mGCHandle = MonoUtil::newWeakGCHandle(instance);
+		mIsReferenceWeak = true;
+	}
+
+	bool ScriptGameObjectBase::_strengthenManagedReference()
+	{
+		if (!mIsReferenceWeak)
+			return true;
+
+		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		if (instance == nullptr)
+			return false;
+
+		MonoUtil::freeGCHandle(mGCHandle);
+
+		mGCHandle = MonoUtil::newGCHandle(instance, false);
+		mIsReferenceWeak = false;
+
+		return true;
 	}
 
 	ScriptGameObject::ScriptGameObject(MonoObject* instance)
@@ -24,9 +24,28 @@ namespace bs
 		/**	Sets the internal native GameObject handle. */
 		virtual void setNativeHandle(const HGameObject& gameObject) = 0;
 
-		/** Returns the managed version of this game object. */
+		/**
+		 * Returns the managed version of this game object. Can return null if the reference to the managed instance was
+		 * weakened by _weakenManagedReference() and the instance has since been collected.
+		 */
 		MonoObject* getManagedInstance() const;
 
+		/**
+		 * Replaces the strong reference to the managed instance with a weak one, allowing the managed instance to be
+		 * collected once no managed code references it anymore.
+		 */
+		void _weakenManagedReference();
+
+		/**
+		 * Restores a strong reference to the managed instance after a call to _weakenManagedReference(). Returns false
+		 * if the managed instance has already been collected, in which case the interop object is about to be
+		 * destroyed.
+		 */
+		bool _strengthenManagedReference();
+
+		/** Checks if the managed instance is only referenced weakly. See _weakenManagedReference(). */
+		bool _isManagedReferenceWeak() const { return mIsReferenceWeak; }
+
 	protected:
 		/** 
 		 * Makes the object reference the specific managed instance. Internally this allocates a GC handle that keeps a
@@ -44,6 +63,7 @@ namespace bs
 		void freeManagedInstance();
 
 		UINT32 mGCHandle;
+		bool mIsReferenceWeak = false;
 	};
 
 	/**	Interop class between C++ & CLR for GameObject. */
@@ -32,6 +32,8 @@ namespace bs
 	void ScriptManagedComponent::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_Invoke", (void*)&ScriptManagedComponent::internal_invoke);
+		metaData.scriptClass->addInternalCall("Internal_GetModificationCount", (void*)&ScriptManagedComponent::internal_getModificationCount);
+		metaData.scriptClass->addInternalCall("Internal_NotifyModified", (void*)&ScriptManagedComponent::internal_notifyModified);
 	}
 
 	void ScriptManagedComponent::internal_invoke(ScriptManagedComponent* nativeInstance, MonoString* name)
@@ -70,6 +72,23 @@ namespace bs
 		}
 	}
 
+	UINT32 ScriptManagedComponent::internal_getModificationCount(ScriptManagedComponent* nativeInstance)
+	{
+		// Polled by the inspector every frame, so don't warn about destroyed components
+		if (nativeInstance->mComponent.isDestroyed())
+			return 0;
+
+		return nativeInstance->mComponent->getModificationCount();
+	}
+
+	void ScriptManagedComponent::internal_notifyModified(ScriptManagedComponent* nativeInstance)
+	{
+		if (nativeInstance->mComponent.isDestroyed())
+			return;
+
+		nativeInstance->mComponent->_markModified();
+	}
+
 	MonoObject* ScriptManagedComponent::_createManagedInstance(bool construct)
 	{
 		SPtr<ManagedSerializableObjectInfo> currentObjInfo = nullptr;
@@ -60,6 +60,8 @@ namespace bs
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
 		static void internal_invoke(ScriptManagedComponent* nativeInstance, MonoString* name);
+		static UINT32 internal_getModificationCount(ScriptManagedComponent* nativeInstance);
+		static void internal_notifyModified(ScriptManagedComponent* nativeInstance);
 	};
 
 	/** @} */
@@ -0,0 +1,219 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptMaterialParam.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+#include "BsScriptResourceManager.h"
+#include "Wrappers/BsScriptRRefBase.h"
+#include "Material/BsMaterial.h"
+#include "Image/BsTexture.h"
+
+#include "BsScriptMaterial.generated.h"
+
+namespace bs
+{
+	ScriptMaterialParam::ScriptMaterialParam(MonoObject* instance, const HMaterial& material, const String& name,
+		ScriptMaterialParamType type)
+		:ScriptObject(instance), mType(type)
+	{
+		if (!material.isLoaded(false))
+			return;
+
+		switch(type)
+		{
+		case ScriptMaterialParamType::Float: mFloat = material->getParamFloat(name); break;
+		case ScriptMaterialParamType::Color: mColor = material->getParamColor(name); break;
+		case ScriptMaterialParamType::Vec2: mVec2 = material->getParamVec2(name); break;
+		case ScriptMaterialParamType::Vec3: mVec3 = material->getParamVec3(name); break;
+		case ScriptMaterialParamType::Vec4: mVec4 = material->getParamVec4(name); break;
+		case ScriptMaterialParamType::Mat3: mMat3 = material->getParamMat3(name); break;
+		case ScriptMaterialParamType::Mat4: mMat4 = material->getParamMat4(name); break;
+		case ScriptMaterialParamType::Texture: mTexture = material->getParamTexture(name); break;
+		}
+	}
+
+	void ScriptMaterialParam::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptMaterialParam::internal_Create);
+		metaData.scriptClass->addInternalCall("Internal_SetFloat", (void*)&ScriptMaterialParam::internal_SetFloat);
+		metaData.scriptClass->addInternalCall("Internal_GetFloat", (void*)&ScriptMaterialParam::internal_GetFloat);
+		metaData.scriptClass->addInternalCall("Internal_SetColor", (void*)&ScriptMaterialParam::internal_SetColor);
+		metaData.scriptClass->addInternalCall("Internal_GetColor", (void*)&ScriptMaterialParam::internal_GetColor);
+		metaData.scriptClass->addInternalCall("Internal_SetVec2", (void*)&ScriptMaterialParam::internal_SetVec2);
+		metaData.scriptClass->addInternalCall("Internal_GetVec2", (void*)&ScriptMaterialParam::internal_GetVec2);
+		metaData.scriptClass->addInternalCall("Internal_SetVec3", (void*)&ScriptMaterialParam::internal_SetVec3);
+		metaData.scriptClass->addInternalCall("Internal_GetVec3", (void*)&ScriptMaterialParam::internal_GetVec3);
+		metaData.scriptClass->addInternalCall("Internal_SetVec4", (void*)&ScriptMaterialParam::internal_SetVec4);
+		metaData.scriptClass->addInternalCall("Internal_GetVec4", (void*)&ScriptMaterialParam::internal_GetVec4);
+		metaData.scriptClass->addInternalCall("Internal_SetMat3", (void*)&ScriptMaterialParam::internal_SetMat3);
+		metaData.scriptClass->addInternalCall("Internal_GetMat3", (void*)&ScriptMaterialParam::internal_GetMat3);
+		metaData.scriptClass->addInternalCall("Internal_SetMat4", (void*)&ScriptMaterialParam::internal_SetMat4);
+		metaData.scriptClass->addInternalCall("Internal_GetMat4", (void*)&ScriptMaterialParam::internal_GetMat4);
+		metaData.scriptClass->addInternalCall("Internal_SetTexture", (void*)&ScriptMaterialParam::internal_SetTexture);
+		metaData.scriptClass->addInternalCall("Internal_GetTexture", (void*)&ScriptMaterialParam::internal_GetTexture);
+		metaData.scriptClass->addInternalCall("Internal_SetFloats", (void*)&ScriptMaterialParam::internal_SetFloats);
+		metaData.scriptClass->addInternalCall("Internal_SetColors", (void*)&ScriptMaterialParam::internal_SetColors);
+		metaData.scriptClass->addInternalCall("Internal_SetVec2s", (void*)&ScriptMaterialParam::internal_SetVec2s);
+		metaData.scriptClass->addInternalCall("Internal_SetVec3s", (void*)&ScriptMaterialParam::internal_SetVec3s);
+		metaData.scriptClass->addInternalCall("Internal_SetVec4s", (void*)&ScriptMaterialParam::internal_SetVec4s);
+		metaData.scriptClass->addInternalCall("Internal_SetMat3s", (void*)&ScriptMaterialParam::internal_SetMat3s);
+		metaData.scriptClass->addInternalCall("Internal_SetMat4s", (void*)&ScriptMaterialParam::internal_SetMat4s);
+	}
+
+	template<class T, class P>
+	void ScriptMaterialParam::setValues(MonoArray* params, MonoArray* values, ScriptMaterialParamType type,
+		P ScriptMaterialParam::* param)
+	{
+		if (params == nullptr || values == nullptr)
+			return;
+
+		ScriptArray paramsArray(params);
+		ScriptArray valuesArray(values);
+
+		UINT32 numValues = std::min(paramsArray.size(), valuesArray.size());
+		for (UINT32 i = 0; i < numValues; i++)
+		{
+			ScriptMaterialParam* scriptParam = ScriptMaterialParam::toNative(paramsArray.get<MonoObject*>(i));
+			if (scriptParam == nullptr || scriptParam->mType != type)
+				continue;
+
+			(scriptParam->*param).set(valuesArray.get<T>(i));
+		}
+	}
+
+	void ScriptMaterialParam::internal_Create(MonoObject* instance, ScriptMaterial* material, MonoString* name,
+		ScriptMaterialParamType type)
+	{
+		String nativeName = MonoUtil::monoToString(name);
+		new (bs_alloc<ScriptMaterialParam>()) ScriptMaterialParam(instance, material->getHandle(), nativeName, type);
+	}
+
+	void ScriptMaterialParam::internal_SetFloat(ScriptMaterialParam* thisPtr, float value, UINT32 arrayIdx)
+	{
+		thisPtr->mFloat.set(value, arrayIdx);
+	}
+
+	float ScriptMaterialParam::internal_GetFloat(ScriptMaterialParam* thisPtr, UINT32 arrayIdx)
+	{
+		return thisPtr->mFloat.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetColor(ScriptMaterialParam* thisPtr, Color* value, UINT32 arrayIdx)
+	{
+		thisPtr->mColor.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetColor(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Color* output)
+	{
+		*output = thisPtr->mColor.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetVec2(ScriptMaterialParam* thisPtr, Vector2* value, UINT32 arrayIdx)
+	{
+		thisPtr->mVec2.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetVec2(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector2* output)
+	{
+		*output = thisPtr->mVec2.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetVec3(ScriptMaterialParam* thisPtr, Vector3* value, UINT32 arrayIdx)
+	{
+		thisPtr->mVec3.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetVec3(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector3* output)
+	{
+		*output = thisPtr->mVec3.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetVec4(ScriptMaterialParam* thisPtr, Vector4* value, UINT32 arrayIdx)
+	{
+		thisPtr->mVec4.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetVec4(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector4* output)
+	{
+		*output = thisPtr->mVec4.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetMat3(ScriptMaterialParam* thisPtr, Matrix3* value, UINT32 arrayIdx)
+	{
+		thisPtr->mMat3.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetMat3(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Matrix3* output)
+	{
+		*output = thisPtr->mMat3.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetMat4(ScriptMaterialParam* thisPtr, Matrix4* value, UINT32 arrayIdx)
+	{
+		thisPtr->mMat4.set(*value, arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_GetMat4(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Matrix4* output)
+	{
+		*output = thisPtr->mMat4.get(arrayIdx);
+	}
+
+	void ScriptMaterialParam::internal_SetTexture(ScriptMaterialParam* thisPtr, MonoObject* value)
+	{
+		HTexture texture;
+
+		ScriptRRefBase* scriptTexture = ScriptRRefBase::toNative(value);
+		if (scriptTexture != nullptr)
+			texture = static_resource_cast<Texture>(scriptTexture->getHandle());
+
+		thisPtr->mTexture.set(texture);
+	}
+
+	MonoObject* ScriptMaterialParam::internal_GetTexture(ScriptMaterialParam* thisPtr)
+	{
+		HTexture texture = thisPtr->mTexture.get();
+
+		ScriptRRefBase* scriptTexture = ScriptResourceManager::instance().getScriptRRef(texture);
+		if (scriptTexture == nullptr)
+			return nullptr;
+
+		return scriptTexture->getManagedInstance();
+	}
+
+	void ScriptMaterialParam::internal_SetFloats(MonoArray* params, MonoArray* values)
+	{
+		setValues<float>(params, values, ScriptMaterialParamType::Float, &ScriptMaterialParam::mFloat);
+	}
+
+	void ScriptMaterialParam::internal_SetColors(MonoArray* params, MonoArray* values)
+	{
+		setValues<Color>(params, values, ScriptMaterialParamType::Color, &ScriptMaterialParam::mColor);
+	}
+
+	void ScriptMaterialParam::internal_SetVec2s(MonoArray* params, MonoArray* values)
+	{
+		setValues<Vector2>(params, values, ScriptMaterialParamType::Vec2, &ScriptMaterialParam::mVec2);
+	}
+
+	void ScriptMaterialParam::internal_SetVec3s(MonoArray* params, MonoArray* values)
+	{
+		setValues<Vector3>(params, values, ScriptMaterialParamType::Vec3, &ScriptMaterialParam::mVec3);
+	}
+
+	void ScriptMaterialParam::internal_SetVec4s(MonoArray* params, MonoArray* values)
+	{
+		setValues<Vector4>(params, values, ScriptMaterialParamType::Vec4, &ScriptMaterialParam::mVec4);
+	}
+
+	void ScriptMaterialParam::internal_SetMat3s(MonoArray* params, MonoArray* values)
+	{
+		setValues<Matrix3>(params, values, ScriptMaterialParamType::Mat3, &ScriptMaterialParam::mMat3);
+	}
+
+	void ScriptMaterialParam::internal_SetMat4s(MonoArray* params, MonoArray* values)
+	{
+		setValues<Matrix4>(params, values, ScriptMaterialParamType::Mat4, &ScriptMaterialParam::mMat4);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Material/BsMaterialParam.h"
+
+namespace bs
+{
+	class ScriptMaterial;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** Types of material parameters that can be accessed through ScriptMaterialParam. */
+	enum class ScriptMaterialParamType // Note: Must match C# enum MaterialParamType
+	{
+		Float, Color, Vec2, Vec3, Vec4, Mat3, Mat4, Texture
+	};
+
+	/**
+	 * Interop class between C++ & CLR for MaterialParam. Keeps a material parameter handle that is resolved once on
+	 * creation, allowing the parameter to be accessed afterwards without any string conversion or lookup.
+	 */
+	class BS_SCR_BE_EXPORT ScriptMaterialParam : public ScriptObject<ScriptMaterialParam>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "MaterialParam")
+
+	private:
+		ScriptMaterialParam(MonoObject* instance, const HMaterial& material, const String& name,
+			ScriptMaterialParamType type);
+
+		/**
+		 * Assigns values from @p values to parameter handles in @p params, at the same index. Handles that aren't of the
+		 * provided type are skipped.
+		 */
+		template<class T, class P>
+		static void setValues(MonoArray* params, MonoArray* values, ScriptMaterialParamType type,
+			P ScriptMaterialParam::* param);
+
+		ScriptMaterialParamType mType;
+
+		// Only the handle matching mType is resolved, others are left unassigned
+		MaterialParamFloat mFloat;
+		MaterialParamColor mColor;
+		MaterialParamVec2 mVec2;
+		MaterialParamVec3 mVec3;
+		MaterialParamVec4 mVec4;
+		MaterialParamMat3 mMat3;
+		MaterialParamMat4 mMat4;
+		MaterialParamTexture mTexture;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_Create(MonoObject* instance, ScriptMaterial* material, MonoString* name,
+			ScriptMaterialParamType type);
+
+		static void internal_SetFloat(ScriptMaterialParam* thisPtr, float value, UINT32 arrayIdx);
+		static float internal_GetFloat(ScriptMaterialParam* thisPtr, UINT32 arrayIdx);
+		static void internal_SetColor(ScriptMaterialParam* thisPtr, Color* value, UINT32 arrayIdx);
+		static void internal_GetColor(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Color* output);
+		static void internal_SetVec2(ScriptMaterialParam* thisPtr, Vector2* value, UINT32 arrayIdx);
+		static void internal_GetVec2(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector2* output);
+		static void internal_SetVec3(ScriptMaterialParam* thisPtr, Vector3* value, UINT32 arrayIdx);
+		static void internal_GetVec3(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector3* output);
+		static void internal_SetVec4(ScriptMaterialParam* thisPtr, Vector4* value, UINT32 arrayIdx);
+		static void internal_GetVec4(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Vector4* output);
+		static void internal_SetMat3(ScriptMaterialParam* thisPtr, Matrix3* value, UINT32 arrayIdx);
+		static void internal_GetMat3(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Matrix3* output);
+		static void internal_SetMat4(ScriptMaterialParam* thisPtr, Matrix4* value, UINT32 arrayIdx);
+		static void internal_GetMat4(ScriptMaterialParam* thisPtr, UINT32 arrayIdx, Matrix4* output);
+		static void internal_SetTexture(ScriptMaterialParam* thisPtr, MonoObject* value);
+		static MonoObject* internal_GetTexture(ScriptMaterialParam* thisPtr);
+
+		static void internal_SetFloats(MonoArray* params, MonoArray* values);
+		static void internal_SetColors(MonoArray* params, MonoArray* values);
+		static void internal_SetVec2s(MonoArray* params, MonoArray* values);
+		static void internal_SetVec3s(MonoArray* params, MonoArray* values);
+		static void internal_SetVec4s(MonoArray* params, MonoArray* values);
+		static void internal_SetMat3s(MonoArray* params, MonoArray* values);
+		static void internal_SetMat4s(MonoArray* params, MonoArray* values);
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,243 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptPhysicsQueryBatch.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "BsMonoUtil.h"
+#include "BsScriptGameObjectManager.h"
+#include "Wrappers/BsScriptComponent.h"
+#include "Physics/BsPhysics.h"
+#include "Components/BsCCollider.h"
+#include "Threading/BsTaskScheduler.h"
+
+#include "BsScriptPhysicsQueryHit.generated.h"
+
+namespace bs
+{
+	/**
+	 * Copies the first @p count elements of a managed array of blittable values into a native array. Returns false if
+	 * the managed array is null or smaller than @p count.
+	 */
+	template<class T>
+	static bool copyInputs(MonoArray* input, UINT32 count, Vector<T>& output)
+	{
+		if (input == nullptr)
+			return false;
+
+		ScriptArray inputArray(input);
+		if (inputArray.size() < count)
+			return false;
+
+		output.resize(count);
+		if (count > 0)
+			memcpy(output.data(), inputArray.getRaw(0, sizeof(T)), count * sizeof(T));
+
+		return true;
+	}
+
+	/**
+	 * Limits the number of queries to the number that fits in the provided result buffers. Returns zero if the buffers
+	 * are missing.
+	 */
+	static UINT32 clampToResults(UINT32 numQueries, MonoArray* results, MonoArray* counts, UINT32 maxResultsPerQuery)
+	{
+		if (results == nullptr || counts == nullptr || maxResultsPerQuery == 0)
+			return 0;
+
+		ScriptArray resultsArray(results);
+		ScriptArray countsArray(counts);
+
+		numQueries = std::min(numQueries, countsArray.size());
+		return std::min(numQueries, resultsArray.size() / maxResultsPerQuery);
+	}
+
+	ScriptPhysicsQueryBatch::ScriptPhysicsQueryBatch(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptPhysicsQueryBatch::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_RayCast", (void*)&ScriptPhysicsQueryBatch::internal_RayCast);
+		metaData.scriptClass->addInternalCall("Internal_SphereCast", (void*)&ScriptPhysicsQueryBatch::internal_SphereCast);
+		metaData.scriptClass->addInternalCall("Internal_SphereOverlap", (void*)&ScriptPhysicsQueryBatch::internal_SphereOverlap);
+		metaData.scriptClass->addInternalCall("Internal_BoxOverlap", (void*)&ScriptPhysicsQueryBatch::internal_BoxOverlap);
+	}
+
+	void ScriptPhysicsQueryBatch::execute(UINT32 numQueries, bool parallel, const std::function<void(UINT32)>& query)
+	{
+		// Queries cannot run concurrently with the simulation, and small batches aren't worth the task overhead
+		if (!parallel || numQueries <= QUERIES_PER_TASK || Physics::instance()._isUpdateInProgress())
+		{
+			for (UINT32 i = 0; i < numQueries; i++)
+				query(i);
+
+			return;
+		}
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 start = QUERIES_PER_TASK; start < numQueries; start += QUERIES_PER_TASK)
+		{
+			UINT32 end = std::min(start + QUERIES_PER_TASK, numQueries);
+			auto worker = [&query, start, end]()
+			{
+				for (UINT32 i = start; i < end; i++)
+					query(i);
+			};
+
+			SPtr<Task> task = Task::create("PhysicsQueryBatch", worker);
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		// Process the first range on this thread while the workers handle the rest
+		for (UINT32 i = 0; i < QUERIES_PER_TASK; i++)
+			query(i);
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	void ScriptPhysicsQueryBatch::writeHits(const Vector<Vector<PhysicsQueryHit>>& results, MonoArray* hits,
+		MonoArray* hitCounts, UINT32 maxHitsPerQuery)
+	{
+		ScriptArray hitsArray(hits);
+		ScriptArray hitCountsArray(hitCounts);
+
+		::MonoClass* hitClass = ScriptPhysicsQueryHit::getMetaData()->scriptClass->_getInternalClass();
+		UINT32 hitSize = hitsArray.elementSize();
+
+		for (UINT32 i = 0; i < (UINT32)results.size(); i++)
+		{
+			UINT32 numHits = std::min((UINT32)results[i].size(), maxHitsPerQuery);
+			for (UINT32 j = 0; j < numHits; j++)
+			{
+				// Hits reference managed colliders, so they must be copied with write barriers instead of a plain memcpy
+				__PhysicsQueryHitInterop interopHit = ScriptPhysicsQueryHit::toInterop(results[i][j]);
+				MonoUtil::valueCopy(hitsArray.getRaw(i * maxHitsPerQuery + j, hitSize), &interopHit, hitClass);
+			}
+
+			hitCountsArray.set(i, (INT32)numHits);
+		}
+	}
+
+	void ScriptPhysicsQueryBatch::writeColliders(const Vector<Vector<HCollider>>& results, MonoArray* colliders,
+		MonoArray* counts, UINT32 maxCollidersPerQuery)
+	{
+		ScriptArray collidersArray(colliders);
+		ScriptArray countsArray(counts);
+
+		for (UINT32 i = 0; i < (UINT32)results.size(); i++)
+		{
+			UINT32 numColliders = std::min((UINT32)results[i].size(), maxCollidersPerQuery);
+			for (UINT32 j = 0; j < numColliders; j++)
+			{
+				const HCollider& collider = results[i][j];
+
+				ScriptComponentBase* scriptCollider = nullptr;
+				if (collider)
+				{
+					scriptCollider = ScriptGameObjectManager::instance().getBuiltinScriptComponent(
+						static_object_cast<Component>(collider));
+				}
+
+				MonoObject* managedCollider = nullptr;
+				if (scriptCollider != nullptr)
+					managedCollider = scriptCollider->getManagedInstance();
+
+				collidersArray.set(i * maxCollidersPerQuery + j, managedCollider);
+			}
+
+			countsArray.set(i, (INT32)numColliders);
+		}
+	}
+
+	void ScriptPhysicsQueryBatch::internal_RayCast(MonoArray* rays, UINT32 numQueries, UINT64 layer, float max,
+		bool all, bool parallel, MonoArray* hits, MonoArray* hitCounts, UINT32 maxHitsPerQuery)
+	{
+		numQueries = clampToResults(numQueries, hits, hitCounts, maxHitsPerQuery);
+
+		Vector<Ray> nativeRays;
+		if (!copyInputs(rays, numQueries, nativeRays))
+			return;
+
+		Vector<Vector<PhysicsQueryHit>> results(numQueries);
+		execute(numQueries, parallel, [&](UINT32 i)
+		{
+			if (all)
+				results[i] = Physics::instance().rayCastAll(nativeRays[i], layer, max);
+			else
+			{
+				PhysicsQueryHit hit;
+				if (Physics::instance().rayCast(nativeRays[i], hit, layer, max))
+					results[i].push_back(hit);
+			}
+		});
+
+		writeHits(results, hits, hitCounts, maxHitsPerQuery);
+	}
+
+	void ScriptPhysicsQueryBatch::internal_SphereCast(MonoArray* spheres, MonoArray* unitDirs, UINT32 numQueries,
+		UINT64 layer, float max, bool all, bool parallel, MonoArray* hits, MonoArray* hitCounts, UINT32 maxHitsPerQuery)
+	{
+		numQueries = clampToResults(numQueries, hits, hitCounts, maxHitsPerQuery);
+
+		Vector<Sphere> nativeSpheres;
+		Vector<Vector3> nativeUnitDirs;
+		if (!copyInputs(spheres, numQueries, nativeSpheres) || !copyInputs(unitDirs, numQueries, nativeUnitDirs))
+			return;
+
+		Vector<Vector<PhysicsQueryHit>> results(numQueries);
+		execute(numQueries, parallel, [&](UINT32 i)
+		{
+			if (all)
+				results[i] = Physics::instance().sphereCastAll(nativeSpheres[i], nativeUnitDirs[i], layer, max);
+			else
+			{
+				PhysicsQueryHit hit;
+				if (Physics::instance().sphereCast(nativeSpheres[i], nativeUnitDirs[i], hit, layer, max))
+					results[i].push_back(hit);
+			}
+		});
+
+		writeHits(results, hits, hitCounts, maxHitsPerQuery);
+	}
+
+	void ScriptPhysicsQueryBatch::internal_SphereOverlap(MonoArray* spheres, UINT32 numQueries, UINT64 layer,
+		bool parallel, MonoArray* colliders, MonoArray* counts, UINT32 maxCollidersPerQuery)
+	{
+		numQueries = clampToResults(numQueries, colliders, counts, maxCollidersPerQuery);
+
+		Vector<Sphere> nativeSpheres;
+		if (!copyInputs(spheres, numQueries, nativeSpheres))
+			return;
+
+		Vector<Vector<HCollider>> results(numQueries);
+		execute(numQueries, parallel, [&](UINT32 i)
+		{
+			results[i] = Physics::instance().sphereOverlap(nativeSpheres[i], layer);
+		});
+
+		writeColliders(results, colliders, counts, maxCollidersPerQuery);
+	}
+
+	void ScriptPhysicsQueryBatch::internal_BoxOverlap(MonoArray* boxes, MonoArray* rotations, UINT32 numQueries,
+		UINT64 layer, bool parallel, MonoArray* colliders, MonoArray* counts, UINT32 maxCollidersPerQuery)
+	{
+		numQueries = clampToResults(numQueries, colliders, counts, maxCollidersPerQuery);
+
+		Vector<AABox> nativeBoxes;
+		Vector<Quaternion> nativeRotations;
+		if (!copyInputs(boxes, numQueries, nativeBoxes) || !copyInputs(rotations, numQueries, nativeRotations))
+			return;
+
+		Vector<Vector<HCollider>> results(numQueries);
+		execute(numQueries, parallel, [&](UINT32 i)
+		{
+			results[i] = Physics::instance().boxOverlap(nativeBoxes[i], nativeRotations[i], layer);
+		});
+
+		writeColliders(results, colliders, counts, maxCollidersPerQuery);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Physics/BsPhysicsCommon.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for PhysicsQueryBatch. Executes many physics queries in a single call and writes
+	 * their results into caller provided managed arrays, without allocating any managed memory.
+	 */
+	class BS_SCR_BE_EXPORT ScriptPhysicsQueryBatch : public ScriptObject<ScriptPhysicsQueryBatch>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "PhysicsQueryBatch")
+
+	private:
+		ScriptPhysicsQueryBatch(MonoObject* instance);
+
+		/** Minimum number of queries executed by a single worker task, when executing queries in parallel. */
+		static constexpr UINT32 QUERIES_PER_TASK = 256;
+
+		/**
+		 * Executes @p query for every index in range [0, @p numQueries). If @p parallel is true the queries are split
+		 * between worker threads, unless the physics scene is currently being updated or there are too few queries.
+		 */
+		static void execute(UINT32 numQueries, bool parallel, const std::function<void(UINT32)>& query);
+
+		/**
+		 * Writes query hits into the managed hits array, with up to @p maxHitsPerQuery hits for each query, and the number
+		 * of written hits into the managed hit count array.
+		 */
+		static void writeHits(const Vector<Vector<PhysicsQueryHit>>& results, MonoArray* hits, MonoArray* hitCounts,
+			UINT32 maxHitsPerQuery);
+
+		/**
+		 * Writes overlapping colliders into the managed colliders array, with up to @p maxCollidersPerQuery colliders for
+		 * each query, and the number of written colliders into the managed count array.
+		 */
+		static void writeColliders(const Vector<Vector<HCollider>>& results, MonoArray* colliders, MonoArray* counts,
+			UINT32 maxCollidersPerQuery);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_RayCast(MonoArray* rays, UINT32 numQueries, UINT64 layer, float max, bool all,
+			bool parallel, MonoArray* hits, MonoArray* hitCounts, UINT32 maxHitsPerQuery);
+		static void internal_SphereCast(MonoArray* spheres, MonoArray* unitDirs, UINT32 numQueries, UINT64 layer,
+			float max, bool all, bool parallel, MonoArray* hits, MonoArray* hitCounts, UINT32 maxHitsPerQuery);
+		static void internal_SphereOverlap(MonoArray* spheres, UINT32 numQueries, UINT64 layer, bool parallel,
+			MonoArray* colliders, MonoArray* counts, UINT32 maxCollidersPerQuery);
+		static void internal_BoxOverlap(MonoArray* boxes, MonoArray* rotations, UINT32 numQueries, UINT64 layer,
+			bool parallel, MonoArray* colliders, MonoArray* counts, UINT32 maxCollidersPerQuery);
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Wrappers/BsScriptPrefab.h"
 #include "BsScriptResourceManager.h"
 #include "BsScriptGameObjectManager.h"
+#include "BsSceneObjectNameIndex.h"
 #include "BsScriptMeta.h"
 #include "BsMonoClass.h"
 #include "Wrappers/BsScriptSceneObject.h"
@@ -33,6 +34,8 @@ namespace bs
 		HPrefab prefab = thisPtr->getHandle();
 
 		HSceneObject instance = prefab->instantiate();
+		SceneObjectNameIndex::instance().notifyCreated(instance);
+
 		ScriptSceneObject* scriptInstance = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(instance);
 
 		return scriptInstance->getManagedInstance();
@@ -0,0 +1,224 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptPrefabPool.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsScriptGameObjectManager.h"
+#include "BsSceneObjectNameIndex.h"
+#include "Wrappers/BsScriptPrefab.h"
+#include "Wrappers/BsScriptSceneObject.h"
+#include "Scene/BsSceneManager.h"
+
+namespace bs
+{
+	ScriptPrefabPool::ScriptPrefabPool(MonoObject* instance, const HPrefab& prefab, UINT32 maxFree)
+		:ScriptObject(instance), mPrefab(prefab), mMaxFree(maxFree)
+	{
+		mFree.reserve(maxFree);
+	}
+
+	ScriptPrefabPool::~ScriptPrefabPool()
+	{
+		// Spawned instances belong to the caller, but free ones would otherwise remain in the scene, inactive, forever
+		clear();
+	}
+
+	void ScriptPrefabPool::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptPrefabPool::internal_Create);
+		metaData.scriptClass->addInternalCall("Internal_Spawn", (void*)&ScriptPrefabPool::internal_Spawn);
+		metaData.scriptClass->addInternalCall("Internal_CanRelease", (void*)&ScriptPrefabPool::internal_CanRelease);
+		metaData.scriptClass->addInternalCall("Internal_Release", (void*)&ScriptPrefabPool::internal_Release);
+		metaData.scriptClass->addInternalCall("Internal_Prewarm", (void*)&ScriptPrefabPool::internal_Prewarm);
+		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptPrefabPool::internal_Clear);
+		metaData.scriptClass->addInternalCall("Internal_GetStats", (void*)&ScriptPrefabPool::internal_GetStats);
+	}
+
+	HSceneObject ScriptPrefabPool::createInstance()
+	{
+		if (!mPrefab.isLoaded(false))
+			return HSceneObject();
+
+		if ((UINT32)mInstances.size() >= mPruneThreshold)
+		{
+			pruneDestroyed();
+			mPruneThreshold = std::max((UINT32)MIN_PRUNE_THRESHOLD, (UINT32)mInstances.size() * 2);
+		}
+
+		HSceneObject instance = mPrefab->instantiate();
+		SceneObjectNameIndex::instance().notifyCreated(instance);
+
+		mInstances[instance.getInstanceId()] = { instance, false };
+		mStats.numCreated++;
+
+		return instance;
+	}
+
+	void ScriptPrefabPool::clear()
+	{
+		for (auto& instance : mFree)
+		{
+			if (instance.isDestroyed())
+				continue;
+
+			mInstances.erase(instance.getInstanceId());
+			instance->destroy();
+		}
+
+		mFree.clear();
+		mStats.numFree = 0;
+	}
+
+	void ScriptPrefabPool::pruneDestroyed()
+	{
+		for (auto iter = mInstances.begin(); iter != mInstances.end();)
+		{
+			if (!iter->second.sceneObject.isDestroyed())
+			{
+				++iter;
+				continue;
+			}
+
+			if (!iter->second.isFree)
+				mStats.numActive--;
+
+			iter = mInstances.erase(iter);
+		}
+
+		auto iterRemove = std::remove_if(mFree.begin(), mFree.end(),
+			[](const HSceneObject& instance) { return instance.isDestroyed(); });
+
+		mFree.erase(iterRemove, mFree.end());
+		mStats.numFree = (UINT32)mFree.size();
+	}
+
+	bool ScriptPrefabPool::canRelease(const HSceneObject& sceneObject) const
+	{
+		if (sceneObject.isDestroyed())
+			return false;
+
+		auto iterFind = mInstances.find(sceneObject.getInstanceId());
+		if (iterFind == mInstances.end())
+		{
+			LOGWRN("Releasing a scene object that wasn't spawned by this pool. Ignoring call.");
+			return false;
+		}
+
+		if (iterFind->second.isFree)
+		{
+			LOGWRN("Releasing a scene object that has already been released to the pool. Ignoring call.");
+			return false;
+		}
+
+		return true;
+	}
+
+	void ScriptPrefabPool::internal_Create(MonoObject* instance, ScriptPrefab* prefab, UINT32 maxFree)
+	{
+		new (bs_alloc<ScriptPrefabPool>()) ScriptPrefabPool(instance, prefab->getHandle(), maxFree);
+	}
+
+	MonoObject* ScriptPrefabPool::internal_Spawn(ScriptPrefabPool* thisPtr)
+	{
+		HSceneObject instance;
+
+		// Instances could have been destroyed directly while waiting in the pool, skip over those
+		while (!thisPtr->mFree.empty() && instance == nullptr)
+		{
+			HSceneObject candidate = thisPtr->mFree.back();
+			thisPtr->mFree.pop_back();
+
+			if (candidate.isDestroyed())
+				continue;
+
+			instance = candidate;
+			instance->setActive(true);
+
+			thisPtr->mInstances[instance.getInstanceId()].isFree = false;
+			thisPtr->mStats.numReused++;
+		}
+
+		if (instance == nullptr)
+			instance = thisPtr->createInstance();
+
+		thisPtr->mStats.numFree = (UINT32)thisPtr->mFree.size();
+
+		if (instance == nullptr)
+			return nullptr;
+
+		thisPtr->mStats.numActive++;
+
+		// Released instances keep their script objects, so this only creates a wrapper for newly instantiated ones
+		ScriptSceneObject* scriptInstance = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(instance);
+		return scriptInstance->getManagedInstance();
+	}
+
+	bool ScriptPrefabPool::internal_CanRelease(ScriptPrefabPool* thisPtr, ScriptSceneObject* sceneObject)
+	{
+		if (sceneObject == nullptr)
+			return false;
+
+		return thisPtr->canRelease(sceneObject->getNativeSceneObject());
+	}
+
+	bool ScriptPrefabPool::internal_Release(ScriptPrefabPool* thisPtr, ScriptSceneObject* sceneObject)
+	{
+		if (sceneObject == nullptr)
+			return false;
+
+		HSceneObject instance = sceneObject->getNativeSceneObject();
+		if (!thisPtr->canRelease(instance))
+			return false;
+
+		thisPtr->mStats.numActive--;
+		thisPtr->mStats.numReleased++;
+
+		if (thisPtr->mFree.size() >= thisPtr->mMaxFree)
+		{
+			thisPtr->mInstances.erase(instance.getInstanceId());
+			thisPtr->mStats.numDiscarded++;
+
+			instance->destroy();
+			return true;
+		}
+
+		// Detach from whatever the caller parented the instance to, so it doesn't get destroyed along with it
+		instance->setActive(false);
+		instance->setParent(gSceneManager().getRootNode());
+
+		thisPtr->mInstances[instance.getInstanceId()].isFree = true;
+		thisPtr->mFree.push_back(instance);
+		thisPtr->mStats.numFree = (UINT32)thisPtr->mFree.size();
+
+		return true;
+	}
+
+	void ScriptPrefabPool::internal_Prewarm(ScriptPrefabPool* thisPtr, UINT32 count)
+	{
+		count = std::min(count, thisPtr->mMaxFree);
+		while ((UINT32)thisPtr->mFree.size() < count)
+		{
+			HSceneObject instance = thisPtr->createInstance();
+			if (instance == nullptr)
+				break;
+
+			instance->setActive(false);
+
+			thisPtr->mInstances[instance.getInstanceId()].isFree = true;
+			thisPtr->mFree.push_back(instance);
+		}
+
+		thisPtr->mStats.numFree = (UINT32)thisPtr->mFree.size();
+	}
+
+	void ScriptPrefabPool::internal_Clear(ScriptPrefabPool* thisPtr)
+	{
+		thisPtr->clear();
+	}
+
+	void ScriptPrefabPool::internal_GetStats(ScriptPrefabPool* thisPtr, PrefabPoolStats* stats)
+	{
+		thisPtr->pruneDestroyed();
+		*stats = thisPtr->mStats;
+	}
+}
\ No newline at end of file
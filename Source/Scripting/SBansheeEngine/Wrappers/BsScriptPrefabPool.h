@@ -0,0 +1,90 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	class ScriptPrefab;
+	class ScriptSceneObject;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** Statistics about the use of a PrefabPool. Layout matches the managed PrefabPoolStats struct. */
+	struct PrefabPoolStats
+	{
+		UINT32 numCreated = 0; /**< Number of instances instantiated from the prefab. */
+		UINT32 numReused = 0; /**< Number of spawns served by a previously released instance. */
+		UINT32 numReleased = 0; /**< Number of instances returned to the pool. */
+		UINT32 numDiscarded = 0; /**< Number of instances destroyed because the pool was full. */
+		UINT32 numActive = 0; /**< Number of instances currently spawned. */
+		UINT32 numFree = 0; /**< Number of instances currently waiting in the pool. */
+	};
+
+	/**
+	 * Interop class between C++ & CLR for PrefabPool. Keeps released prefab instances deactivated in the scene and
+	 * hands them out again on the next spawn, so their scene objects, components and script wrappers are reused instead
+	 * of being destroyed and created again.
+	 */
+	class BS_SCR_BE_EXPORT ScriptPrefabPool : public ScriptObject<ScriptPrefabPool>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "PrefabPool")
+
+	private:
+		ScriptPrefabPool(MonoObject* instance, const HPrefab& prefab, UINT32 maxFree);
+		~ScriptPrefabPool();
+
+		/** Instantiates a new, active instance of the prefab and registers it with the pool. */
+		HSceneObject createInstance();
+
+		/** Destroys all released instances waiting in the pool. */
+		void clear();
+
+		/**
+		 * Forgets about spawned instances that were destroyed directly instead of being released, and updates the number
+		 * of active instances accordingly.
+		 */
+		void pruneDestroyed();
+
+		/**
+		 * Checks if the scene object is an active instance spawned by this pool, and can therefore be released to it.
+		 * Logs a warning if it isn't.
+		 */
+		bool canRelease(const HSceneObject& sceneObject) const;
+
+		/** A scene object created by the pool. */
+		struct PooledInstance
+		{
+			HSceneObject sceneObject;
+			bool isFree;
+		};
+
+		/** Minimum number of tracked instances before checking for destroyed ones when creating a new instance. */
+		static constexpr UINT32 MIN_PRUNE_THRESHOLD = 64;
+
+		HPrefab mPrefab;
+		UINT32 mMaxFree;
+		Vector<HSceneObject> mFree;
+		UnorderedMap<UINT64, PooledInstance> mInstances; /**< All scene objects created by the pool, by instance ID. */
+		UINT32 mPruneThreshold = MIN_PRUNE_THRESHOLD;
+		PrefabPoolStats mStats;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_Create(MonoObject* instance, ScriptPrefab* prefab, UINT32 maxFree);
+		static MonoObject* internal_Spawn(ScriptPrefabPool* thisPtr);
+		static bool internal_CanRelease(ScriptPrefabPool* thisPtr, ScriptSceneObject* sceneObject);
+		static bool internal_Release(ScriptPrefabPool* thisPtr, ScriptSceneObject* sceneObject);
+		static void internal_Prewarm(ScriptPrefabPool* thisPtr, UINT32 count);
+		static void internal_Clear(ScriptPrefabPool* thisPtr);
+		static void internal_GetStats(ScriptPrefabPool* thisPtr, PrefabPoolStats* stats);
+	};
+
+	/** @} */
+}
\ No newline at end of file
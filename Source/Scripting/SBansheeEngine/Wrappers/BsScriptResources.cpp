@@ -10,9 +10,41 @@
 #include "BsScriptResourceManager.h"
 #include "Wrappers/BsScriptResource.h"
 #include "BsApplication.h"
+#include "BsScriptObjectManager.h"
 
 namespace bs
 {
+	/** Asynchronous load of a single resource, shared by all script requests for that resource made while it loads. */
+	struct ScriptAsyncLoad
+	{
+		HResource resource;
+		Vector<UINT32> ids;
+	};
+
+	/** In-progress asynchronous loads, keyed by resource UUID. */
+	static UnorderedMap<UUID, ScriptAsyncLoad> gAsyncLoads;
+
+	/** Maps the identifiers of script requests to the UUIDs of the resources they are waiting on. */
+	static UnorderedMap<UINT32, UUID> gAsyncLoadIds;
+	static UINT32 gNextAsyncLoadId = 1;
+
+	/** Returns the flags to load a resource with from scripting code. */
+	static ResourceLoadFlags getLoadFlags(bool keepLoaded)
+	{
+		ResourceLoadFlags loadFlags = ResourceLoadFlag::LoadDependencies;
+		if (keepLoaded)
+			loadFlags |= ResourceLoadFlag::KeepInternalRef;
+
+		if (gApplication().isEditor())
+			loadFlags |= ResourceLoadFlag::KeepSourceData;
+
+		return loadFlags;
+	}
+
+	UINT32 ScriptResources::sAsyncLoadBudget = 8;
+	HEvent ScriptResources::sRefreshStartedConn;
+	ScriptResources::OnAsyncLoadCompleteThunkDef ScriptResources::onAsyncLoadCompleteThunk = nullptr;
+
 	ScriptResources::ScriptResources(MonoObject* instance)
 		:ScriptObject(instance)
 	{ }
@@ -24,6 +56,96 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_UnloadUnused", (void*)&ScriptResources::internal_UnloadUnused);
 		metaData.scriptClass->addInternalCall("Internal_Release", (void*)&ScriptResources::internal_Release);
 		metaData.scriptClass->addInternalCall("Internal_ReleaseRef", (void*)&ScriptResources::internal_ReleaseRef);
+		metaData.scriptClass->addInternalCall("Internal_LoadAsync", (void*)&ScriptResources::internal_LoadAsync);
+		metaData.scriptClass->addInternalCall("Internal_GetAsyncLoadProgress",
+			(void*)&ScriptResources::internal_GetAsyncLoadProgress);
+		metaData.scriptClass->addInternalCall("Internal_GetAsyncLoadBudget", (void*)&ScriptResources::internal_GetAsyncLoadBudget);
+		metaData.scriptClass->addInternalCall("Internal_SetAsyncLoadBudget", (void*)&ScriptResources::internal_SetAsyncLoadBudget);
+
+		onAsyncLoadCompleteThunk = (OnAsyncLoadCompleteThunkDef)metaData.scriptClass->getMethod(
+			"Internal_OnAsyncLoadComplete", 2)->getThunk();
+	}
+
+	void ScriptResources::update()
+	{
+		// Managed callbacks can start new loads, so finished loads are removed before any of them are reported
+		Vector<ScriptAsyncLoad> finishedLoads;
+		for (auto iter = gAsyncLoads.begin(); iter != gAsyncLoads.end();)
+		{
+			if (sAsyncLoadBudget > 0 && (UINT32)finishedLoads.size() >= sAsyncLoadBudget)
+				break;
+
+			// Null handle means the resource couldn't be found, which is also reported as a finished load
+			ScriptAsyncLoad& load = iter->second;
+			if (load.resource != nullptr && !load.resource.isLoaded(true))
+			{
+				if (!hasLoadFailed(iter->first, load.resource))
+				{
+					++iter;
+					continue;
+				}
+
+				load.resource = nullptr;
+			}
+
+			finishedLoads.push_back(std::move(iter->second));
+			iter = gAsyncLoads.erase(iter);
+		}
+
+		for (auto& load : finishedLoads)
+		{
+			MonoObject* managedInstance = nullptr;
+			if (load.resource != nullptr)
+			{
+				ScriptResourceBase* scriptResource = ScriptResourceManager::instance().getScriptResource(load.resource, true);
+				managedInstance = scriptResource->getManagedInstance();
+			}
+
+			for (auto& id : load.ids)
+			{
+				gAsyncLoadIds.erase(id);
+
+				if (onAsyncLoadCompleteThunk != nullptr)
+					MonoUtil::invokeThunk(onAsyncLoadCompleteThunk, id, managedInstance);
+			}
+		}
+	}
+
+	void ScriptResources::startUp()
+	{
+		sRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(&onRefreshStarted);
+	}
+
+	void ScriptResources::shutDown()
+	{
+		sRefreshStartedConn.disconnect();
+
+		gAsyncLoads.clear();
+		gAsyncLoadIds.clear();
+	}
+
+	void ScriptResources::onRefreshStarted()
+	{
+		// Requests belong to the domain being unloaded, so they can't be reported once the new domain is loaded
+		gAsyncLoads.clear();
+		gAsyncLoadIds.clear();
+
+		MonoMethod* clearMethod = metaData.scriptClass->getMethod("ClearAsyncLoads");
+		if (clearMethod != nullptr)
+			clearMethod->invoke(nullptr, nullptr);
+	}
+
+	bool ScriptResources::hasLoadFailed(const UUID& uuid, const HResource& resource)
+	{
+		if (resource.isLoaded(false))
+			return false;
+
+		// A load that failed is no longer in progress, yet its handle never becomes loaded. Handle is checked again
+		// in case the load finished in the meantime.
+		if (gResources().isLoaded(uuid, true))
+			return false;
+
+		return !resource.isLoaded(false);
 	}
 
 	MonoObject* ScriptResources::internal_Load(MonoString* path, bool keepLoaded)
@@ -40,14 +162,7 @@ namespace bs
 
 	MonoObject* ScriptResources::internal_LoadFromUUID(UUID* uuid, bool keepLoaded)
 	{
-		ResourceLoadFlags loadFlags = ResourceLoadFlag::LoadDependencies;
-		if (keepLoaded)
-			loadFlags |= ResourceLoadFlag::KeepInternalRef;
-
-		if (gApplication().isEditor())
-			loadFlags |= ResourceLoadFlag::KeepSourceData;
-
-		HResource resource = gResources().loadFromUUID(*uuid, loadFlags);
+		HResource resource = gResources().loadFromUUID(*uuid, getLoadFlags(keepLoaded));
 		if (resource == nullptr)
 			return nullptr;
 
@@ -69,4 +184,51 @@ namespace bs
 	{
 		gResources().unloadAllUnused();
 	}
+
+	UINT32 ScriptResources::internal_LoadAsync(UUID* uuid, bool keepLoaded)
+	{
+		UINT32 id = gNextAsyncLoadId++;
+		gAsyncLoadIds[id] = *uuid;
+
+		auto iterFind = gAsyncLoads.find(*uuid);
+		if (iterFind != gAsyncLoads.end())
+		{
+			// Resources won't start another load of an in-progress resource, but each request that wants the resource
+			// kept loaded still needs to register its own internal reference
+			if (keepLoaded)
+				gResources().loadFromUUID(*uuid, true, getLoadFlags(true));
+
+			iterFind->second.ids.push_back(id);
+			return id;
+		}
+
+		ScriptAsyncLoad& load = gAsyncLoads[*uuid];
+		load.resource = gResources().loadFromUUID(*uuid, true, getLoadFlags(keepLoaded));
+		load.ids.push_back(id);
+
+		return id;
+	}
+
+	float ScriptResources::internal_GetAsyncLoadProgress(UINT32 id)
+	{
+		auto iterFindId = gAsyncLoadIds.find(id);
+		if (iterFindId == gAsyncLoadIds.end())
+			return 1.0f;
+
+		auto iterFindLoad = gAsyncLoads.find(iterFindId->second);
+		if (iterFindLoad == gAsyncLoads.end() || iterFindLoad->second.resource == nullptr)
+			return 1.0f;
+
+		return gResources().getLoadProgress(iterFindLoad->second.resource, true);
+	}
+
+	UINT32 ScriptResources::internal_GetAsyncLoadBudget()
+	{
+		return sAsyncLoadBudget;
+	}
+
+	void ScriptResources::internal_SetAsyncLoadBudget(UINT32 budget)
+	{
+		sAsyncLoadBudget = budget;
+	}
 }
\ No newline at end of file
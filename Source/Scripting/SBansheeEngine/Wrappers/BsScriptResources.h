@@ -19,9 +19,31 @@ namespace bs
 	public:
 		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "Resources")
 
+		/**
+		 * Checks the status of in-progress asynchronous loads, and reports the ones that finished to managed code, up to
+		 * the per-frame budget. Must be called once per frame from the main thread.
+		 */
+		static void update();
+
+		/** Registers callbacks for assembly refresh. Must be called on scripting system load. */
+		static void startUp();
+
+		/** Releases all in-progress asynchronous loads. Must be called on scripting system shutdown. */
+		static void shutDown();
+
 	private:
 		ScriptResources(MonoObject* instance);
 
+		/** Triggered when assembly refresh starts. Drops all in-progress asynchronous loads. */
+		static void onRefreshStarted();
+
+		/** Checks has the asynchronous load of the provided resource failed. */
+		static bool hasLoadFailed(const UUID& uuid, const HResource& resource);
+
+		static HEvent sRefreshStartedConn;
+
+		static UINT32 sAsyncLoadBudget;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -30,6 +52,14 @@ namespace bs
 		static void internal_Release(ScriptResourceBase* resource);
 		static void internal_ReleaseRef(ScriptRRefBase* resource);
 		static void internal_UnloadUnused();
+		static UINT32 internal_LoadAsync(UUID* uuid, bool keepLoaded);
+		static float internal_GetAsyncLoadProgress(UINT32 id);
+		static UINT32 internal_GetAsyncLoadBudget();
+		static void internal_SetAsyncLoadBudget(UINT32 budget);
+
+		typedef void(BS_THUNKCALL *OnAsyncLoadCompleteThunkDef) (UINT32, MonoObject*, MonoException**);
+
+		static OnAsyncLoadCompleteThunkDef onAsyncLoadCompleteThunk;
 	};
 
 	/** @} */
@@ -17,6 +17,7 @@
 #include "Wrappers/BsScriptPrefab.h"
 #include "Wrappers/BsScriptSceneObject.h"
 #include "BsScriptObjectManager.h"
+#include "BsSceneObjectNameIndex.h"
 
 namespace bs
 {
@@ -37,6 +38,9 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetRoot", (void*)&ScriptScene::internal_GetRoot);
 		metaData.scriptClass->addInternalCall("Internal_ClearScene", (void*)&ScriptScene::internal_ClearScene);
 		metaData.scriptClass->addInternalCall("Internal_GetMainCameraSO", (void*)&ScriptScene::internal_GetMainCameraSO);
+		metaData.scriptClass->addInternalCall("Internal_SetNameIndexEnabled", (void*)&ScriptScene::internal_SetNameIndexEnabled);
+		metaData.scriptClass->addInternalCall("Internal_GetNameIndexEnabled", (void*)&ScriptScene::internal_GetNameIndexEnabled);
+		metaData.scriptClass->addInternalCall("Internal_RefreshNameIndex", (void*)&ScriptScene::internal_RefreshNameIndex);
 	}
 
 	void ScriptScene::startUp()
@@ -70,6 +74,9 @@ namespace bs
 				prefab->instantiate();
 			}
 
+			// New scene objects were added without going through the scripting API
+			SceneObjectNameIndex::instance().markDirty();
+
 			ScriptResourceBase* scriptPrefab = ScriptResourceManager::instance().getScriptResource(prefab, true);
 			return scriptPrefab->getManagedInstance();
 		}
@@ -136,6 +143,21 @@ namespace bs
 		gSceneManager().clearScene();
 	}
 
+	void ScriptScene::internal_SetNameIndexEnabled(bool enabled)
+	{
+		SceneObjectNameIndex::instance().setEnabled(enabled);
+	}
+
+	bool ScriptScene::internal_GetNameIndexEnabled()
+	{
+		return SceneObjectNameIndex::instance().isEnabled();
+	}
+
+	void ScriptScene::internal_RefreshNameIndex()
+	{
+		SceneObjectNameIndex::instance().markDirty();
+	}
+
 	MonoObject* ScriptScene::internal_GetMainCameraSO()
 	{
 		SPtr<Camera> camera = gSceneManager().getMainCamera();
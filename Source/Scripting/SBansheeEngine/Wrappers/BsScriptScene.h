@@ -46,6 +46,9 @@ namespace bs
 		static MonoObject* internal_GetRoot();
 		static void internal_ClearScene();
 		static MonoObject* internal_GetMainCameraSO();
+		static void internal_SetNameIndexEnabled(bool enabled);
+		static bool internal_GetNameIndexEnabled();
+		static void internal_RefreshNameIndex();
 	};
 
 	/** @} */
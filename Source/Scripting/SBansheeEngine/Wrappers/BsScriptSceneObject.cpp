@@ -9,6 +9,7 @@
 #include "BsMonoManager.h"
 #include "Scene/BsSceneObject.h"
 #include "BsMonoUtil.h"
+#include "BsSceneObjectNameIndex.h"
 
 namespace bs
 {
@@ -34,6 +35,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetChild", (void*)&ScriptSceneObject::internal_getChild);
 		metaData.scriptClass->addInternalCall("Internal_FindChild", (void*)&ScriptSceneObject::internal_findChild);
 		metaData.scriptClass->addInternalCall("Internal_FindChildren", (void*)&ScriptSceneObject::internal_findChildren);
+		metaData.scriptClass->addInternalCall("Internal_FindChildrenWithPrefix", (void*)&ScriptSceneObject::internal_findChildrenWithPrefix);
 
 		metaData.scriptClass->addInternalCall("Internal_GetPosition", (void*)&ScriptSceneObject::internal_getPosition);
 		metaData.scriptClass->addInternalCall("Internal_GetLocalPosition", (void*)&ScriptSceneObject::internal_getLocalPosition);
@@ -62,12 +64,21 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetUp", (void*)&ScriptSceneObject::internal_getUp);
 		metaData.scriptClass->addInternalCall("Internal_GetRight", (void*)&ScriptSceneObject::internal_getRight);
 
+		metaData.scriptClass->addInternalCall("Internal_GetPositions", (void*)&ScriptSceneObject::internal_getPositions);
+		metaData.scriptClass->addInternalCall("Internal_SetPositions", (void*)&ScriptSceneObject::internal_setPositions);
+		metaData.scriptClass->addInternalCall("Internal_GetRotations", (void*)&ScriptSceneObject::internal_getRotations);
+		metaData.scriptClass->addInternalCall("Internal_SetRotations", (void*)&ScriptSceneObject::internal_setRotations);
+		metaData.scriptClass->addInternalCall("Internal_GetScales", (void*)&ScriptSceneObject::internal_getScales);
+		metaData.scriptClass->addInternalCall("Internal_SetLocalScales", (void*)&ScriptSceneObject::internal_setLocalScales);
+		metaData.scriptClass->addInternalCall("Internal_GetTransforms", (void*)&ScriptSceneObject::internal_getTransforms);
+
 		metaData.scriptClass->addInternalCall("Internal_Destroy", (void*)&ScriptSceneObject::internal_destroy);
 	}
 
 	void ScriptSceneObject::internal_createInstance(MonoObject* instance, MonoString* name, UINT32 flags)
 	{
 		HSceneObject sceneObject = SceneObject::create(MonoUtil::monoToString(name), flags);
+		SceneObjectNameIndex::instance().notifyCreated(sceneObject);
 
 		ScriptGameObjectManager::instance().createScriptSceneObject(instance, sceneObject);
 	}
@@ -78,6 +89,7 @@ namespace bs
 			return;
 
 		nativeInstance->mSceneObject->setName(MonoUtil::monoToString(name));
+		SceneObjectNameIndex::instance().notifyRenamed(nativeInstance->mSceneObject);
 	}
 
 	MonoString* ScriptSceneObject::internal_getName(ScriptSceneObject* nativeInstance)
@@ -128,6 +140,7 @@ namespace bs
 		ScriptSceneObject* parentScriptSO = ScriptSceneObject::toNative(parent);
 
 		nativeInstance->mSceneObject->setParent(parentScriptSO->mSceneObject);
+		ScriptGameObjectManager::instance().onHierarchyModified();
 	}
 
 	MonoObject* ScriptSceneObject::internal_getParent(ScriptSceneObject* nativeInstance)
@@ -179,7 +192,11 @@ namespace bs
 			return nullptr;
 
 		String nativeName = MonoUtil::monoToString(name);
-		HSceneObject child = nativeInstance->getNativeSceneObject()->findChild(nativeName, recursive);
+		HSceneObject sceneObject = nativeInstance->getNativeSceneObject();
+
+		HSceneObject child;
+		if (!recursive || !SceneObjectNameIndex::instance().findChild(sceneObject, nativeName, child))
+			child = sceneObject->findChild(nativeName, recursive);
 
 		if (child == nullptr)
 			return nullptr;
@@ -197,17 +214,63 @@ namespace bs
 		}
 
 		String nativeName = MonoUtil::monoToString(name);
-		Vector<HSceneObject> children = nativeInstance->getNativeSceneObject()->findChildren(nativeName, recursive);
+		HSceneObject sceneObject = nativeInstance->getNativeSceneObject();
 
-		UINT32 numChildren = (UINT32)children.size();
-		ScriptArray output = ScriptArray::create<ScriptSceneObject>(numChildren);
+		Vector<HSceneObject> children;
+		if (!recursive || !SceneObjectNameIndex::instance().findChildren(sceneObject, nativeName, children))
+			children = sceneObject->findChildren(nativeName, recursive);
+
+		return toManagedArray(children);
+	}
 
-		for (UINT32 i = 0; i < numChildren; i++)
+	MonoArray* ScriptSceneObject::internal_findChildrenWithPrefix(ScriptSceneObject* nativeInstance, MonoString* prefix,
+		bool recursive)
+	{
+		if (checkIfDestroyed(nativeInstance))
 		{
-			HSceneObject child = children[i];
-			ScriptSceneObject* scriptChild = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(child);
+			ScriptArray emptyArray = ScriptArray::create<ScriptSceneObject>(0);
+			return emptyArray.getInternal();
+		}
+
+		String nativePrefix = MonoUtil::monoToString(prefix);
+		HSceneObject sceneObject = nativeInstance->getNativeSceneObject();
 
-			output.set(i, scriptChild->getManagedInstance());
+		Vector<HSceneObject> children;
+		if (!recursive || !SceneObjectNameIndex::instance().findChildrenWithPrefix(sceneObject, nativePrefix, children))
+		{
+			Vector<HSceneObject> todo = { sceneObject };
+			while (!todo.empty())
+			{
+				HSceneObject current = todo.back();
+				todo.pop_back();
+
+				UINT32 numChildren = current->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+				{
+					HSceneObject child = current->getChild(i);
+					if (child->getName().compare(0, nativePrefix.size(), nativePrefix) == 0)
+						children.push_back(child);
+
+					if (recursive)
+						todo.push_back(child);
+				}
+			}
+
+			SceneObjectNameIndex::sortInHierarchyOrder(sceneObject, children);
+		}
+
+		return toManagedArray(children);
+	}
+
+	MonoArray* ScriptSceneObject::toManagedArray(const Vector<HSceneObject>& sceneObjects)
+	{
+		UINT32 numSceneObjects = (UINT32)sceneObjects.size();
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>(numSceneObjects);
+
+		for (UINT32 i = 0; i < numSceneObjects; i++)
+		{
+			ScriptSceneObject* scriptSO = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(sceneObjects[i]);
+			output.set(i, scriptSO->getManagedInstance());
 		}
 
 		return output.getInternal();
@@ -379,6 +442,168 @@ namespace bs
 			*value = Vector3(Vector3::UNIT_X);
 	}
 
+	/**
+	 * Returns the number of entries that can be processed by a batched transform call, and the address of the first
+	 * entry in the values array. Values are accessed in-place, without any per-element marshalling.
+	 */
+	template<class T>
+	static UINT32 getBatchValues(MonoArray* sceneObjects, MonoArray* values, T*& output)
+	{
+		output = nullptr;
+		if (sceneObjects == nullptr || values == nullptr)
+			return 0;
+
+		ScriptArray sceneObjectsArray(sceneObjects);
+		ScriptArray valuesArray(values);
+
+		UINT32 count = std::min(sceneObjectsArray.size(), valuesArray.size());
+		if (count > 0)
+			output = (T*)valuesArray.getRaw(0, sizeof(T));
+
+		return count;
+	}
+
+	void ScriptSceneObject::internal_getPositions(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Vector3* output;
+		UINT32 count = getBatchValues(sceneObjects, values, output);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			SceneObject* so = nativeSceneObjects[i];
+			if (so == nullptr)
+				output[i] = Vector3(BsZero);
+			else if (local)
+				output[i] = so->getLocalTransform().getPosition();
+			else
+				output[i] = so->getTransform().getPosition();
+		}
+	}
+
+	void ScriptSceneObject::internal_setPositions(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Vector3* input;
+		UINT32 count = getBatchValues(sceneObjects, values, input);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		if (local)
+		{
+			for (UINT32 i = 0; i < count; i++)
+			{
+				if (nativeSceneObjects[i] != nullptr)
+					nativeSceneObjects[i]->setPosition(input[i]);
+			}
+		}
+		else
+		{
+			for (auto& idx : getHierarchyOrder(nativeSceneObjects))
+				nativeSceneObjects[idx]->setWorldPosition(input[idx]);
+		}
+	}
+
+	void ScriptSceneObject::internal_getRotations(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Quaternion* output;
+		UINT32 count = getBatchValues(sceneObjects, values, output);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			SceneObject* so = nativeSceneObjects[i];
+			if (so == nullptr)
+				output[i] = Quaternion(BsIdentity);
+			else if (local)
+				output[i] = so->getLocalTransform().getRotation();
+			else
+				output[i] = so->getTransform().getRotation();
+		}
+	}
+
+	void ScriptSceneObject::internal_setRotations(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Quaternion* input;
+		UINT32 count = getBatchValues(sceneObjects, values, input);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		if (local)
+		{
+			for (UINT32 i = 0; i < count; i++)
+			{
+				if (nativeSceneObjects[i] != nullptr)
+					nativeSceneObjects[i]->setRotation(input[i]);
+			}
+		}
+		else
+		{
+			for (auto& idx : getHierarchyOrder(nativeSceneObjects))
+				nativeSceneObjects[idx]->setWorldRotation(input[idx]);
+		}
+	}
+
+	void ScriptSceneObject::internal_getScales(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Vector3* output;
+		UINT32 count = getBatchValues(sceneObjects, values, output);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			SceneObject* so = nativeSceneObjects[i];
+			if (so == nullptr)
+				output[i] = Vector3::ONE;
+			else if (local)
+				output[i] = so->getLocalTransform().getScale();
+			else
+				output[i] = so->getTransform().getScale();
+		}
+	}
+
+	void ScriptSceneObject::internal_setLocalScales(MonoArray* sceneObjects, MonoArray* values)
+	{
+		Vector3* input;
+		UINT32 count = getBatchValues(sceneObjects, values, input);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if (nativeSceneObjects[i] != nullptr)
+				nativeSceneObjects[i]->setScale(input[i]);
+		}
+	}
+
+	void ScriptSceneObject::internal_getTransforms(MonoArray* sceneObjects, MonoArray* values, bool local)
+	{
+		Matrix4* output;
+		UINT32 count = getBatchValues(sceneObjects, values, output);
+
+		Vector<SceneObject*> nativeSceneObjects;
+		getSceneObjects(sceneObjects, count, nativeSceneObjects);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			SceneObject* so = nativeSceneObjects[i];
+			if (so == nullptr)
+				output[i] = Matrix4(BsIdentity);
+			else if (local)
+				output[i] = so->getLocalMatrix();
+			else
+				output[i] = so->getWorldMatrix();
+		}
+	}
+
 	void ScriptSceneObject::internal_destroy(ScriptSceneObject* nativeInstance, bool immediate)
 	{
 		if (!checkIfDestroyed(nativeInstance))
@@ -396,6 +621,75 @@ namespace bs
 		return false;
 	}
 
+	void ScriptSceneObject::getSceneObjects(MonoArray* sceneObjects, UINT32 count, Vector<SceneObject*>& output)
+	{
+		output.resize(count);
+		if (count == 0)
+			return;
+
+		ScriptArray sceneObjectsArray(sceneObjects);
+
+		UINT32 numInvalid = 0;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			output[i] = nullptr;
+
+			MonoObject* managedInstance = sceneObjectsArray.get<MonoObject*>(i);
+			if (managedInstance == nullptr)
+			{
+				numInvalid++;
+				continue;
+			}
+
+			ScriptSceneObject* scriptSO = ScriptSceneObject::toNative(managedInstance);
+			if (scriptSO->mSceneObject.isDestroyed())
+			{
+				numInvalid++;
+				continue;
+			}
+
+			output[i] = scriptSO->mSceneObject.get();
+		}
+
+		if (numInvalid > 0)
+			LOGWRN("Trying to access " + toString(numInvalid) + " null or destroyed SceneObject(s) in a batched transform call.");
+	}
+
+	Vector<UINT32> ScriptSceneObject::getHierarchyOrder(const Vector<SceneObject*>& sceneObjects)
+	{
+		const UINT32 count = (UINT32)sceneObjects.size();
+
+		Vector<std::pair<UINT32, UINT32>> depthAndIndex;
+		depthAndIndex.reserve(count);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if (sceneObjects[i] == nullptr)
+				continue;
+
+			UINT32 depth = 0;
+			HSceneObject parent = sceneObjects[i]->getParent();
+			while (parent != nullptr)
+			{
+				depth++;
+				parent = parent->getParent();
+			}
+
+			depthAndIndex.push_back(std::make_pair(depth, i));
+		}
+
+		// Sorting on both depth and index keeps the user-provided order for objects on the same level
+		std::sort(depthAndIndex.begin(), depthAndIndex.end());
+
+		Vector<UINT32> order;
+		order.reserve(depthAndIndex.size());
+
+		for (auto& entry : depthAndIndex)
+			order.push_back(entry.second);
+
+		return order;
+	}
+
 	void ScriptSceneObject::_onManagedInstanceDeleted(bool assemblyRefresh)
 	{
 		if (!assemblyRefresh || mSceneObject.isDestroyed(true))
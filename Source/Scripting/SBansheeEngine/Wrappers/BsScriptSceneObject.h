@@ -48,6 +48,27 @@ namespace bs
 		/**	Triggered by the script game object manager when the handle this object is referencing is destroyed. */
 		void _notifyDestroyed();
 
+		/** Creates a managed SceneObject array from the provided native scene objects. */
+		static MonoArray* toManagedArray(const Vector<HSceneObject>& sceneObjects);
+
+		/**
+		 * Resolves the scene objects referenced by a managed SceneObject array, for use by the batched transform methods.
+		 * Entries that are null or reference a destroyed scene object are output as null. A single warning is logged if
+		 * any such entries are found.
+		 *
+		 * @param[in]	sceneObjects	Managed array of SceneObject instances.
+		 * @param[in]	count			Number of entries to resolve, starting from the first one.
+		 * @param[out]	output			Scene objects corresponding to the first @p count array entries.
+		 */
+		static void getSceneObjects(MonoArray* sceneObjects, UINT32 count, Vector<SceneObject*>& output);
+
+		/**
+		 * Returns the order in which to assign world space values to the provided scene objects, so that parents are
+		 * always processed before their children. This ensures a child's world transform is calculated relative to its
+		 * parent's final transform, and that the parent's transform doesn't need to be recalculated for every child.
+		 */
+		static Vector<UINT32> getHierarchyOrder(const Vector<SceneObject*>& sceneObjects);
+
 		HSceneObject mSceneObject;
 
 		/************************************************************************/
@@ -70,6 +91,7 @@ namespace bs
 		static MonoObject* internal_getChild(ScriptSceneObject* nativeInstance, UINT32 idx);
 		static MonoObject* internal_findChild(ScriptSceneObject* nativeInstance, MonoString* name, bool recursive);
 		static MonoArray* internal_findChildren(ScriptSceneObject* nativeInstance, MonoString* name, bool recursive);
+		static MonoArray* internal_findChildrenWithPrefix(ScriptSceneObject* nativeInstance, MonoString* prefix, bool recursive);
 
 		static void internal_getPosition(ScriptSceneObject* nativeInstance, Vector3* value);
 		static void internal_getLocalPosition(ScriptSceneObject* nativeInstance, Vector3* value);
@@ -98,6 +120,14 @@ namespace bs
 		static void internal_getUp(ScriptSceneObject* nativeInstance, Vector3* value);
 		static void internal_getRight(ScriptSceneObject* nativeInstance, Vector3* value);
 
+		static void internal_getPositions(MonoArray* sceneObjects, MonoArray* values, bool local);
+		static void internal_setPositions(MonoArray* sceneObjects, MonoArray* values, bool local);
+		static void internal_getRotations(MonoArray* sceneObjects, MonoArray* values, bool local);
+		static void internal_setRotations(MonoArray* sceneObjects, MonoArray* values, bool local);
+		static void internal_getScales(MonoArray* sceneObjects, MonoArray* values, bool local);
+		static void internal_setLocalScales(MonoArray* sceneObjects, MonoArray* values);
+		static void internal_getTransforms(MonoArray* sceneObjects, MonoArray* values, bool local);
+
 		static void internal_destroy(ScriptSceneObject* nativeInstance, bool immediate);
 	};
 
@@ -7,7 +7,7 @@
 #include "BsMonoUtil.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Serialization/BsManagedSerializableField.h"
-#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsManagedSerializableCloner.h"
 
 namespace bs
 {
@@ -37,17 +37,7 @@ namespace bs
 			return nullptr;
 		}
 
-		SPtr<ManagedSerializableFieldData> data = ManagedSerializableFieldData::create(typeInfo, original);
-		MemorySerializer ms;
-
-		// Note: This code unnecessarily encodes to binary and decodes from it. I could have added a specialized clone method that does it directly,
-		// but didn't feel the extra code was justified.
-		UINT32 size = 0;
-		UINT8* encodedData = ms.encode(data.get(), size);
-		SPtr<ManagedSerializableFieldData> clonedData = std::static_pointer_cast<ManagedSerializableFieldData>(ms.decode(encodedData, size));
-		clonedData->deserialize();
-
-		return clonedData->getValueBoxed(typeInfo);
+		return ManagedSerializableCloner::clone(typeInfo, original);
 	}
 
 	MonoObject* ScriptSerializableUtility::internal_Create(MonoReflectionType* reflType)
@@ -66,16 +56,11 @@ namespace bs
 			return nullptr;
 		}
 			
+		// Default field data already references a new managed instance with all of its fields default initialized
 		SPtr<ManagedSerializableFieldData> data = ManagedSerializableFieldData::createDefault(typeInfo);
-		MemorySerializer ms;
-
-		// Note: This code unnecessarily encodes to binary and decodes from it. I could have added a specialized create method that does it directly,
-		// but didn't feel the extra code was justified.
-		UINT32 size = 0;
-		UINT8* encodedData = ms.encode(data.get(), size);
-		SPtr<ManagedSerializableFieldData> createdData = std::static_pointer_cast<ManagedSerializableFieldData>(ms.decode(encodedData, size));
-		createdData->deserialize();
+		if (data == nullptr)
+			return nullptr;
 
-		return createdData->getValueBoxed(typeInfo);
+		return data->getValueBoxed(typeInfo);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptTextureReadback.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+
+#include "BsScriptTexture.generated.h"
+
+namespace bs
+{
+	ScriptTextureReadback::ScriptTextureReadback(MonoObject* instance, const HTexture& texture, UINT32 face,
+		UINT32 mipLevel, UINT32 numSlots)
+		:ScriptObject(instance), mTexture(texture), mFace(face), mMipLevel(mipLevel)
+	{
+		if (!texture.isLoaded(false))
+			return;
+
+		const TextureProperties& props = texture->getProperties();
+		if (face >= props.getNumFaces() || mipLevel > props.getNumMipmaps())
+		{
+			LOGWRN("Texture doesn't contain face " + toString(face) + " at mip level " + toString(mipLevel) + ".");
+			return;
+		}
+
+		mSlots.resize(std::max(numSlots, 1U));
+		for (auto& slot : mSlots)
+			slot.buffer = props.allocBuffer(face, mipLevel);
+
+		const SPtr<PixelData>& buffer = mSlots[0].buffer;
+		mSize = PixelUtil::getMemorySize(buffer->getWidth(), buffer->getHeight(), buffer->getDepth(),
+			buffer->getFormat());
+	}
+
+	void ScriptTextureReadback::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptTextureReadback::internal_Create);
+		metaData.scriptClass->addInternalCall("Internal_GetResultSize",
+			(void*)&ScriptTextureReadback::internal_GetResultSize);
+		metaData.scriptClass->addInternalCall("Internal_GetNumPending",
+			(void*)&ScriptTextureReadback::internal_GetNumPending);
+		metaData.scriptClass->addInternalCall("Internal_IsResultAvailable",
+			(void*)&ScriptTextureReadback::internal_IsResultAvailable);
+		metaData.scriptClass->addInternalCall("Internal_Request", (void*)&ScriptTextureReadback::internal_Request);
+		metaData.scriptClass->addInternalCall("Internal_TryGetResult",
+			(void*)&ScriptTextureReadback::internal_TryGetResult);
+	}
+
+	ScriptTextureReadback::Slot* ScriptTextureReadback::findLatestCompleted()
+	{
+		Slot* latest = nullptr;
+		for (auto& slot : mSlots)
+		{
+			if (!slot.pending || !slot.op.hasCompleted())
+				continue;
+
+			if (latest == nullptr || slot.sequence > latest->sequence)
+				latest = &slot;
+		}
+
+		return latest;
+	}
+
+	void ScriptTextureReadback::internal_Create(MonoObject* instance, ScriptTexture* texture, UINT32 face,
+		UINT32 mipLevel, UINT32 framesInFlight)
+	{
+		new (bs_alloc<ScriptTextureReadback>()) ScriptTextureReadback(instance, texture->getHandle(), face, mipLevel,
+			framesInFlight);
+	}
+
+	UINT32 ScriptTextureReadback::internal_GetResultSize(ScriptTextureReadback* thisPtr)
+	{
+		return thisPtr->mSize;
+	}
+
+	UINT32 ScriptTextureReadback::internal_GetNumPending(ScriptTextureReadback* thisPtr)
+	{
+		UINT32 numPending = 0;
+		for (auto& slot : thisPtr->mSlots)
+		{
+			if (slot.pending && !slot.op.hasCompleted())
+				numPending++;
+		}
+
+		return numPending;
+	}
+
+	bool ScriptTextureReadback::internal_IsResultAvailable(ScriptTextureReadback* thisPtr)
+	{
+		return thisPtr->findLatestCompleted() != nullptr;
+	}
+
+	bool ScriptTextureReadback::internal_Request(ScriptTextureReadback* thisPtr)
+	{
+		if (thisPtr->mSlots.empty() || !thisPtr->mTexture.isLoaded(false))
+			return false;
+
+		// The GPU is still writing to the oldest buffer, caller has requested reads faster than they complete
+		Slot& slot = thisPtr->mSlots[thisPtr->mNextSlot];
+		if (slot.pending && !slot.op.hasCompleted())
+			return false;
+
+		slot.op = thisPtr->mTexture->readData(slot.buffer, thisPtr->mFace, thisPtr->mMipLevel);
+		slot.sequence = thisPtr->mNextSequence++;
+		slot.pending = true;
+
+		thisPtr->mNextSlot = (thisPtr->mNextSlot + 1) % (UINT32)thisPtr->mSlots.size();
+		return true;
+	}
+
+	bool ScriptTextureReadback::internal_TryGetResult(ScriptTextureReadback* thisPtr, MonoArray* output)
+	{
+		if (output == nullptr)
+			return false;
+
+		Slot* latest = thisPtr->findLatestCompleted();
+		if (latest == nullptr)
+			return false;
+
+		ScriptArray outputArray(output);
+		if (outputArray.size() < thisPtr->mSize)
+		{
+			LOGWRN("Texture readback result requested with an insufficient output buffer. Ignoring call.");
+			return false;
+		}
+
+		memcpy(outputArray.getRaw<UINT8>(), latest->buffer->getData(), thisPtr->mSize);
+
+		// Older completed results are superseded by this one
+		UINT64 sequence = latest->sequence;
+		for (auto& slot : thisPtr->mSlots)
+		{
+			if (slot.pending && slot.sequence <= sequence && slot.op.hasCompleted())
+				slot.pending = false;
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Image/BsPixelData.h"
+#include "Threading/BsAsyncOp.h"
+
+namespace bs
+{
+	class ScriptTexture;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for TextureReadback. Reads a texture surface from the GPU into a ring of buffers
+	 * that are allocated once and reused, allowing multiple reads to be in flight at once. Completed reads are copied
+	 * into caller provided managed arrays.
+	 */
+	class BS_SCR_BE_EXPORT ScriptTextureReadback : public ScriptObject<ScriptTextureReadback>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "TextureReadback")
+
+	private:
+		/** A single buffer in the readback ring. */
+		struct Slot
+		{
+			SPtr<PixelData> buffer;
+			AsyncOp op;
+			UINT64 sequence = 0; /**< Incremented for every request, used for finding the most recent result. */
+			bool pending = false; /**< True if the slot contains a request whose result wasn't retrieved yet. */
+		};
+
+		ScriptTextureReadback(MonoObject* instance, const HTexture& texture, UINT32 face, UINT32 mipLevel,
+			UINT32 numSlots);
+
+		/** Returns the completed slot with the most recent request, or null if no requests completed. */
+		Slot* findLatestCompleted();
+
+		HTexture mTexture;
+		UINT32 mFace;
+		UINT32 mMipLevel;
+		UINT32 mSize = 0;
+
+		Vector<Slot> mSlots;
+		UINT32 mNextSlot = 0;
+		UINT64 mNextSequence = 1;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_Create(MonoObject* instance, ScriptTexture* texture, UINT32 face, UINT32 mipLevel,
+			UINT32 framesInFlight);
+		static UINT32 internal_GetResultSize(ScriptTextureReadback* thisPtr);
+		static UINT32 internal_GetNumPending(ScriptTextureReadback* thisPtr);
+		static bool internal_IsResultAvailable(ScriptTextureReadback* thisPtr);
+		static bool internal_Request(ScriptTextureReadback* thisPtr);
+		static bool internal_TryGetResult(ScriptTextureReadback* thisPtr, MonoArray* output);
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptTextureStagingBuffer.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoArray.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+
+#include "BsScriptTexture.generated.h"
+
+namespace bs
+{
+	ScriptTextureStagingBuffer::ScriptTextureStagingBuffer(MonoObject* instance, const HTexture& texture, UINT32 face,
+		UINT32 mipLevel)
+		:ScriptObject(instance), mTexture(texture), mFace(face), mMipLevel(mipLevel)
+	{
+		if (!isValidSurface(texture, face, mipLevel))
+			return;
+
+		mStaging = texture->getProperties().allocBuffer(face, mipLevel);
+
+		UINT32 size = PixelUtil::getMemorySize(mStaging->getWidth(), mStaging->getHeight(), mStaging->getDepth(),
+			mStaging->getFormat());
+		memset(mStaging->getData(), 0, size);
+	}
+
+	void ScriptTextureStagingBuffer::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptTextureStagingBuffer::internal_Create);
+		metaData.scriptClass->addInternalCall("Internal_GetSize", (void*)&ScriptTextureStagingBuffer::internal_GetSize);
+		metaData.scriptClass->addInternalCall("Internal_GetRowPitch",
+			(void*)&ScriptTextureStagingBuffer::internal_GetRowPitch);
+		metaData.scriptClass->addInternalCall("Internal_Write", (void*)&ScriptTextureStagingBuffer::internal_Write);
+		metaData.scriptClass->addInternalCall("Internal_WriteRegion",
+			(void*)&ScriptTextureStagingBuffer::internal_WriteRegion);
+		metaData.scriptClass->addInternalCall("Internal_Upload", (void*)&ScriptTextureStagingBuffer::internal_Upload);
+		metaData.scriptClass->addInternalCall("Internal_GetRawSize",
+			(void*)&ScriptTextureStagingBuffer::internal_GetRawSize);
+		metaData.scriptClass->addInternalCall("Internal_SetRawPixels",
+			(void*)&ScriptTextureStagingBuffer::internal_SetRawPixels);
+		metaData.scriptClass->addInternalCall("Internal_GetRawPixels",
+			(void*)&ScriptTextureStagingBuffer::internal_GetRawPixels);
+	}
+
+	UINT32 ScriptTextureStagingBuffer::getRowSize(PixelFormat format, UINT32 width)
+	{
+		// Compressed formats store pixels in 4x4 blocks
+		UINT32 blockHeight = PixelUtil::isCompressed(format) ? 4 : 1;
+		return PixelUtil::getMemorySize(width, blockHeight, 1, format);
+	}
+
+	bool ScriptTextureStagingBuffer::isValidSurface(const HTexture& texture, UINT32 face, UINT32 mipLevel)
+	{
+		if (!texture.isLoaded(false))
+			return false;
+
+		const TextureProperties& props = texture->getProperties();
+		if (face >= props.getNumFaces() || mipLevel > props.getNumMipmaps())
+		{
+			LOGWRN("Texture doesn't contain face " + toString(face) + " at mip level " + toString(mipLevel) + ".");
+			return false;
+		}
+
+		return true;
+	}
+
+	SPtr<PixelData> ScriptTextureStagingBuffer::getFreeUploadBuffer()
+	{
+		// Buffers remain locked until the core thread uploads them to the texture
+		for (auto& buffer : mUploadBuffers)
+		{
+			if (!buffer->isLocked())
+				return buffer;
+		}
+
+		SPtr<PixelData> buffer = mTexture->getProperties().allocBuffer(mFace, mMipLevel);
+		mUploadBuffers.push_back(buffer);
+
+		return buffer;
+	}
+
+	void ScriptTextureStagingBuffer::internal_Create(MonoObject* instance, ScriptTexture* texture, UINT32 face,
+		UINT32 mipLevel)
+	{
+		new (bs_alloc<ScriptTextureStagingBuffer>()) ScriptTextureStagingBuffer(instance, texture->getHandle(), face,
+			mipLevel);
+	}
+
+	UINT32 ScriptTextureStagingBuffer::internal_GetSize(ScriptTextureStagingBuffer* thisPtr)
+	{
+		const SPtr<PixelData>& staging = thisPtr->mStaging;
+		if (staging == nullptr)
+			return 0;
+
+		return PixelUtil::getMemorySize(staging->getWidth(), staging->getHeight(), staging->getDepth(),
+			staging->getFormat());
+	}
+
+	UINT32 ScriptTextureStagingBuffer::internal_GetRowPitch(ScriptTextureStagingBuffer* thisPtr)
+	{
+		const SPtr<PixelData>& staging = thisPtr->mStaging;
+		if (staging == nullptr)
+			return 0;
+
+		return getRowSize(staging->getFormat(), staging->getWidth());
+	}
+
+	bool ScriptTextureStagingBuffer::internal_Write(ScriptTextureStagingBuffer* thisPtr, MonoArray* data)
+	{
+		UINT32 size = internal_GetSize(thisPtr);
+		if (size == 0 || data == nullptr)
+			return false;
+
+		ScriptArray dataArray(data);
+		if (dataArray.size() < size)
+		{
+			LOGWRN("Texture staging buffer write called with insufficient data. Ignoring call.");
+			return false;
+		}
+
+		memcpy(thisPtr->mStaging->getData(), dataArray.getRaw<UINT8>(), size);
+		thisPtr->mIsDirty = true;
+
+		return true;
+	}
+
+	bool ScriptTextureStagingBuffer::internal_WriteRegion(ScriptTextureStagingBuffer* thisPtr, MonoArray* data,
+		UINT32 dataRowPitch, UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		const SPtr<PixelData>& staging = thisPtr->mStaging;
+		if (staging == nullptr || data == nullptr || width == 0 || height == 0)
+			return false;
+
+		UINT32 surfaceWidth = staging->getWidth();
+		UINT32 surfaceHeight = staging->getHeight();
+		PixelFormat format = staging->getFormat();
+
+		if (staging->getDepth() > 1 || x + width > surfaceWidth || y + height > surfaceHeight)
+		{
+			LOGWRN("Texture staging buffer region write called with an invalid region. Ignoring call.");
+			return false;
+		}
+
+		UINT32 blockSize = 1;
+		if (PixelUtil::isCompressed(format))
+		{
+			blockSize = 4;
+
+			// Regions must cover whole blocks, except where they touch the right or bottom edge of the surface
+			bool alignedX = (x % blockSize) == 0 && ((width % blockSize) == 0 || x + width == surfaceWidth);
+			bool alignedY = (y % blockSize) == 0 && ((height % blockSize) == 0 || y + height == surfaceHeight);
+
+			if (!alignedX || !alignedY)
+			{
+				LOGWRN("Texture staging buffer region write must be aligned to compressed blocks. Ignoring call.");
+				return false;
+			}
+		}
+
+		UINT32 rowSize = getRowSize(format, width);
+		UINT32 numRows = Math::divideAndRoundUp(height, blockSize);
+
+		if (dataRowPitch == 0)
+			dataRowPitch = rowSize;
+
+		ScriptArray dataArray(data);
+		if (dataRowPitch < rowSize || dataArray.size() < dataRowPitch * (numRows - 1) + rowSize)
+		{
+			LOGWRN("Texture staging buffer region write called with insufficient data. Ignoring call.");
+			return false;
+		}
+
+		UINT32 stagingRowPitch = getRowSize(format, surfaceWidth);
+
+		const UINT8* src = dataArray.getRaw<UINT8>();
+		UINT8* dst = staging->getData() + (y / blockSize) * stagingRowPitch + getRowSize(format, x);
+
+		for (UINT32 i = 0; i < numRows; i++)
+			memcpy(dst + i * stagingRowPitch, src + i * dataRowPitch, rowSize);
+
+		thisPtr->mIsDirty = true;
+		return true;
+	}
+
+	void ScriptTextureStagingBuffer::internal_Upload(ScriptTextureStagingBuffer* thisPtr)
+	{
+		if (!thisPtr->mIsDirty || !thisPtr->mTexture.isLoaded(false))
+			return;
+
+		UINT32 size = internal_GetSize(thisPtr);
+
+		SPtr<PixelData> buffer = thisPtr->getFreeUploadBuffer();
+		memcpy(buffer->getData(), thisPtr->mStaging->getData(), size);
+
+		// Whole surface is always written, so any previous contents can be discarded
+		thisPtr->mTexture->writeData(buffer, thisPtr->mFace, thisPtr->mMipLevel, true);
+		thisPtr->mIsDirty = false;
+	}
+
+	UINT32 ScriptTextureStagingBuffer::internal_GetRawSize(ScriptTexture* texture, UINT32 face, UINT32 mipLevel)
+	{
+		HTexture nativeTexture = texture->getHandle();
+		if (!isValidSurface(nativeTexture, face, mipLevel))
+			return 0;
+
+		const TextureProperties& props = nativeTexture->getProperties();
+
+		UINT32 width, height, depth;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel, width, height,
+			depth);
+
+		return PixelUtil::getMemorySize(width, height, depth, props.getFormat());
+	}
+
+	bool ScriptTextureStagingBuffer::internal_SetRawPixels(ScriptTexture* texture, MonoArray* data, UINT32 face,
+		UINT32 mipLevel)
+	{
+		UINT32 size = internal_GetRawSize(texture, face, mipLevel);
+		if (size == 0 || data == nullptr)
+			return false;
+
+		ScriptArray dataArray(data);
+		if (dataArray.size() < size)
+		{
+			LOGWRN("SetRawPixels called with insufficient data. Ignoring call.");
+			return false;
+		}
+
+		HTexture nativeTexture = texture->getHandle();
+
+		// Data is copied as is, without any conversion. Buffer must outlive the call, as the upload happens on the core
+		// thread.
+		SPtr<PixelData> pixelData = nativeTexture->getProperties().allocBuffer(face, mipLevel);
+		memcpy(pixelData->getData(), dataArray.getRaw<UINT8>(), size);
+
+		nativeTexture->writeData(pixelData, face, mipLevel, true);
+		return true;
+	}
+
+	bool ScriptTextureStagingBuffer::internal_GetRawPixels(ScriptTexture* texture, MonoArray* output, UINT32 face,
+		UINT32 mipLevel)
+	{
+		UINT32 size = internal_GetRawSize(texture, face, mipLevel);
+		if (size == 0 || output == nullptr)
+			return false;
+
+		HTexture nativeTexture = texture->getHandle();
+		const TextureProperties& props = nativeTexture->getProperties();
+
+		if ((props.getUsage() & TU_CPUCACHED) == 0)
+		{
+			LOGWRN("GetRawPixels requires a texture created with TextureUsage.CPUCached. Ignoring call.");
+			return false;
+		}
+
+		ScriptArray outputArray(output);
+		if (outputArray.size() < size)
+		{
+			LOGWRN("GetRawPixels called with an insufficient output buffer. Ignoring call.");
+			return false;
+		}
+
+		UINT32 width, height, depth;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel, width, height,
+			depth);
+
+		// Read directly into the managed array, avoiding an intermediate buffer
+		PixelData pixelData(width, height, depth, props.getFormat());
+		pixelData.setExternalBuffer(outputArray.getRaw<UINT8>());
+
+		nativeTexture->readCachedData(pixelData, face, mipLevel);
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Image/BsPixelData.h"
+
+namespace bs
+{
+	class ScriptTexture;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for TextureStagingBuffer. Keeps a copy of a single texture surface in the
+	 * texture's native pixel format. Scripts can update the whole surface or only parts of it, after which the surface
+	 * is uploaded to the texture. Buffers used for uploading are reused once the core thread is done with them, meaning
+	 * textures can be updated every frame without any allocations or pixel format conversions.
+	 *
+	 * Also provides raw (native pixel format) access to texture surfaces without a staging buffer.
+	 */
+	class BS_SCR_BE_EXPORT ScriptTextureStagingBuffer : public ScriptObject<ScriptTextureStagingBuffer>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "TextureStagingBuffer")
+
+	private:
+		ScriptTextureStagingBuffer(MonoObject* instance, const HTexture& texture, UINT32 face, UINT32 mipLevel);
+
+		/**
+		 * Returns the number of bytes in a single row of pixels of the specified width. For compressed formats returns
+		 * the number of bytes in a single row of blocks.
+		 */
+		static UINT32 getRowSize(PixelFormat format, UINT32 width);
+
+		/** Checks does the texture contain the specified surface, logging a warning if it doesn't. */
+		static bool isValidSurface(const HTexture& texture, UINT32 face, UINT32 mipLevel);
+
+		/** Returns a buffer the core thread is not currently reading from, allocating a new one if all are in use. */
+		SPtr<PixelData> getFreeUploadBuffer();
+
+		HTexture mTexture;
+		UINT32 mFace;
+		UINT32 mMipLevel;
+
+		SPtr<PixelData> mStaging;
+		Vector<SPtr<PixelData>> mUploadBuffers;
+		bool mIsDirty = false;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_Create(MonoObject* instance, ScriptTexture* texture, UINT32 face, UINT32 mipLevel);
+		static UINT32 internal_GetSize(ScriptTextureStagingBuffer* thisPtr);
+		static UINT32 internal_GetRowPitch(ScriptTextureStagingBuffer* thisPtr);
+		static bool internal_Write(ScriptTextureStagingBuffer* thisPtr, MonoArray* data);
+		static bool internal_WriteRegion(ScriptTextureStagingBuffer* thisPtr, MonoArray* data, UINT32 dataRowPitch,
+			UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+		static void internal_Upload(ScriptTextureStagingBuffer* thisPtr);
+
+		static UINT32 internal_GetRawSize(ScriptTexture* texture, UINT32 face, UINT32 mipLevel);
+		static bool internal_SetRawPixels(ScriptTexture* texture, MonoArray* data, UINT32 face, UINT32 mipLevel);
+		static bool internal_GetRawPixels(ScriptTexture* texture, MonoArray* output, UINT32 face, UINT32 mipLevel);
+	};
+
+	/** @} */
+}
\ No newline at end of file